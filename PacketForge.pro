@@ -41,6 +41,9 @@ CONFIG(release, debug|release) {
 # --- Dependencies ---
 QT += core gui serialport network widgets serialbus
 
+# 1 ms timer resolution for capture replay (timeBeginPeriod)
+win32: LIBS += -lwinmm
+
 # --- Output Directories ---
 # Keep build artifacts out of the source tree
 DESTDIR = $$PWD/bin
@@ -61,7 +64,8 @@ INCLUDEPATH += $$PWD/src/ui \
                $$PWD/src/modules/traffic \
                $$PWD/src/modules/oscilloscope \
                $$PWD/src/modules/visualizer \
-               $$PWD/src/modules/checksum
+               $$PWD/src/modules/checksum \
+               $$PWD/src/modules/viewer
 
 DEPENDPATH += $$PWD/src/ui \
               $$PWD/src/network \
@@ -79,12 +83,46 @@ SOURCES += \
     src/network/UdpClass.cpp \
     src/network/AbstractCommunicationHandlerClass.cpp \
     src/core/AutoUpdater.cpp \
+    src/core/SerialPortRegistry.cpp \
+    src/core/DataFormat.cpp \
+    src/core/LogWriter.cpp \
+    src/core/CaptureFile.cpp \
+    src/core/CaptureReplayer.cpp \
+    src/core/CaptureIndexer.cpp \
+    src/core/TriggerMatcher.cpp \
+    src/core/AutoResponder.cpp \
+    src/core/Checksum.cpp \
+    src/core/CpuFeatures.cpp \
+    src/core/Crc.cpp \
+    src/core/CrcModel.cpp \
+    src/core/FrameValidator.cpp \
+    src/core/CrcSolver.cpp \
+    src/core/XxHash3.cpp \
+    src/core/Blake3.cpp \
+    src/core/DeviceSimulator.cpp \
     src/ui/MacroDialog.cpp \
+    src/ui/HexViewWidget.cpp \
     src/modules/modbus/ModbusClientWidget.cpp \
     src/modules/traffic/TrafficMonitorWidget.cpp \
     src/modules/oscilloscope/OscilloscopeWidget.cpp \
+    src/modules/oscilloscope/ChannelLayout.cpp \
+    src/modules/oscilloscope/TelemetryDecoder.cpp \
+    src/modules/oscilloscope/PlotArea.cpp \
+    src/modules/oscilloscope/SampleRing.cpp \
+    src/modules/oscilloscope/SampleStore.cpp \
+    src/modules/oscilloscope/ScopeTrigger.cpp \
+    src/modules/oscilloscope/Fft.cpp \
+    src/modules/oscilloscope/SpectrumAnalyzer.cpp \
+    src/modules/oscilloscope/SpectrumView.cpp \
     src/modules/visualizer/ByteVisualizerWidget.cpp \
-    src/modules/checksum/ChecksumWidget.cpp
+    src/modules/checksum/ChecksumWidget.cpp \
+    src/modules/checksum/ChecksumEngine.cpp \
+    src/modules/checksum/ChecksumManifest.cpp \
+    src/modules/checksum/FileHashCache.cpp \
+    src/modules/checksum/CrcSolverWidget.cpp \
+    src/modules/checksum/FileHasher.cpp \
+    src/modules/viewer/CaptureViewerWidget.cpp \
+    src/modules/viewer/CaptureTableModel.cpp
 
 # --- Header Files ---
 HEADERS += \
@@ -98,13 +136,49 @@ HEADERS += \
     src/core/Debugger.h \
     src/core/Paths.h \
     src/core/AutoUpdater.h \
+    src/core/SerialPortRegistry.h \
+    src/core/SpscQueue.h \
+    src/core/DataFormat.h \
+    src/core/LogWriter.h \
+    src/core/CaptureFile.h \
+    src/core/CaptureReplayer.h \
+    src/core/CaptureIndexer.h \
+    src/core/TriggerMatcher.h \
+    src/core/RxResponder.h \
+    src/core/AutoResponder.h \
+    src/core/Checksum.h \
+    src/core/CpuFeatures.h \
+    src/core/Crc.h \
+    src/core/CrcModel.h \
+    src/core/FrameValidator.h \
+    src/core/CrcSolver.h \
+    src/core/XxHash3.h \
+    src/core/Blake3.h \
+    src/core/DeviceSimulator.h \
     src/macros/macros.h \
     src/ui/MacroDialog.h \
+    src/ui/HexViewWidget.h \
     src/modules/modbus/ModbusClientWidget.h \
     src/modules/traffic/TrafficMonitorWidget.h \
     src/modules/oscilloscope/OscilloscopeWidget.h \
+    src/modules/oscilloscope/ChannelLayout.h \
+    src/modules/oscilloscope/TelemetryDecoder.h \
+    src/modules/oscilloscope/PlotArea.h \
+    src/modules/oscilloscope/SampleRing.h \
+    src/modules/oscilloscope/SampleStore.h \
+    src/modules/oscilloscope/ScopeTrigger.h \
+    src/modules/oscilloscope/Fft.h \
+    src/modules/oscilloscope/SpectrumAnalyzer.h \
+    src/modules/oscilloscope/SpectrumView.h \
     src/modules/visualizer/ByteVisualizerWidget.h \
-    src/modules/checksum/ChecksumWidget.h
+    src/modules/checksum/ChecksumWidget.h \
+    src/modules/checksum/ChecksumEngine.h \
+    src/modules/checksum/ChecksumManifest.h \
+    src/modules/checksum/FileHashCache.h \
+    src/modules/checksum/CrcSolverWidget.h \
+    src/modules/checksum/FileHasher.h \
+    src/modules/viewer/CaptureViewerWidget.h \
+    src/modules/viewer/CaptureTableModel.h
 
 # --- Forms & Resources ---
 FORMS += \
@@ -115,7 +189,9 @@ FORMS += \
     src/modules/traffic/TrafficMonitorWidget.ui \
     src/modules/oscilloscope/OscilloscopeWidget.ui \
     src/modules/visualizer/ByteVisualizerWidget.ui \
-    src/modules/checksum/ChecksumWidget.ui
+    src/modules/checksum/ChecksumWidget.ui \
+    src/modules/checksum/CrcSolverWidget.ui \
+    src/modules/viewer/CaptureViewerWidget.ui
 RESOURCES += Files/Resources.qrc
 
 # --- Deployment ---
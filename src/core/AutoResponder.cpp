@@ -0,0 +1,112 @@
+/**
+ * @file AutoResponder.cpp
+ * @brief Implementation of the I/O-thread auto-responder.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "AutoResponder.h"
+
+#include <QMutexLocker>
+#include <QObject>
+#include <QStringList>
+#include <QTimer>
+
+#include <chrono>
+
+qint64 RxResponder::nowNs()
+{
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+bool AutoResponder::setRules(const QVector<Rule> &rules, QString *errorMessage)
+{
+    QStringList patterns;
+    patterns.reserve(rules.size());
+    for (const Rule &rule : rules)
+        patterns.append(rule.pattern);
+
+    // Compile outside the lock; the I/O thread keeps matching meanwhile
+    TriggerMatcher matcher;
+    if (!matcher.setPatterns(patterns, errorMessage))
+        return false;
+
+    QMutexLocker lock(&m_mutex);
+    m_matcher = matcher;
+    m_rules = rules;
+    m_stats = QVector<Stats>(m_rules.size());
+    ++m_generation;
+    m_active.store(!m_matcher.isEmpty());
+    return true;
+}
+
+void AutoResponder::reset()
+{
+    QMutexLocker lock(&m_mutex);
+    m_matcher.reset();
+}
+
+void AutoResponder::process(const QByteArray &data, qint64 rxTimestampNs,
+                            QObject *context, const WriteFunction &write)
+{
+    if (!isActive())
+        return;
+
+    QVector<Rule> due;
+    quint64 generation;
+    QVector<int> ruleIds;
+    {
+        QMutexLocker lock(&m_mutex);
+        m_hits.clear();
+        if (m_matcher.feed(data.constData(), data.size(), m_hits) == 0)
+            return;
+        for (int id : m_hits) {
+            due.append(m_rules.at(id));
+            ruleIds.append(id);
+        }
+        generation = m_generation;
+    }
+
+    // Replies go out without holding the lock
+    for (int i = 0; i < due.size(); ++i) {
+        const Rule &rule = due.at(i);
+        const int id = ruleIds.at(i);
+
+        if (rule.delayMs > 0) {
+            const QByteArray response = rule.response;
+            const qint64 delayNs = qint64(rule.delayMs) * 1000000;
+            QTimer::singleShot(rule.delayMs, Qt::PreciseTimer, context,
+                               [this, write, response, id, generation, rxTimestampNs, delayNs]() {
+                if (write(response))
+                    record(id, nowNs() - rxTimestampNs - delayNs, generation);
+            });
+        } else if (write(rule.response)) {
+            record(id, nowNs() - rxTimestampNs, generation);
+        }
+    }
+}
+
+void AutoResponder::record(int rule, qint64 latencyNs, quint64 generation)
+{
+    QMutexLocker lock(&m_mutex);
+    if (generation != m_generation || rule >= m_stats.size())
+        return;
+
+    Stats &s = m_stats[rule];
+    latencyNs = qMax<qint64>(latencyNs, 0);
+    s.lastNs = latencyNs;
+    s.minNs = s.replies ? qMin(s.minNs, latencyNs) : latencyNs;
+    s.maxNs = qMax(s.maxNs, latencyNs);
+    s.totalNs += latencyNs;
+    ++s.replies;
+}
+
+QVector<AutoResponder::Stats> AutoResponder::stats() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_stats;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file AutoResponder.h
+ * @brief Auto-answer triggers evaluated and answered on the handler's I/O thread.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * The GUI compiles the rules with setRules(); the communication handler
+ * calls process() with each chunk right after reading it from the device,
+ * in whatever thread owns the device, and the reply is written from there.
+ * Neither the match nor the write waits for the GUI event loop, table
+ * painting or logging.
+ *
+ * For every rule the time from reading the chunk to handing the reply to
+ * the device (minus the configured delay) is recorded and can be read back
+ * with stats().
+ */
+
+#ifndef AUTORESPONDER_H
+#define AUTORESPONDER_H
+
+#include <QByteArray>
+#include <QMutex>
+#include <QString>
+#include <QVector>
+
+#include <atomic>
+
+#include "RxResponder.h"
+#include "TriggerMatcher.h"
+
+class AutoResponder : public RxResponder
+{
+public:
+    struct Rule {
+        QString pattern;        ///< TriggerMatcher syntax; empty = disabled
+        QByteArray response;
+        int delayMs = 0;
+    };
+
+    struct Stats {
+        quint64 replies = 0;
+        qint64 lastNs = 0;      ///< Latency of the most recent reply
+        qint64 minNs = 0;
+        qint64 maxNs = 0;
+        qint64 totalNs = 0;
+
+        qint64 meanNs() const { return replies ? qint64(totalNs / qint64(replies)) : 0; }
+    };
+
+    AutoResponder() = default;
+
+    /**
+     * @brief Compiles @p rules (rule ids are their indexes) and clears the stats.
+     * @return false if a pattern is invalid or the set is too large; the
+     *         previous rules then stay in effect.
+     */
+    bool setRules(const QVector<Rule> &rules, QString *errorMessage = nullptr);
+
+    /**
+     * @brief True if at least one rule has a pattern. Cheap; any thread.
+     */
+    bool isActive() const override { return m_active.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Forgets partial matches (call when the connection changes).
+     */
+    void reset() override;
+
+    /**
+     * @brief Matches a received chunk and sends the replies. I/O thread only.
+     */
+    void process(const QByteArray &data, qint64 rxTimestampNs, QObject *context,
+                 const WriteFunction &write) override;
+
+    /**
+     * @brief Latency statistics per rule, indexed like the rules.
+     */
+    QVector<Stats> stats() const;
+
+private:
+    void record(int rule, qint64 latencyNs, quint64 generation);
+
+    mutable QMutex m_mutex;
+    TriggerMatcher m_matcher;
+    QVector<Rule> m_rules;
+    QVector<Stats> m_stats;
+    QVector<int> m_hits;
+    quint64 m_generation = 0;   ///< Bumped by setRules(); late delayed replies are not counted
+    std::atomic<bool> m_active{false};
+};
+
+#endif // AUTORESPONDER_H
@@ -0,0 +1,761 @@
+/**
+ * @file Blake3.cpp
+ * @brief Implementation of BLAKE3, its compression kernels and tree hashing.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "Blake3.h"
+
+#include "CpuFeatures.h"
+
+#include <QSemaphore>
+#include <QThreadPool>
+#include <QtAlgorithms>
+#include <QtEndian>
+
+#include <cstring>
+
+namespace {
+
+using Blake3::BLOCK_LEN;
+using Blake3::CHUNK_LEN;
+using Blake3::OUT_LEN;
+
+enum Flags : quint8 {
+    CHUNK_START = 1,
+    CHUNK_END = 2,
+    PARENT = 4,
+    ROOT = 8
+};
+
+const quint32 IV[8] = {0x6A09E667u, 0xBB67AE85u, 0x3C6EF372u, 0xA54FF53Au,
+                       0x510E527Fu, 0x9B05688Cu, 0x1F83D9ABu, 0x5BE0CD19u};
+
+/// Message word order of each of the seven rounds
+const quint8 SCHEDULE[7][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8},
+    {3, 4, 10, 12, 13, 2, 7, 14, 6, 5, 9, 0, 11, 15, 8, 1},
+    {10, 7, 12, 9, 14, 3, 13, 15, 4, 0, 11, 2, 5, 8, 1, 6},
+    {12, 13, 9, 11, 15, 10, 14, 8, 7, 2, 5, 3, 0, 1, 6, 4},
+    {9, 14, 11, 5, 8, 12, 15, 1, 13, 3, 0, 10, 2, 6, 4, 7},
+    {11, 15, 5, 0, 1, 9, 8, 6, 14, 10, 2, 12, 3, 4, 7, 13},
+};
+
+const int MAX_SIMD_DEGREE = 8;
+
+// --- Portable compression ---
+
+inline quint32 rotr(quint32 x, int n) { return (x >> n) | (x << (32 - n)); }
+
+inline void g(quint32 *v, int a, int b, int c, int d, quint32 x, quint32 y)
+{
+    v[a] += v[b] + x;
+    v[d] = rotr(v[d] ^ v[a], 16);
+    v[c] += v[d];
+    v[b] = rotr(v[b] ^ v[c], 12);
+    v[a] += v[b] + y;
+    v[d] = rotr(v[d] ^ v[a], 8);
+    v[c] += v[d];
+    v[b] = rotr(v[b] ^ v[c], 7);
+}
+
+/// Runs the compression function; the first 8 words of @p v are the new chaining value
+void compress(const quint32 cv[8], const uchar block[BLOCK_LEN], int blockLen, quint64 counter,
+              quint8 flags, quint32 v[16])
+{
+    quint32 m[16];
+    for (int i = 0; i < 16; ++i)
+        m[i] = qFromLittleEndian<quint32>(block + 4 * i);
+    for (int i = 0; i < 8; ++i)
+        v[i] = cv[i];
+    v[8] = IV[0];
+    v[9] = IV[1];
+    v[10] = IV[2];
+    v[11] = IV[3];
+    v[12] = quint32(counter);
+    v[13] = quint32(counter >> 32);
+    v[14] = quint32(blockLen);
+    v[15] = flags;
+
+    for (const quint8 *s : SCHEDULE) {
+        g(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+        g(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+        g(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+        g(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+        g(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+        g(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+        g(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+        g(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+    }
+    for (int i = 0; i < 8; ++i) {
+        v[i] ^= v[i + 8];
+        v[i + 8] ^= cv[i];
+    }
+}
+
+inline void compressInPlace(quint32 cv[8], const uchar block[BLOCK_LEN], int blockLen,
+                            quint64 counter, quint8 flags)
+{
+    quint32 v[16];
+    compress(cv, block, blockLen, counter, flags, v);
+    std::memcpy(cv, v, 8 * sizeof(quint32));
+}
+
+inline void storeCv(uchar *out, const quint32 cv[8])
+{
+    for (int i = 0; i < 8; ++i)
+        qToLittleEndian<quint32>(cv[i], out + 4 * i);
+}
+
+void hashManyPortable(const uchar *const *inputs, size_t count, size_t blocks, const quint32 key[8],
+                      quint64 counter, bool incrementCounter, quint8 flags, quint8 flagsStart,
+                      quint8 flagsEnd, uchar *out)
+{
+    for (size_t i = 0; i < count; ++i, out += OUT_LEN) {
+        quint32 cv[8];
+        std::memcpy(cv, key, sizeof(cv));
+        for (size_t b = 0; b < blocks; ++b) {
+            quint8 blockFlags = flags;
+            if (b == 0)
+                blockFlags |= flagsStart;
+            if (b + 1 == blocks)
+                blockFlags |= flagsEnd;
+            compressInPlace(cv, inputs[i] + b * BLOCK_LEN, BLOCK_LEN, counter, blockFlags);
+        }
+        storeCv(out, cv);
+        if (incrementCounter)
+            ++counter;
+    }
+}
+
+#if CPU_X86
+
+// --- SSE4.1: four inputs, one per 32-bit lane ---
+
+CPU_TARGET("sse4.1")
+inline __m128i add4(__m128i a, __m128i b) { return _mm_add_epi32(a, b); }
+
+CPU_TARGET("sse4.1")
+inline __m128i xor4(__m128i a, __m128i b) { return _mm_xor_si128(a, b); }
+
+CPU_TARGET("sse4.1")
+inline __m128i rot16x4(__m128i x)
+{
+    return _mm_shuffle_epi8(x, _mm_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2));
+}
+
+CPU_TARGET("sse4.1")
+inline __m128i rot12x4(__m128i x) { return _mm_or_si128(_mm_srli_epi32(x, 12), _mm_slli_epi32(x, 20)); }
+
+CPU_TARGET("sse4.1")
+inline __m128i rot8x4(__m128i x)
+{
+    return _mm_shuffle_epi8(x, _mm_set_epi8(12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1));
+}
+
+CPU_TARGET("sse4.1")
+inline __m128i rot7x4(__m128i x) { return _mm_or_si128(_mm_srli_epi32(x, 7), _mm_slli_epi32(x, 25)); }
+
+CPU_TARGET("sse4.1")
+inline void g4(__m128i *v, int a, int b, int c, int d, __m128i x, __m128i y)
+{
+    v[a] = add4(add4(v[a], v[b]), x);
+    v[d] = rot16x4(xor4(v[d], v[a]));
+    v[c] = add4(v[c], v[d]);
+    v[b] = rot12x4(xor4(v[b], v[c]));
+    v[a] = add4(add4(v[a], v[b]), y);
+    v[d] = rot8x4(xor4(v[d], v[a]));
+    v[c] = add4(v[c], v[d]);
+    v[b] = rot7x4(xor4(v[b], v[c]));
+}
+
+/// Transposes a 4x4 matrix of 32-bit words held one row per vector
+CPU_TARGET("sse4.1")
+inline void transpose4(__m128i *r)
+{
+    const __m128i t0 = _mm_unpacklo_epi32(r[0], r[1]);
+    const __m128i t1 = _mm_unpacklo_epi32(r[2], r[3]);
+    const __m128i t2 = _mm_unpackhi_epi32(r[0], r[1]);
+    const __m128i t3 = _mm_unpackhi_epi32(r[2], r[3]);
+    r[0] = _mm_unpacklo_epi64(t0, t1);
+    r[1] = _mm_unpackhi_epi64(t0, t1);
+    r[2] = _mm_unpacklo_epi64(t2, t3);
+    r[3] = _mm_unpackhi_epi64(t2, t3);
+}
+
+CPU_TARGET("sse4.1")
+void hash4Sse41(const uchar *const *inputs, size_t blocks, const quint32 key[8], quint64 counter,
+                bool incrementCounter, quint8 flags, quint8 flagsStart, quint8 flagsEnd, uchar *out)
+{
+    __m128i h[8];
+    for (int i = 0; i < 8; ++i)
+        h[i] = _mm_set1_epi32(int(key[i]));
+
+    quint32 lo[4], hi[4];
+    for (int j = 0; j < 4; ++j) {
+        const quint64 c = counter + (incrementCounter ? quint64(j) : 0);
+        lo[j] = quint32(c);
+        hi[j] = quint32(c >> 32);
+    }
+    const __m128i counterLow = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lo));
+    const __m128i counterHigh = _mm_loadu_si128(reinterpret_cast<const __m128i *>(hi));
+
+    for (size_t b = 0; b < blocks; ++b) {
+        quint8 blockFlags = flags;
+        if (b == 0)
+            blockFlags |= flagsStart;
+        if (b + 1 == blocks)
+            blockFlags |= flagsEnd;
+
+        __m128i m[16];
+        for (int q = 0; q < 4; ++q) {
+            for (int j = 0; j < 4; ++j)
+                m[4 * q + j] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inputs[j] + b * BLOCK_LEN + 16 * q));
+            transpose4(m + 4 * q);
+        }
+
+        __m128i v[16];
+        for (int i = 0; i < 8; ++i)
+            v[i] = h[i];
+        for (int i = 0; i < 4; ++i)
+            v[8 + i] = _mm_set1_epi32(int(IV[i]));
+        v[12] = counterLow;
+        v[13] = counterHigh;
+        v[14] = _mm_set1_epi32(BLOCK_LEN);
+        v[15] = _mm_set1_epi32(blockFlags);
+
+        for (const quint8 *s : SCHEDULE) {
+            g4(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+            g4(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+            g4(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+            g4(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+            g4(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+            g4(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+            g4(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+            g4(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+        }
+        for (int i = 0; i < 8; ++i)
+            h[i] = xor4(v[i], v[i + 8]);
+    }
+
+    transpose4(h);
+    transpose4(h + 4);
+    for (int j = 0; j < 4; ++j) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + j * OUT_LEN), h[j]);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + j * OUT_LEN + 16), h[4 + j]);
+    }
+}
+
+// --- AVX2: eight inputs ---
+
+CPU_TARGET("avx2")
+inline __m256i add8(__m256i a, __m256i b) { return _mm256_add_epi32(a, b); }
+
+CPU_TARGET("avx2")
+inline __m256i xor8(__m256i a, __m256i b) { return _mm256_xor_si256(a, b); }
+
+CPU_TARGET("avx2")
+inline __m256i rot16x8(__m256i x)
+{
+    return _mm256_shuffle_epi8(x, _mm256_set_epi8(13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2,
+                                                  13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2));
+}
+
+CPU_TARGET("avx2")
+inline __m256i rot12x8(__m256i x) { return _mm256_or_si256(_mm256_srli_epi32(x, 12), _mm256_slli_epi32(x, 20)); }
+
+CPU_TARGET("avx2")
+inline __m256i rot8x8(__m256i x)
+{
+    return _mm256_shuffle_epi8(x, _mm256_set_epi8(12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1,
+                                                  12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1));
+}
+
+CPU_TARGET("avx2")
+inline __m256i rot7x8(__m256i x) { return _mm256_or_si256(_mm256_srli_epi32(x, 7), _mm256_slli_epi32(x, 25)); }
+
+CPU_TARGET("avx2")
+inline void g8(__m256i *v, int a, int b, int c, int d, __m256i x, __m256i y)
+{
+    v[a] = add8(add8(v[a], v[b]), x);
+    v[d] = rot16x8(xor8(v[d], v[a]));
+    v[c] = add8(v[c], v[d]);
+    v[b] = rot12x8(xor8(v[b], v[c]));
+    v[a] = add8(add8(v[a], v[b]), y);
+    v[d] = rot8x8(xor8(v[d], v[a]));
+    v[c] = add8(v[c], v[d]);
+    v[b] = rot7x8(xor8(v[b], v[c]));
+}
+
+/// Transposes an 8x8 matrix of 32-bit words held one row per vector
+CPU_TARGET("avx2")
+inline void transpose8(__m256i *r)
+{
+    // Within each 128-bit half first, then swap the halves across rows
+    const __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+    const __m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+    const __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+    const __m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+    const __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+    const __m256i t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+    const __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+    const __m256i t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+    const __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+    const __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+    const __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+    const __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+    const __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+    const __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+    const __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+    const __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+    r[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+    r[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+    r[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+    r[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+    r[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+    r[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+    r[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+    r[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+CPU_TARGET("avx2")
+void hash8Avx2(const uchar *const *inputs, size_t blocks, const quint32 key[8], quint64 counter,
+               bool incrementCounter, quint8 flags, quint8 flagsStart, quint8 flagsEnd, uchar *out)
+{
+    __m256i h[8];
+    for (int i = 0; i < 8; ++i)
+        h[i] = _mm256_set1_epi32(int(key[i]));
+
+    quint32 lo[8], hi[8];
+    for (int j = 0; j < 8; ++j) {
+        const quint64 c = counter + (incrementCounter ? quint64(j) : 0);
+        lo[j] = quint32(c);
+        hi[j] = quint32(c >> 32);
+    }
+    const __m256i counterLow = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lo));
+    const __m256i counterHigh = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(hi));
+
+    for (size_t b = 0; b < blocks; ++b) {
+        quint8 blockFlags = flags;
+        if (b == 0)
+            blockFlags |= flagsStart;
+        if (b + 1 == blocks)
+            blockFlags |= flagsEnd;
+
+        __m256i m[16];
+        for (int half = 0; half < 2; ++half) {
+            for (int j = 0; j < 8; ++j)
+                m[8 * half + j] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(inputs[j] + b * BLOCK_LEN + 32 * half));
+            transpose8(m + 8 * half);
+        }
+
+        __m256i v[16];
+        for (int i = 0; i < 8; ++i)
+            v[i] = h[i];
+        for (int i = 0; i < 4; ++i)
+            v[8 + i] = _mm256_set1_epi32(int(IV[i]));
+        v[12] = counterLow;
+        v[13] = counterHigh;
+        v[14] = _mm256_set1_epi32(BLOCK_LEN);
+        v[15] = _mm256_set1_epi32(blockFlags);
+
+        for (const quint8 *s : SCHEDULE) {
+            g8(v, 0, 4, 8, 12, m[s[0]], m[s[1]]);
+            g8(v, 1, 5, 9, 13, m[s[2]], m[s[3]]);
+            g8(v, 2, 6, 10, 14, m[s[4]], m[s[5]]);
+            g8(v, 3, 7, 11, 15, m[s[6]], m[s[7]]);
+            g8(v, 0, 5, 10, 15, m[s[8]], m[s[9]]);
+            g8(v, 1, 6, 11, 12, m[s[10]], m[s[11]]);
+            g8(v, 2, 7, 8, 13, m[s[12]], m[s[13]]);
+            g8(v, 3, 4, 9, 14, m[s[14]], m[s[15]]);
+        }
+        for (int i = 0; i < 8; ++i)
+            h[i] = xor8(v[i], v[i + 8]);
+    }
+
+    transpose8(h);
+    for (int j = 0; j < 8; ++j)
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + j * OUT_LEN), h[j]);
+}
+
+#endif // CPU_X86
+
+struct Kernel
+{
+    int degree;             ///< Inputs per SIMD call
+    const char *name;
+};
+
+const Kernel &kernel()
+{
+    static const Kernel k = []() -> Kernel {
+#if CPU_X86
+        if (cpuFeatures().avx2)
+            return {8, "AVX2"};
+        if (cpuFeatures().sse41 && cpuFeatures().ssse3)
+            return {4, "SSE4.1"};
+#endif
+        return {1, "portable"};
+    }();
+    return k;
+}
+
+/**
+ * @brief Hashes @p count inputs of @p blocks blocks each to one chaining value each.
+ *
+ * Input i uses counter + i when @p incrementCounter is set (chunks), else
+ * counter (parents). The first block adds @p flagsStart, the last @p flagsEnd.
+ */
+void hashMany(const uchar *const *inputs, size_t count, size_t blocks, const quint32 key[8],
+              quint64 counter, bool incrementCounter, quint8 flags, quint8 flagsStart,
+              quint8 flagsEnd, uchar *out)
+{
+#if CPU_X86
+    const int degree = kernel().degree;
+    while (degree >= 8 && count >= 8) {
+        hash8Avx2(inputs, blocks, key, counter, incrementCounter, flags, flagsStart, flagsEnd, out);
+        inputs += 8;
+        count -= 8;
+        counter += incrementCounter ? 8 : 0;
+        out += 8 * OUT_LEN;
+    }
+    while (degree >= 4 && count >= 4) {
+        hash4Sse41(inputs, blocks, key, counter, incrementCounter, flags, flagsStart, flagsEnd, out);
+        inputs += 4;
+        count -= 4;
+        counter += incrementCounter ? 4 : 0;
+        out += 4 * OUT_LEN;
+    }
+#endif
+    hashManyPortable(inputs, count, blocks, key, counter, incrementCounter, flags, flagsStart, flagsEnd, out);
+}
+
+// --- Chunks and parents ---
+
+using Blake3::Hasher;
+
+/// A block that has not been compressed yet, because it may turn out to be the root
+struct Output
+{
+    quint32 cv[8];
+    uchar block[BLOCK_LEN];
+    int blockLen;
+    quint64 counter;
+    quint8 flags;
+
+    void chainingValue(uchar out[OUT_LEN]) const
+    {
+        quint32 v[8];
+        std::memcpy(v, cv, sizeof(v));
+        compressInPlace(v, block, blockLen, counter, flags);
+        storeCv(out, v);
+    }
+
+    void rootBytes(uchar out[OUT_LEN]) const
+    {
+        quint32 v[16];
+        compress(cv, block, blockLen, 0, flags | ROOT, v);
+        storeCv(out, v);
+    }
+};
+
+void chunkReset(Hasher::ChunkState &chunk, quint64 counter)
+{
+    std::memcpy(chunk.cv, IV, sizeof(IV));
+    chunk.counter = counter;
+    std::memset(chunk.buffer, 0, sizeof(chunk.buffer));
+    chunk.bufferLen = 0;
+    chunk.blocksCompressed = 0;
+}
+
+inline int chunkLen(const Hasher::ChunkState &chunk)
+{
+    return BLOCK_LEN * chunk.blocksCompressed + chunk.bufferLen;
+}
+
+inline quint8 chunkStartFlag(const Hasher::ChunkState &chunk)
+{
+    return chunk.blocksCompressed == 0 ? CHUNK_START : 0;
+}
+
+void chunkUpdate(Hasher::ChunkState &chunk, const uchar *p, size_t len)
+{
+    if (chunk.bufferLen > 0) {
+        const size_t take = qMin(len, size_t(BLOCK_LEN - chunk.bufferLen));
+        std::memcpy(chunk.buffer + chunk.bufferLen, p, take);
+        chunk.bufferLen += int(take);
+        p += take;
+        len -= take;
+        if (len == 0)
+            return;
+        // More follows, so the buffered block is not the chunk's last
+        compressInPlace(chunk.cv, chunk.buffer, BLOCK_LEN, chunk.counter, chunkStartFlag(chunk));
+        ++chunk.blocksCompressed;
+        chunk.bufferLen = 0;
+        std::memset(chunk.buffer, 0, sizeof(chunk.buffer));
+    }
+    while (len > size_t(BLOCK_LEN)) {
+        compressInPlace(chunk.cv, p, BLOCK_LEN, chunk.counter, chunkStartFlag(chunk));
+        ++chunk.blocksCompressed;
+        p += BLOCK_LEN;
+        len -= BLOCK_LEN;
+    }
+    std::memcpy(chunk.buffer, p, len);
+    chunk.bufferLen = int(len);
+}
+
+Output chunkOutput(const Hasher::ChunkState &chunk)
+{
+    Output o;
+    std::memcpy(o.cv, chunk.cv, sizeof(o.cv));
+    std::memcpy(o.block, chunk.buffer, BLOCK_LEN);
+    o.blockLen = chunk.bufferLen;
+    o.counter = chunk.counter;
+    o.flags = chunkStartFlag(chunk) | CHUNK_END;
+    return o;
+}
+
+Output parentOutput(const uchar block[BLOCK_LEN])
+{
+    Output o;
+    std::memcpy(o.cv, IV, sizeof(o.cv));
+    std::memcpy(o.block, block, BLOCK_LEN);
+    o.blockLen = BLOCK_LEN;
+    o.counter = 0;
+    o.flags = PARENT;
+    return o;
+}
+
+/// Largest power-of-two number of whole chunks that leaves at least one byte on the right
+size_t leftSubtreeLen(size_t len)
+{
+    size_t chunks = (len - 1) / CHUNK_LEN;
+    size_t power = 1;
+    while (power * 2 <= chunks)
+        power *= 2;
+    return power * CHUNK_LEN;
+}
+
+/// Hashes up to degree() chunks in one SIMD call; returns the number of chaining values
+size_t compressChunks(const uchar *p, size_t len, quint64 counter, uchar *out)
+{
+    const uchar *inputs[MAX_SIMD_DEGREE];
+    size_t count = 0;
+    while (len - count * CHUNK_LEN >= size_t(CHUNK_LEN)) {
+        inputs[count] = p + count * CHUNK_LEN;
+        ++count;
+    }
+    hashMany(inputs, count, CHUNK_LEN / BLOCK_LEN, IV, counter, true, 0, CHUNK_START, CHUNK_END, out);
+
+    if (len > count * CHUNK_LEN) {
+        Hasher::ChunkState chunk;
+        chunkReset(chunk, counter + count);
+        chunkUpdate(chunk, p + count * CHUNK_LEN, len - count * CHUNK_LEN);
+        chunkOutput(chunk).chainingValue(out + count * OUT_LEN);
+        ++count;
+    }
+    return count;
+}
+
+/// Combines chaining values in pairs; an odd one out is passed through
+size_t compressParents(const uchar *cvs, size_t count, uchar *out)
+{
+    const uchar *inputs[MAX_SIMD_DEGREE];
+    const size_t pairs = count / 2;
+    for (size_t i = 0; i < pairs; ++i)
+        inputs[i] = cvs + 2 * i * OUT_LEN;
+    hashMany(inputs, pairs, 1, IV, 0, false, PARENT, 0, 0, out);
+    if (count & 1) {
+        std::memcpy(out + pairs * OUT_LEN, cvs + 2 * pairs * OUT_LEN, OUT_LEN);
+        return pairs + 1;
+    }
+    return pairs;
+}
+
+/**
+ * @brief Hashes a subtree of whole chunks (plus a partial last one) down to
+ *        at most degree() chaining values, or two when the degree is one.
+ *
+ * The left half is offered to the global thread pool when the subtree is
+ * large; the right half always runs on the calling thread.
+ */
+size_t compressSubtreeWide(const uchar *p, size_t len, quint64 counter, uchar *out)
+{
+    const size_t degree = size_t(kernel().degree);
+    if (len <= degree * CHUNK_LEN)
+        return compressChunks(p, len, counter, out);
+
+    const size_t leftLen = leftSubtreeLen(len);
+    const size_t rightLen = len - leftLen;
+    const quint64 rightCounter = counter + leftLen / CHUNK_LEN;
+
+    // The right half's outputs follow the most the left half can return:
+    // degree() values, or two with degree one unless it is a single chunk
+    uchar cvs[2 * MAX_SIMD_DEGREE * OUT_LEN];
+    const size_t leftMax = (degree == 1 && leftLen > size_t(CHUNK_LEN)) ? 2 : degree;
+    uchar *rightCvs = cvs + leftMax * OUT_LEN;
+
+    size_t leftCount = 0;
+    QSemaphore leftDone;
+    bool offloaded = false;
+    if (len >= size_t(Blake3::PARALLEL_MIN_LEN)) {
+        offloaded = QThreadPool::globalInstance()->tryStart([&]() {
+            leftCount = compressSubtreeWide(p, leftLen, counter, cvs);
+            leftDone.release();
+        });
+    }
+    if (!offloaded)
+        leftCount = compressSubtreeWide(p, leftLen, counter, cvs);
+    const size_t rightCount = compressSubtreeWide(p + leftLen, rightLen, rightCounter, rightCvs);
+    if (offloaded)
+        leftDone.acquire();
+
+    // Only when the degree is one: both halves were single chunks
+    if (leftCount == 1) {
+        std::memcpy(out, cvs, 2 * OUT_LEN);
+        return 2;
+    }
+    return compressParents(cvs, leftCount + rightCount, out);
+}
+
+/// Hashes a subtree of at least two chunks down to the block of its root parent
+void compressSubtreeToParent(const uchar *p, size_t len, quint64 counter, uchar out[2 * OUT_LEN])
+{
+    uchar cvs[2 * MAX_SIMD_DEGREE * OUT_LEN];
+    size_t count = compressSubtreeWide(p, len, counter, cvs);
+    while (count > 2) {
+        uchar next[MAX_SIMD_DEGREE * OUT_LEN];
+        count = compressParents(cvs, count, next);
+        std::memcpy(cvs, next, count * OUT_LEN);
+    }
+    std::memcpy(out, cvs, 2 * OUT_LEN);
+}
+
+} // namespace
+
+void Blake3::Hasher::reset()
+{
+    chunkReset(m_chunk, 0);
+    m_cvStackLen = 0;
+}
+
+/**
+ * @brief Merges finished subtrees so the stack holds one entry per set bit
+ *        of @p totalChunks.
+ *
+ * Merging is lazy: a subtree is only combined once more input proves it is
+ * not the root.
+ */
+void Blake3::Hasher::mergeCvStack(quint64 totalChunks)
+{
+    const int target = qPopulationCount(totalChunks);
+    while (m_cvStackLen > target) {
+        uchar *parent = m_cvStack + (m_cvStackLen - 2) * OUT_LEN;
+        parentOutput(parent).chainingValue(parent);
+        --m_cvStackLen;
+    }
+}
+
+void Blake3::Hasher::pushCv(const uchar cv[OUT_LEN], quint64 chunkCounter)
+{
+    mergeCvStack(chunkCounter);
+    std::memcpy(m_cvStack + m_cvStackLen * OUT_LEN, cv, OUT_LEN);
+    ++m_cvStackLen;
+}
+
+void Blake3::Hasher::update(const void *data, qsizetype len)
+{
+    if (len <= 0)
+        return;
+    const uchar *p = static_cast<const uchar *>(data);
+    size_t n = size_t(len);
+
+    // Finish the partial chunk first
+    if (chunkLen(m_chunk) > 0) {
+        const size_t take = qMin(n, size_t(CHUNK_LEN - chunkLen(m_chunk)));
+        chunkUpdate(m_chunk, p, take);
+        p += take;
+        n -= take;
+        if (n == 0)
+            return;
+        uchar cv[OUT_LEN];
+        chunkOutput(m_chunk).chainingValue(cv);
+        pushCv(cv, m_chunk.counter);
+        chunkReset(m_chunk, m_chunk.counter + 1);
+    }
+
+    // Whole subtrees, as large as the input and the alignment allow. The
+    // last chunk is kept back so finalize() can mark it as the root.
+    while (n > size_t(CHUNK_LEN)) {
+        size_t subtreeLen = size_t(1) << (63 - qCountLeadingZeroBits(quint64(n)));
+        const quint64 doneBytes = m_chunk.counter * CHUNK_LEN;
+        while ((quint64(subtreeLen) - 1) & doneBytes)
+            subtreeLen /= 2;
+        const quint64 subtreeChunks = subtreeLen / CHUNK_LEN;
+
+        if (subtreeLen <= size_t(CHUNK_LEN)) {
+            ChunkState chunk;
+            chunkReset(chunk, m_chunk.counter);
+            chunkUpdate(chunk, p, subtreeLen);
+            uchar cv[OUT_LEN];
+            chunkOutput(chunk).chainingValue(cv);
+            pushCv(cv, chunk.counter);
+        } else {
+            uchar pair[2 * OUT_LEN];
+            compressSubtreeToParent(p, subtreeLen, m_chunk.counter, pair);
+            pushCv(pair, m_chunk.counter);
+            pushCv(pair + OUT_LEN, m_chunk.counter + subtreeChunks / 2);
+        }
+        m_chunk.counter += subtreeChunks;
+        p += subtreeLen;
+        n -= subtreeLen;
+    }
+
+    if (n > 0) {
+        chunkUpdate(m_chunk, p, n);
+        mergeCvStack(m_chunk.counter);
+    }
+}
+
+void Blake3::Hasher::finalize(uchar out[OUT_LEN]) const
+{
+    if (m_cvStackLen == 0) {
+        chunkOutput(m_chunk).rootBytes(out);
+        return;
+    }
+
+    Output output;
+    int remaining;
+    if (chunkLen(m_chunk) > 0) {
+        remaining = m_cvStackLen;
+        output = chunkOutput(m_chunk);
+    } else {
+        remaining = m_cvStackLen - 2;
+        output = parentOutput(m_cvStack + remaining * OUT_LEN);
+    }
+    while (remaining > 0) {
+        --remaining;
+        uchar block[BLOCK_LEN];
+        std::memcpy(block, m_cvStack + remaining * OUT_LEN, OUT_LEN);
+        output.chainingValue(block + OUT_LEN);
+        output = parentOutput(block);
+    }
+    output.rootBytes(out);
+}
+
+void Blake3::hash(const void *data, qsizetype len, uchar out[OUT_LEN])
+{
+    Hasher hasher;
+    hasher.update(data, len);
+    hasher.finalize(out);
+}
+
+const char *Blake3::implementation()
+{
+    return kernel().name;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file Blake3.h
+ * @brief BLAKE3 hashing with SIMD kernels and multithreaded subtrees.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * BLAKE3 splits its input into 1 KiB chunks that are hashed independently
+ * and combined as a binary tree, so the work parallelises two ways:
+ *  - on x86 the compression function runs on 8 chunks at once with AVX2
+ *    or 4 with SSE4.1, picked at first use from CPUID;
+ *  - an update() of at least PARALLEL_MIN_LEN bytes splits its subtree in
+ *    halves that run on QThreadPool::globalInstance(). A half only goes to
+ *    the pool if a thread is free right now, otherwise the caller hashes
+ *    it, so nested use from other pools cannot deadlock.
+ *
+ * Results match the reference implementation (`b3sum`), default 32-byte
+ * output, unkeyed.
+ */
+
+#ifndef BLAKE3_H
+#define BLAKE3_H
+
+#include <QtGlobal>
+
+namespace Blake3 {
+
+const int OUT_LEN = 32;
+const int BLOCK_LEN = 64;
+const int CHUNK_LEN = 1024;
+
+/// Updates at least this long are hashed on several threads
+const qsizetype PARALLEL_MIN_LEN = 512 * 1024;
+
+/**
+ * @brief Incremental hasher. Feed data in pieces of any size; large pieces
+ *        are what make the SIMD and thread paths pay off.
+ */
+class Hasher
+{
+public:
+    Hasher() { reset(); }
+
+    void reset();
+    void update(const void *data, qsizetype len);
+
+    /// Digest of everything added since reset(); the hasher can keep going
+    void finalize(uchar out[OUT_LEN]) const;
+
+    /// Chunk being filled: chaining value, partial block and position
+    struct ChunkState {
+        quint32 cv[8];
+        quint64 counter = 0;
+        uchar buffer[BLOCK_LEN];
+        int bufferLen = 0;
+        int blocksCompressed = 0;
+    };
+
+private:
+    static const int MAX_DEPTH = 54;    // 2^54 chunks of 1 KiB cover 2^64 bytes
+
+    ChunkState m_chunk;
+    uchar m_cvStack[(MAX_DEPTH + 1) * OUT_LEN];
+    int m_cvStackLen = 0;
+
+    void mergeCvStack(quint64 totalChunks);
+    void pushCv(const uchar cv[OUT_LEN], quint64 chunkCounter);
+};
+
+/// One-shot BLAKE3 of @p len bytes
+void hash(const void *data, qsizetype len, uchar out[OUT_LEN]);
+
+/**
+ * @brief Names the compression kernel in use: "AVX2", "SSE4.1" or "portable".
+ */
+const char *implementation();
+
+} // namespace Blake3
+
+#endif // BLAKE3_H
@@ -0,0 +1,424 @@
+/**
+ * @file CaptureFile.cpp
+ * @brief Implementation of the memory-mapped capture file reader.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "CaptureFile.h"
+
+#include <QMutexLocker>
+#include <QtEndian>
+
+#include <cstring>
+
+static const quint32 PCAPNG_SHB = 0x0A0D0D0A;
+static const quint32 PCAPNG_IDB = 0x00000001;
+static const quint32 PCAPNG_OPB = 0x00000002; // obsolete Packet Block
+static const quint32 PCAPNG_SPB = 0x00000003;
+static const quint32 PCAPNG_EPB = 0x00000006;
+static const quint16 LINKTYPE_USER0 = 147;   // Traffic Monitor pcap export
+
+static inline qint64 pad4(qint64 len)
+{
+    return (len + 3) & ~qint64(3);
+}
+
+CaptureFile::CaptureFile()
+{
+}
+
+CaptureFile::~CaptureFile()
+{
+    close();
+}
+
+bool CaptureFile::open(const QString &path)
+{
+    close();
+    m_file.setFileName(path);
+
+    if (!m_file.open(QIODevice::ReadOnly)) {
+        m_error = m_file.errorString();
+        return false;
+    }
+
+    m_size = m_file.size();
+    if (m_size < 4) {
+        m_error = "File is empty or too small to be a capture.";
+        close();
+        return false;
+    }
+
+    m_data = m_file.map(0, m_size);
+    if (!m_data) {
+        m_error = "Could not memory-map the file: " + m_file.errorString();
+        close();
+        return false;
+    }
+
+    const quint32 magic = qFromLittleEndian<quint32>(m_data);
+    m_firstRecord = 0;
+
+    if (magic == 0xA1B2C3D4 || magic == 0xD4C3B2A1 || magic == 0xA1B23C4D || magic == 0x4D3CB2A1) {
+        if (m_size < 24) {
+            m_error = "Truncated pcap header.";
+            close();
+            return false;
+        }
+        m_format = Pcap;
+        m_bigEndian = (magic == 0xD4C3B2A1 || magic == 0x4D3CB2A1);
+        m_pcapUnitsPerSecond = (magic == 0xA1B23C4D || magic == 0x4D3CB2A1) ? 1000000000 : 1000000;
+        m_linkType = rd32(m_data + 20) & 0x0FFFFFFF;
+        m_firstRecord = 24;
+    } else if (magic == PCAPNG_SHB) {
+        if (m_size < 12) {
+            m_error = "Truncated pcapng section header.";
+            close();
+            return false;
+        }
+        // Byte order of the (first) section decides how every block is read
+        m_format = Pcapng;
+        m_bigEndian = (qFromLittleEndian<quint32>(m_data + 8) != 0x1A2B3C4D);
+    } else if (m_data[0] == 0x1F && m_data[1] == 0x8B) {
+        m_error = "Compressed captures (.gz) must be decompressed before opening.";
+        close();
+        return false;
+    } else {
+        qint64 i = 0;
+        while (i < m_size && i < 64 && (m_data[i] == ' ' || m_data[i] == '\r' || m_data[i] == '\n'))
+            ++i;
+        if (i >= m_size || (m_data[i] != '[' && m_data[i] != '<')) {
+            m_error = "Unrecognised file format (expected pcap, pcapng or a PacketForge log).";
+            close();
+            return false;
+        }
+        m_format = NativeText;
+    }
+
+    return true;
+}
+
+void CaptureFile::close()
+{
+    if (m_data)
+        m_file.unmap(const_cast<uchar *>(m_data));
+    m_data = nullptr;
+    if (m_file.isOpen())
+        m_file.close();
+
+    m_size = 0;
+    m_format = Unknown;
+    m_firstRecord = 0;
+    QMutexLocker lock(&m_ifaceMutex);
+    m_interfaces.clear();
+    m_lastInterfaceOffset = -1;
+}
+
+QStringList CaptureFile::interfaceNames() const
+{
+    QMutexLocker lock(&m_ifaceMutex);
+    QStringList names;
+    for (const Interface &iface : m_interfaces)
+        names << iface.name;
+    return names;
+}
+
+quint16 CaptureFile::rd16(const uchar *p) const
+{
+    return m_bigEndian ? qFromBigEndian<quint16>(p) : qFromLittleEndian<quint16>(p);
+}
+
+quint32 CaptureFile::rd32(const uchar *p) const
+{
+    return m_bigEndian ? qFromBigEndian<quint32>(p) : qFromLittleEndian<quint32>(p);
+}
+
+qint64 CaptureFile::toNanoseconds(quint64 ticks, quint64 unitsPerSecond) const
+{
+    if (unitsPerSecond == 1000000000)
+        return static_cast<qint64>(ticks);
+    if (1000000000 % unitsPerSecond == 0)
+        return static_cast<qint64>(ticks * (1000000000 / unitsPerSecond));
+
+    const quint64 seconds = ticks / unitsPerSecond;
+    const quint64 rest = ticks % unitsPerSecond;
+    return static_cast<qint64>(seconds * 1000000000
+                               + static_cast<quint64>(static_cast<long double>(rest) * 1e9L / unitsPerSecond));
+}
+
+bool CaptureFile::readFrame(qint64 &offset, Frame &frame, bool withData) const
+{
+    if (!m_data)
+        return false;
+    if (offset < m_firstRecord)
+        offset = m_firstRecord;
+
+    while (offset < m_size) {
+        bool isPacket = false;
+        switch (m_format) {
+        case Pcap:
+            return readPcapRecord(offset, frame, withData);
+        case Pcapng:
+            if (!readPcapngBlock(offset, frame, withData, isPacket))
+                return false;
+            break;
+        case NativeText:
+            if (!readTextLine(offset, frame, withData, isPacket))
+                return false;
+            break;
+        default:
+            return false;
+        }
+        if (isPacket)
+            return true;
+    }
+    return false;
+}
+
+// --- pcap ---
+
+bool CaptureFile::readPcapRecord(qint64 &offset, Frame &frame, bool withData) const
+{
+    if (offset + 16 > m_size)
+        return false;
+
+    const uchar *p = m_data + offset;
+    const quint32 inclLen = rd32(p + 8);
+    if (offset + 16 + qint64(inclLen) > m_size)
+        return false; // truncated (file still being written?)
+
+    frame.offset = offset;
+    frame.interfaceId = 0;
+    frame.timestampNs = qint64(rd32(p)) * 1000000000
+                        + toNanoseconds(rd32(p + 4), m_pcapUnitsPerSecond);
+
+    const uchar *payload = p + 16;
+    qint64 len = inclLen;
+    frame.hasDirection = false;
+    frame.isTx = false;
+
+    // The Traffic Monitor export prefixes USER0 payloads with 0x00 (RX) / 0x01 (TX)
+    if (m_linkType == LINKTYPE_USER0 && len >= 1 && payload[0] <= 1) {
+        frame.hasDirection = true;
+        frame.isTx = (payload[0] == 1);
+        ++payload;
+        --len;
+    }
+
+    frame.data = withData ? QByteArray(reinterpret_cast<const char *>(payload), len) : QByteArray();
+    offset += 16 + inclLen;
+    return true;
+}
+
+// --- pcapng ---
+
+void CaptureFile::parseInterfaceBlock(qint64 blockOffset, const uchar *body, qint64 bodyLen) const
+{
+    Interface iface;
+    QMutexLocker lock(&m_ifaceMutex);
+
+    // Re-reading a known block (random access, second pass) must not add it twice
+    if (blockOffset <= m_lastInterfaceOffset)
+        return;
+    m_lastInterfaceOffset = blockOffset;
+
+    iface.name = QString("if%1").arg(m_interfaces.size());
+
+    // linktype(2) reserved(2) snaplen(4), then options
+    qint64 pos = 8;
+    while (pos + 4 <= bodyLen) {
+        const quint16 code = rd16(body + pos);
+        const quint16 len = rd16(body + pos + 2);
+        if (code == 0 || pos + 4 + len > bodyLen)
+            break;
+        const uchar *value = body + pos + 4;
+
+        if (code == 2) { // if_name
+            iface.name = QString::fromUtf8(reinterpret_cast<const char *>(value), len);
+        } else if (code == 9 && len >= 1) { // if_tsresol
+            const int exp = value[0] & 0x7F;
+            quint64 units = 1;
+            for (int i = 0; i < exp && units < (quint64(1) << 62); ++i)
+                units *= (value[0] & 0x80) ? 2 : 10;
+            iface.unitsPerSecond = units;
+        }
+        pos += 4 + pad4(len);
+    }
+
+    m_interfaces.append(iface);
+}
+
+bool CaptureFile::readPcapngBlock(qint64 &offset, Frame &frame, bool withData, bool &isPacket) const
+{
+    isPacket = false;
+    if (offset + 12 > m_size)
+        return false;
+
+    const uchar *b = m_data + offset;
+    const quint32 type = rd32(b);
+    const quint32 blockLen = rd32(b + 4);
+    if (blockLen < 12 || (blockLen & 3) || offset + blockLen > m_size)
+        return false;
+
+    const uchar *body = b + 8;
+    const qint64 bodyLen = blockLen - 12;
+    frame.offset = offset;
+    offset += blockLen;
+
+    if (type == PCAPNG_IDB) {
+        parseInterfaceBlock(frame.offset, body, bodyLen);
+        return true;
+    }
+
+    if (type == PCAPNG_SPB) {
+        if (bodyLen < 4)
+            return true;
+        const qint64 len = qMin<qint64>(rd32(body), bodyLen - 4);
+        frame.interfaceId = 0;
+        frame.timestampNs = 0;
+        frame.hasDirection = false;
+        frame.isTx = false;
+        frame.data = withData ? QByteArray(reinterpret_cast<const char *>(body + 4), len) : QByteArray();
+        isPacket = true;
+        return true;
+    }
+
+    if (type != PCAPNG_EPB && type != PCAPNG_OPB)
+        return true; // SHB, statistics, name resolution... nothing to show
+
+    if (bodyLen < 20)
+        return true;
+
+    const int iface = (type == PCAPNG_EPB) ? int(rd32(body)) : int(rd16(body));
+    const quint64 ticks = (quint64(rd32(body + 4)) << 32) | rd32(body + 8);
+    const qint64 capLen = rd32(body + 12);
+    if (20 + capLen > bodyLen)
+        return true;
+
+    quint64 units = 1000000;
+    {
+        QMutexLocker lock(&m_ifaceMutex);
+        if (iface < m_interfaces.size())
+            units = m_interfaces.at(iface).unitsPerSecond;
+    }
+
+    frame.interfaceId = iface;
+    frame.timestampNs = toNanoseconds(ticks, units);
+    frame.hasDirection = false;
+    frame.isTx = false;
+
+    // epb_flags / pack_flags (code 2): bits 0-1 = 1 inbound, 2 outbound
+    qint64 pos = 20 + pad4(capLen);
+    while (pos + 4 <= bodyLen) {
+        const quint16 code = rd16(body + pos);
+        const quint16 len = rd16(body + pos + 2);
+        if (code == 0 || pos + 4 + len > bodyLen)
+            break;
+        if (code == 2 && len == 4) {
+            const quint32 dir = rd32(body + pos + 4) & 0x3;
+            frame.hasDirection = (dir != 0);
+            frame.isTx = (dir == 2);
+        }
+        pos += 4 + pad4(len);
+    }
+
+    frame.data = withData ? QByteArray(reinterpret_cast<const char *>(body + 20), capLen) : QByteArray();
+    isPacket = true;
+    return true;
+}
+
+// --- Native text / HTML log ---
+
+static inline int hexValue(uchar c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+static inline bool isDigit(uchar c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * @brief Parses one log line, e.g.
+ *   "[12:00:00.123] [TX] 0A 1B  (...)"  or the HTML variant
+ *   "<pre><span class="time">[12:00:00.123]</span> <span class="tx">[TX]</span> <span class="hex">0A 1B</span>  (...)</pre>"
+ */
+bool CaptureFile::readTextLine(qint64 &offset, Frame &frame, bool withData, bool &isPacket) const
+{
+    isPacket = false;
+    const uchar *line = m_data + offset;
+    const uchar *nl = static_cast<const uchar *>(std::memchr(line, '\n', m_size - offset));
+    const qint64 len = nl ? (nl - line) : (m_size - offset);
+
+    frame.offset = offset;
+    offset += len + (nl ? 1 : 0);
+
+    // Time: "[HH:mm:ss.zzz]"
+    const uchar *end = line + len;
+    const uchar *p = static_cast<const uchar *>(std::memchr(line, '[', len));
+    if (!p || end - p < 14)
+        return true;
+    const uchar *t = p + 1;
+    if (!(isDigit(t[0]) && isDigit(t[1]) && t[2] == ':' && isDigit(t[3]) && isDigit(t[4]) && t[5] == ':'
+          && isDigit(t[6]) && isDigit(t[7]) && t[8] == '.' && isDigit(t[9]) && isDigit(t[10])
+          && isDigit(t[11]) && t[12] == ']'))
+        return true;
+
+    const qint64 ms = (((t[0] - '0') * 10 + (t[1] - '0')) * 3600
+                       + ((t[3] - '0') * 10 + (t[4] - '0')) * 60
+                       + ((t[6] - '0') * 10 + (t[7] - '0'))) * qint64(1000)
+                      + (t[9] - '0') * 100 + (t[10] - '0') * 10 + (t[11] - '0');
+
+    // Direction: first "[TX]" / "[RX]" after the time
+    p = t + 13;
+    while (p + 4 <= end && !(p[0] == '[' && (p[1] == 'T' || p[1] == 'R') && p[2] == 'X' && p[3] == ']'))
+        ++p;
+    if (p + 4 > end)
+        return true;
+
+    frame.timestampNs = ms * 1000000;
+    frame.interfaceId = 0;
+    frame.hasDirection = true;
+    frame.isTx = (p[1] == 'T');
+    isPacket = true;
+
+    if (!withData) {
+        frame.data = QByteArray();
+        return true;
+    }
+
+    // Hex: after "] " (text) or "]</span> <span class=\"hex\">" (HTML)
+    p += 4;
+    static const char htmlHex[] = "</span> <span class=\"hex\">";
+    const qint64 htmlLen = sizeof(htmlHex) - 1;
+    if (end - p >= htmlLen && std::memcmp(p, htmlHex, htmlLen) == 0)
+        p += htmlLen;
+    else if (p < end && *p == ' ')
+        ++p;
+
+    QByteArray data;
+    data.reserve((end - p) / 3 + 1);
+    while (p + 2 <= end) {
+        const int hi = hexValue(p[0]);
+        const int lo = hexValue(p[1]);
+        if (hi < 0 || lo < 0)
+            break;
+        data.append(char((hi << 4) | lo));
+        p += 2;
+        // A single space separates bytes; two spaces start the ASCII column
+        if (p + 1 < end && p[0] == ' ' && hexValue(p[1]) >= 0)
+            ++p;
+        else
+            break;
+    }
+    frame.data = data;
+    return true;
+}
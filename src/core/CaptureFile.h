@@ -0,0 +1,121 @@
+/**
+ * @file CaptureFile.h
+ * @brief Memory-mapped reader for pcap, pcapng and native PacketForge logs.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * The file is mapped, never read into memory, so opening is O(1) in the
+ * file size and any frame can be decoded given its byte offset. Supported:
+ *  - classic pcap (us / ns, either byte order). For LINKTYPE_USER0 files
+ *    written by the Traffic Monitor the leading direction byte is decoded.
+ *  - pcapng (SHB/IDB/EPB/SPB, if_tsresol, epb_flags direction). The byte
+ *    order of the first section applies to the whole file.
+ *  - "Log to File" text and HTML logs. These only carry a time of day, so
+ *    their timestamps are nanoseconds since local midnight.
+ * Compressed (.gz) files must be decompressed first.
+ *
+ * readFrame() is safe to call from several threads at once.
+ */
+
+#ifndef CAPTUREFILE_H
+#define CAPTUREFILE_H
+
+#include <QByteArray>
+#include <QFile>
+#include <QMutex>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+class CaptureFile
+{
+public:
+    enum Format {
+        Unknown,
+        Pcap,
+        Pcapng,
+        NativeText
+    };
+
+    struct Frame {
+        qint64 offset = 0;          ///< Byte offset of the record in the file
+        qint64 timestampNs = 0;     ///< ns since epoch (native text: since midnight)
+        QByteArray data;            ///< Payload (empty if read without data)
+        int interfaceId = 0;
+        bool isTx = false;
+        bool hasDirection = false;  ///< false if the format did not record it
+    };
+
+    CaptureFile();
+    ~CaptureFile();
+
+    /**
+     * @brief Maps the file and detects its format.
+     * @return false on error; see errorString().
+     */
+    bool open(const QString &path);
+    void close();
+
+    bool isOpen() const { return m_data != nullptr; }
+    QString errorString() const { return m_error; }
+    QString fileName() const { return m_file.fileName(); }
+    Format format() const { return m_format; }
+    qint64 size() const { return m_size; }
+
+    /**
+     * @brief Offset of the first record after the file header.
+     */
+    qint64 firstRecordOffset() const { return m_firstRecord; }
+
+    /**
+     * @brief Decodes the next frame at or after @p offset.
+     * @param offset In: where to start. Out: offset of the following record.
+     * @param frame Receives the frame (frame.offset is where it started)
+     * @param withData false to skip copying/decoding the payload (indexing)
+     * @return false at the end of the file or on a truncated record.
+     */
+    bool readFrame(qint64 &offset, Frame &frame, bool withData = true) const;
+
+    /**
+     * @brief Interface names seen so far (pcapng), indexed by interface id.
+     */
+    QStringList interfaceNames() const;
+
+private:
+    struct Interface {
+        QString name;
+        quint64 unitsPerSecond = 1000000;
+    };
+
+    quint16 rd16(const uchar *p) const;
+    quint32 rd32(const uchar *p) const;
+    qint64 toNanoseconds(quint64 ticks, quint64 unitsPerSecond) const;
+
+    bool readPcapRecord(qint64 &offset, Frame &frame, bool withData) const;
+    bool readPcapngBlock(qint64 &offset, Frame &frame, bool withData, bool &isPacket) const;
+    bool readTextLine(qint64 &offset, Frame &frame, bool withData, bool &isPacket) const;
+    void parseInterfaceBlock(qint64 blockOffset, const uchar *body, qint64 bodyLen) const;
+
+    QFile m_file;
+    const uchar *m_data = nullptr;
+    qint64 m_size = 0;
+    Format m_format = Unknown;
+    QString m_error;
+    qint64 m_firstRecord = 0;
+
+    // pcap
+    bool m_bigEndian = false;
+    quint64 m_pcapUnitsPerSecond = 1000000;
+    quint32 m_linkType = 0;
+
+    // pcapng: discovered while reading, shared between reader threads
+    mutable QMutex m_ifaceMutex;
+    mutable QVector<Interface> m_interfaces;
+    mutable qint64 m_lastInterfaceOffset = -1;  ///< IDBs are registered once, in file order
+};
+
+#endif // CAPTUREFILE_H
@@ -0,0 +1,81 @@
+/**
+ * @file CaptureIndexer.cpp
+ * @brief Implementation of the background capture indexer.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "CaptureIndexer.h"
+#include "CaptureFile.h"
+
+#include <QElapsedTimer>
+
+// First batch goes out quickly so the view fills almost immediately
+static const int FIRST_BATCH_MS = 20;
+static const int BATCH_INTERVAL_MS = 100;
+
+CaptureIndexer::CaptureIndexer(QObject *parent) : QThread(parent)
+{
+}
+
+CaptureIndexer::~CaptureIndexer()
+{
+    stop();
+}
+
+void CaptureIndexer::startIndexing(const CaptureFile *file)
+{
+    stop();
+    m_file = file;
+    m_stop.store(false);
+    start(QThread::LowPriority);
+}
+
+void CaptureIndexer::stop()
+{
+    if (isRunning()) {
+        m_stop.store(true);
+        wait();
+    }
+}
+
+void CaptureIndexer::run()
+{
+    QVector<qint64> batch;
+    QElapsedTimer timer;
+    timer.start();
+    int nextBatchMs = FIRST_BATCH_MS;
+
+    qint64 frames = 0;
+    qint64 offset = 0;
+    bool completed = false;
+    CaptureFile::Frame frame;
+
+    for (;;) {
+        if (m_stop.load())
+            break;
+
+        // readFrame() moves offset past the record; frame.offset is where it began
+        if (!m_file->readFrame(offset, frame, false)) {
+            completed = true;
+            break;
+        }
+
+        if (frames % STRIDE == 0)
+            batch.append(frame.offset);
+        ++frames;
+
+        // Check the clock only every 256 frames
+        if ((frames & 255) == 0 && timer.elapsed() >= nextBatchMs) {
+            emit checkpointsFound(batch, frames, offset);
+            batch.clear();
+            nextBatchMs = int(timer.elapsed()) + BATCH_INTERVAL_MS;
+        }
+    }
+
+    emit checkpointsFound(batch, frames, completed ? m_file->size() : offset);
+    emit indexingFinished(completed);
+}
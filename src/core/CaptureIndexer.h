@@ -0,0 +1,74 @@
+/**
+ * @file CaptureIndexer.h
+ * @brief Background builder of a sparse frame-offset index for a CaptureFile.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * Walks the file once, headers only, and records the byte offset of every
+ * STRIDE-th frame. Frame N is then reached by seeking to checkpoint
+ * N / STRIDE and stepping over at most STRIDE - 1 records, so the index
+ * costs 8 bytes per STRIDE frames (about 40 MB for a billion frames).
+ *
+ * Checkpoints are delivered in batches through checkpointsFound() about
+ * ten times a second, so a viewer can show the first rows while the rest
+ * of a multi-gigabyte file is still being scanned.
+ */
+
+#ifndef CAPTUREINDEXER_H
+#define CAPTUREINDEXER_H
+
+#include <QThread>
+#include <QVector>
+
+#include <atomic>
+
+class CaptureFile;
+
+class CaptureIndexer : public QThread
+{
+    Q_OBJECT
+
+public:
+    static const int STRIDE = 256;     ///< Frames between two checkpoints
+
+    explicit CaptureIndexer(QObject *parent = nullptr);
+    ~CaptureIndexer() override;
+
+    /**
+     * @brief Starts indexing @p file. The file must stay open until stop().
+     */
+    void startIndexing(const CaptureFile *file);
+
+    /**
+     * @brief Cancels indexing and waits for the thread to finish.
+     */
+    void stop();
+
+signals:
+    /**
+     * @brief A batch of new checkpoints, in file order.
+     * @param offsets Byte offsets of frames STRIDE apart, continuing the previous batch
+     * @param frameCount Total frames indexed so far
+     * @param bytesScanned File position reached so far
+     */
+    void checkpointsFound(const QVector<qint64> &offsets, qint64 frameCount, qint64 bytesScanned);
+
+    /**
+     * @brief The scan is over.
+     * @param completed false if it was cancelled
+     */
+    void indexingFinished(bool completed);
+
+protected:
+    void run() override;
+
+private:
+    const CaptureFile *m_file = nullptr;
+    std::atomic<bool> m_stop{false};
+};
+
+#endif // CAPTUREINDEXER_H
@@ -0,0 +1,234 @@
+/**
+ * @file CaptureReplayer.cpp
+ * @brief Implementation of the capture replay scheduler.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "CaptureReplayer.h"
+
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#include <timeapi.h>
+#endif
+
+// Frames handed to the GUI thread but not yet sent
+static const int MAX_IN_FLIGHT = 64;
+
+// Sleep until this close to the due time, then spin. Covers the wake-up
+// latency of a 1 ms timer period (Windows with timeBeginPeriod, Linux).
+static const qint64 SPIN_WINDOW_NS = 2000000;
+
+// Longest single sleep, so stopReplay() is honoured during long gaps
+static const qint64 MAX_SLEEP_NS = 50000000;
+
+static const qint64 PROGRESS_INTERVAL_NS = 100000000;
+static const qint64 NS_PER_DAY = 86400LL * 1000000000LL;
+
+static inline qint64 monotonicNs()
+{
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+CaptureReplayer::CaptureReplayer(QObject *parent) : QThread(parent)
+{
+}
+
+CaptureReplayer::~CaptureReplayer()
+{
+    stopReplay();
+}
+
+bool CaptureReplayer::startReplay(const QString &path, const Options &options)
+{
+    stopReplay();
+
+    if (!m_file.open(path)) {
+        m_error = m_file.errorString();
+        return false;
+    }
+
+    m_options = options;
+    m_options.speed = qBound(0.1, m_options.speed, 100.0);
+    m_credits.acquire(m_credits.available());
+    m_credits.release(MAX_IN_FLIGHT);
+    m_driftCount.store(0);
+    m_driftSumNs.store(0);
+    m_driftMaxNs.store(0);
+    m_generation.fetch_add(1);
+    m_stop.store(false);
+
+    start(QThread::TimeCriticalPriority);
+    return true;
+}
+
+void CaptureReplayer::stopReplay()
+{
+    // Frames already queued to the receiver are now stale
+    m_generation.fetch_add(1);
+    if (isRunning()) {
+        m_stop.store(true);
+        wait();
+    }
+    m_file.close();
+}
+
+void CaptureReplayer::frameSent(qint64 targetNs)
+{
+    if (targetNs >= 0) {
+        const qint64 driftNs = qAbs(monotonicNs() - targetNs);
+        m_driftSumNs.fetch_add(driftNs);
+        // Single writer: the receiver's thread
+        if (driftNs > m_driftMaxNs.load())
+            m_driftMaxNs.store(driftNs);
+        m_driftCount.fetch_add(1);
+    }
+    m_credits.release();
+}
+
+bool CaptureReplayer::acquireCredit()
+{
+    while (!m_stop.load()) {
+        if (m_credits.tryAcquire(1, 20))
+            return true;
+    }
+    return false;
+}
+
+void CaptureReplayer::emitProgress(qint64 sent, qint64 offset)
+{
+    const qint64 measured = m_driftCount.load();
+    const double meanUs = measured ? m_driftSumNs.load() / 1000.0 / measured : 0.0;
+    emit progress(sent, offset, m_file.size(), meanUs, m_driftMaxNs.load() / 1000.0);
+}
+
+/**
+ * @brief Waits until the receiver has sent every frame handed to it, so the
+ *        final progress covers them all.
+ */
+void CaptureReplayer::waitForInFlight()
+{
+    while (!m_stop.load()) {
+        if (m_credits.tryAcquire(MAX_IN_FLIGHT, 20)) {
+            m_credits.release(MAX_IN_FLIGHT);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Sleeps, then spins, until the monotonic clock reaches @p targetNs.
+ * @return false if stopped while waiting.
+ */
+bool CaptureReplayer::waitUntil(qint64 targetNs)
+{
+    for (;;) {
+        if (m_stop.load())
+            return false;
+
+        const qint64 remaining = targetNs - monotonicNs();
+        if (remaining <= 0)
+            return true;
+
+        if (remaining > SPIN_WINDOW_NS) {
+            const qint64 sleepNs = qMin(remaining - SPIN_WINDOW_NS, MAX_SLEEP_NS);
+            std::this_thread::sleep_for(std::chrono::nanoseconds(sleepNs));
+        } else {
+            while (monotonicNs() < targetNs)
+                std::this_thread::yield();
+            return true;
+        }
+    }
+}
+
+void CaptureReplayer::run()
+{
+#ifdef Q_OS_WIN
+    timeBeginPeriod(1);
+#endif
+
+    const bool timed = (m_options.timing != MaxSpeed);
+    const double speed = (m_options.timing == ScaledTiming) ? m_options.speed : 1.0;
+    const int generation = m_generation.load();
+
+    CaptureFile::Frame frame;
+    qint64 offset = 0;
+    qint64 sent = 0;
+    qint64 firstTs = 0;
+    qint64 prevTs = 0;
+    qint64 dayCarry = 0;          // native text logs wrap at midnight
+    qint64 startNs = 0;
+    qint64 lastTarget = 0;
+    qint64 lastProgress = monotonicNs();
+    bool completed = false;
+
+    for (;;) {
+        if (m_stop.load())
+            break;
+        if (!m_file.readFrame(offset, frame)) {
+            completed = true;
+            break;
+        }
+
+        if (m_options.interfaceId >= 0 && frame.interfaceId != m_options.interfaceId)
+            continue;
+        if (m_options.direction != ReplayAll && frame.hasDirection
+            && frame.isTx != (m_options.direction == ReplayTx))
+            continue;
+        if (frame.data.isEmpty())
+            continue;
+
+        if (!acquireCredit())
+            break;
+
+        qint64 target = -1;
+        if (timed) {
+            qint64 ts = frame.timestampNs + dayCarry;
+            if (sent > 0 && prevTs - ts > NS_PER_DAY / 2) {
+                dayCarry += NS_PER_DAY;
+                ts += NS_PER_DAY;
+            }
+            prevTs = ts;
+
+            if (sent == 0) {
+                firstTs = ts;
+                startNs = monotonicNs();
+            }
+
+            // Out-of-order timestamps are sent immediately, never "in the past"
+            target = startNs + static_cast<qint64>(std::llround((ts - firstTs) / speed));
+            target = qMax(target, lastTarget);
+            lastTarget = target;
+
+            if (!waitUntil(target))
+                break;
+        }
+
+        emit frameDue(frame.data, generation, target);
+        ++sent;
+
+        const qint64 now = monotonicNs();
+        if (now - lastProgress >= PROGRESS_INTERVAL_NS) {
+            lastProgress = now;
+            emitProgress(sent, offset);
+        }
+    }
+
+    if (completed)
+        waitForInFlight();
+    emitProgress(sent, completed ? m_file.size() : offset);
+    emit replayFinished(completed);
+
+#ifdef Q_OS_WIN
+    timeEndPeriod(1);
+#endif
+}
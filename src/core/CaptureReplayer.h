@@ -0,0 +1,135 @@
+/**
+ * @file CaptureReplayer.h
+ * @brief Re-transmits a saved capture with original, scaled or maximum speed timing.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * Frames are read sequentially from a memory-mapped CaptureFile on a
+ * dedicated high-priority thread. Each frame is scheduled against a
+ * monotonic clock: the thread sleeps until shortly before the due time and
+ * spins for the remainder, so emission lands within a few microseconds of
+ * the target independently of OS timer granularity.
+ *
+ * Frames are handed to the owning tab through frameDue(); the receiver
+ * sends them and calls frameSent() for each one. This bounds the number of
+ * frames in flight, so "max speed" cannot flood the GUI event queue, and
+ * the drift reported with the progress (send time minus target) includes
+ * the event loop latency between the two threads. Every replay has its own
+ * generation: frames still queued when a replay is stopped carry an old
+ * one and must be dropped, see isCurrent().
+ */
+
+#ifndef CAPTUREREPLAYER_H
+#define CAPTUREREPLAYER_H
+
+#include <QThread>
+#include <QByteArray>
+#include <QSemaphore>
+
+#include <atomic>
+
+#include "CaptureFile.h"
+
+class CaptureReplayer : public QThread
+{
+    Q_OBJECT
+
+public:
+    enum Timing {
+        OriginalTiming,     ///< Reproduce recorded inter-frame gaps
+        ScaledTiming,       ///< Gaps divided by Options::speed
+        MaxSpeed            ///< No waiting between frames
+    };
+
+    enum DirectionFilter {
+        ReplayTx,           ///< Frames we originally sent
+        ReplayRx,           ///< Frames the device sent (simulate the device)
+        ReplayAll
+    };
+
+    struct Options {
+        Timing timing = OriginalTiming;
+        double speed = 1.0;         ///< 0.1 .. 100 for ScaledTiming
+        DirectionFilter direction = ReplayTx;
+        int interfaceId = -1;       ///< pcapng interface to replay, -1 = all
+    };
+
+    explicit CaptureReplayer(QObject *parent = nullptr);
+    ~CaptureReplayer() override;
+
+    /**
+     * @brief Opens @p path and starts replaying on the replay thread.
+     * @return false if the file could not be opened; see errorString().
+     */
+    bool startReplay(const QString &path, const Options &options);
+
+    /**
+     * @brief Stops the replay and waits for the thread to finish.
+     */
+    void stopReplay();
+
+    QString errorString() const { return m_error; }
+
+    /**
+     * @brief Whether a frameDue() of @p generation belongs to the running replay.
+     */
+    bool isCurrent(int generation) const { return generation == m_generation.load(); }
+
+    /**
+     * @brief Records the send time of a frameDue() and returns its in-flight credit.
+     *
+     * Only call for frames of the current generation; stale ones are simply dropped.
+     * @param targetNs The target passed with frameDue(), -1 for untimed frames
+     */
+    void frameSent(qint64 targetNs);
+
+signals:
+    /**
+     * @brief A frame reached its scheduled time and should be sent now.
+     * @param generation Replay the frame belongs to, see isCurrent()
+     * @param targetNs Scheduled send time on the replay clock, -1 at max speed
+     */
+    void frameDue(const QByteArray &data, int generation, qint64 targetNs);
+
+    /**
+     * @brief Periodic progress (about 10 per second) and once at the end.
+     * @param meanDriftUs Mean absolute scheduling error so far
+     * @param maxDriftUs Worst scheduling error so far
+     */
+    void progress(qint64 framesSent, qint64 bytesRead, qint64 totalBytes,
+                  double meanDriftUs, double maxDriftUs);
+
+    /**
+     * @brief The replay ended.
+     * @param completed true if the end of the file was reached, false if stopped.
+     */
+    void replayFinished(bool completed);
+
+protected:
+    void run() override;
+
+private:
+    bool waitUntil(qint64 targetNs);
+    bool acquireCredit();
+    void waitForInFlight();
+    void emitProgress(qint64 sent, qint64 offset);
+
+    CaptureFile m_file;
+    Options m_options;
+    QString m_error;
+
+    QSemaphore m_credits;
+    std::atomic<bool> m_stop{false};
+    std::atomic<int> m_generation{0};
+
+    // Written by frameSent() on the receiver's thread, read for progress()
+    std::atomic<qint64> m_driftCount{0};
+    std::atomic<qint64> m_driftSumNs{0};
+    std::atomic<qint64> m_driftMaxNs{0};
+};
+
+#endif // CAPTUREREPLAYER_H
@@ -0,0 +1,65 @@
+/**
+ * @file Checksum.cpp
+ * @brief Implementation of the shared frame checksums.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "Checksum.h"
+#include "CrcModel.h"
+
+QStringList Checksum::algorithms()
+{
+    return QStringList{"CRC16", "CRC32", "XOR", "LRC", "SUM8"} + Crc::modelNames();
+}
+
+QByteArray Checksum::calculate(const QByteArray &data, const QString &algorithm)
+{
+    if (data.isEmpty())
+        return QByteArray();
+
+    if (algorithm.startsWith("CRC-")) {
+        const Crc::Model *model = Crc::findModel(algorithm);
+        if (!model)
+            return QByteArray();
+        const Crc::Engine engine(*model);
+        return engine.toBytes(engine.compute(data.constData(), data.size()));
+    }
+
+    if (algorithm == "XOR") {
+        // Simple XOR of all bytes
+        unsigned char xorResult = 0;
+        for (char c : data) {
+            xorResult ^= static_cast<unsigned char>(c);
+        }
+        return QByteArray(1, xorResult);
+    } else if (algorithm == "SUM8") {
+        // Sum of all bytes (mod 256)
+        unsigned char sum = 0;
+        for (char c : data) {
+            sum += static_cast<unsigned char>(c);
+        }
+        return QByteArray(1, sum);
+    } else if (algorithm == "LRC") {
+        // Longitudinal Redundancy Check (2's complement of sum)
+        unsigned char sum = 0;
+        for (char c : data) {
+            sum += static_cast<unsigned char>(c);
+        }
+        unsigned char lrc = (~sum) + 1;
+        return QByteArray(1, lrc);
+    } else if (algorithm == "CRC16") {
+        // CRC-16/MODBUS, low byte first
+        static const Crc::Engine modbus(*Crc::findModel("CRC-16/MODBUS"));
+        return modbus.toBytes(modbus.compute(data.constData(), data.size()));
+    } else if (algorithm == "CRC32") {
+        // CRC-32 (Standard Ethernet/ZIP polynomial), low byte first
+        static const Crc::Engine crc32(*Crc::findModel("CRC-32/ISO-HDLC"));
+        return crc32.toBytes(crc32.compute(data.constData(), data.size()));
+    }
+
+    return QByteArray(); // Unknown algorithm
+}
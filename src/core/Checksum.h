@@ -0,0 +1,38 @@
+/**
+ * @file Checksum.h
+ * @brief Frame checksums shared by the checksum calculator and the device simulator.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#ifndef CHECKSUM_H
+#define CHECKSUM_H
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+
+namespace Checksum {
+
+/**
+ * @brief Names accepted by calculate(): "CRC16" (CRC-16/MODBUS), "CRC32"
+ *        (CRC-32/ISO-HDLC), "XOR", "LRC", "SUM8", followed by every model
+ *        of the CRC catalogue in CrcModel.h ("CRC-16/XMODEM", ...).
+ */
+QStringList algorithms();
+
+/**
+ * @brief Calculates the checksum of @p data.
+ * @param algorithm One of algorithms(); catalogue CRCs also accept their aliases
+ * @return The checksum bytes as they go on the wire (reflected CRCs
+ *         little-endian, others big-endian), or an empty array for empty
+ *         data or an unknown algorithm.
+ */
+QByteArray calculate(const QByteArray &data, const QString &algorithm);
+
+} // namespace Checksum
+
+#endif // CHECKSUM_H
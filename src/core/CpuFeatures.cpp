@@ -0,0 +1,81 @@
+/**
+ * @file CpuFeatures.cpp
+ * @brief CPUID based feature detection.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "CpuFeatures.h"
+
+#if CPU_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace {
+
+#if CPU_X86
+
+/// Registers eax, ebx, ecx, edx of CPUID @p leaf, or zeros if it does not exist
+void cpuid(unsigned int leaf, unsigned int regs[4])
+{
+    regs[0] = regs[1] = regs[2] = regs[3] = 0;
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (unsigned(info[0]) < leaf)
+        return;
+    __cpuidex(info, int(leaf), 0);
+    for (int i = 0; i < 4; ++i)
+        regs[i] = unsigned(info[i]);
+#else
+    if (__get_cpuid_max(0, nullptr) < leaf)
+        return;
+    __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+/// True if the OS saves the XMM and YMM registers on a context switch
+bool osSavesYmm(unsigned int ecx1)
+{
+    if (!(ecx1 & (1u << 27)))   // OSXSAVE
+        return false;
+#if defined(_MSC_VER)
+    const unsigned long long xcr0 = _xgetbv(0);
+#else
+    unsigned int lo, hi;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    const unsigned long long xcr0 = (static_cast<unsigned long long>(hi) << 32) | lo;
+#endif
+    return (xcr0 & 6) == 6;
+}
+
+#endif
+
+} // namespace
+
+const CpuFeatures &cpuFeatures()
+{
+    static const CpuFeatures features = [] {
+        CpuFeatures f;
+#if CPU_X86
+        unsigned int leaf1[4], leaf7[4];
+        cpuid(1, leaf1);
+        cpuid(7, leaf7);
+        f.sse2 = leaf1[3] & (1u << 26);
+        f.ssse3 = leaf1[2] & (1u << 9);
+        f.sse41 = leaf1[2] & (1u << 19);
+        f.sse42 = leaf1[2] & (1u << 20);
+        f.pclmul = leaf1[2] & (1u << 1);
+        f.avx2 = (leaf7[1] & (1u << 5)) && osSavesYmm(leaf1[2]);
+#endif
+        return f;
+    }();
+    return features;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file CpuFeatures.h
+ * @brief Run-time detection of the x86 instruction set extensions.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * The checksum kernels are compiled for several instruction sets and pick
+ * one at first use. CPU_TARGET() marks a function that may use
+ * instructions beyond the build's baseline; such a function must only be
+ * called after cpuFeatures() has reported them.
+ */
+
+#ifndef CPUFEATURES_H
+#define CPUFEATURES_H
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define CPU_X86 1
+#include <immintrin.h>
+#else
+#define CPU_X86 0
+#endif
+
+// GCC/Clang only emit the instructions inside functions that ask for them,
+// so the rest of the binary still runs on CPUs without them
+#if defined(__GNUC__) || defined(__clang__)
+#define CPU_TARGET(features) __attribute__((target(features)))
+#else
+#define CPU_TARGET(features)
+#endif
+
+struct CpuFeatures
+{
+    bool sse2 = false;
+    bool ssse3 = false;
+    bool sse41 = false;
+    bool sse42 = false;
+    bool pclmul = false;
+    bool avx2 = false;      ///< Also requires the OS to save the YMM registers
+};
+
+/**
+ * @brief Features of the CPU the program runs on, detected once. Any thread.
+ */
+const CpuFeatures &cpuFeatures();
+
+#endif // CPUFEATURES_H
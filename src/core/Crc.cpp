@@ -0,0 +1,332 @@
+/**
+ * @file Crc.cpp
+ * @brief Implementation of the CRC kernels and their CPU dispatch.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "Crc.h"
+
+#include "CpuFeatures.h"
+
+#include <QtEndian>
+
+#include <cstring>
+
+namespace {
+
+// --- Slice-by-16 tables ---
+
+/**
+ * @brief Tables for a reflected (LSB-first) CRC of WidthBytes bytes held in T.
+ *
+ * t[k][b] is the register change caused by byte b followed by k zero bytes,
+ * so sixteen input bytes are folded with sixteen independent lookups.
+ */
+template <typename T, int WidthBytes>
+struct ReflectedTables
+{
+    T t[16][256];
+
+    explicit ReflectedTables(T poly)
+    {
+        for (int b = 0; b < 256; ++b) {
+            T c = T(b);
+            for (int k = 0; k < 8; ++k)
+                c = (c & 1) ? T((c >> 1) ^ poly) : T(c >> 1);
+            t[0][b] = c;
+        }
+        for (int s = 1; s < 16; ++s)
+            for (int b = 0; b < 256; ++b)
+                t[s][b] = T((t[s - 1][b] >> 8) ^ t[0][t[s - 1][b] & 0xFF]);
+    }
+
+    T update(T crc, const uchar *p, size_t len) const
+    {
+        while (len >= 16) {
+            // The register overlaps the first WidthBytes bytes of the block
+            const quint64 lo = qFromLittleEndian<quint64>(p) ^ quint64(crc);
+            const quint64 hi = qFromLittleEndian<quint64>(p + 8);
+            T next = 0;
+            for (int i = 0; i < 8; ++i)
+                next ^= t[15 - i][(lo >> (8 * i)) & 0xFF] ^ t[7 - i][(hi >> (8 * i)) & 0xFF];
+            crc = next;
+            p += 16;
+            len -= 16;
+        }
+        while (len--)
+            crc = T((crc >> 8) ^ t[0][(crc ^ *p++) & 0xFF]);
+        return crc;
+    }
+};
+
+/**
+ * @brief Tables for a non-reflected (MSB-first) CRC of Width <= 32 bits.
+ *        The register is kept left-aligned in 32 bits.
+ */
+template <int Width>
+struct NormalTables
+{
+    quint32 t[16][256];
+
+    explicit NormalTables(quint32 poly)
+    {
+        const quint32 top = poly << (32 - Width);
+        for (int b = 0; b < 256; ++b) {
+            quint32 c = quint32(b) << 24;
+            for (int k = 0; k < 8; ++k)
+                c = (c & 0x80000000u) ? (c << 1) ^ top : c << 1;
+            t[0][b] = c;
+        }
+        for (int s = 1; s < 16; ++s)
+            for (int b = 0; b < 256; ++b)
+                t[s][b] = (t[s - 1][b] << 8) ^ t[0][t[s - 1][b] >> 24];
+    }
+
+    quint32 update(quint32 crc, const uchar *p, size_t len) const
+    {
+        while (len >= 16) {
+            const quint64 hi = qFromBigEndian<quint64>(p) ^ (quint64(crc) << 32);
+            const quint64 lo = qFromBigEndian<quint64>(p + 8);
+            quint32 next = 0;
+            for (int i = 0; i < 8; ++i)
+                next ^= t[15 - i][(hi >> (56 - 8 * i)) & 0xFF] ^ t[7 - i][(lo >> (56 - 8 * i)) & 0xFF];
+            crc = next;
+            p += 16;
+            len -= 16;
+        }
+        while (len--)
+            crc = (crc << 8) ^ t[0][(crc >> 24) ^ *p++];
+        return crc;
+    }
+};
+
+#if CPU_X86
+
+// --- PCLMULQDQ folding ---
+
+/**
+ * @brief Multipliers that move a 128-bit block of a reflected CRC forward.
+ *
+ * A block's low lane holds the higher-degree half, so folding by D bits
+ * multiplies it by x^(D+63) and the high lane by x^(D-1) (the extra -1
+ * absorbs the one-bit shift of a reflected carry-less product).
+ */
+struct FoldConstants
+{
+    quint64 lo512, hi512;   ///< Fold by 4 blocks
+    quint64 lo128, hi128;   ///< Fold by 1 block
+};
+
+quint64 reflect64(quint64 v)
+{
+    quint64 r = 0;
+    for (int i = 0; i < 64; ++i)
+        if (v & (quint64(1) << i))
+            r |= quint64(1) << (63 - i);
+    return r;
+}
+
+/**
+ * @brief x^e mod P as a reflected 64-bit operand.
+ * @param poly Normal-form polynomial without its x^width term
+ */
+quint64 xPowMod(int e, quint64 poly, int width)
+{
+    const quint64 top = quint64(1) << (width - 1);
+    const quint64 mask = width == 64 ? ~quint64(0) : (quint64(1) << width) - 1;
+    quint64 r = 1;
+    for (int i = 0; i < e; ++i) {
+        const bool carry = r & top;
+        r = (r << 1) & mask;
+        if (carry)
+            r ^= poly;
+    }
+    return reflect64(r);
+}
+
+FoldConstants foldConstants(quint64 poly, int width)
+{
+    return {xPowMod(512 + 63, poly, width), xPowMod(512 - 1, poly, width),
+            xPowMod(128 + 63, poly, width), xPowMod(128 - 1, poly, width)};
+}
+
+CPU_TARGET("pclmul,sse2")
+inline __m128i fold(__m128i x, __m128i k)
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11));
+}
+
+/**
+ * @brief Folds @p len bytes (a multiple of 16, at least 64) into 16 bytes
+ *        that leave the same CRC remainder as the input with @p crc applied.
+ */
+CPU_TARGET("pclmul,sse2")
+void foldBlocks(const uchar *p, size_t len, quint64 crc, const FoldConstants &c, uchar out[16])
+{
+    __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 16));
+    __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 32));
+    __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 48));
+    x1 = _mm_xor_si128(x1, _mm_set_epi64x(0, qint64(crc)));
+    p += 64;
+    len -= 64;
+
+    // Four independent lanes keep the multiplier busy
+    __m128i k = _mm_set_epi64x(qint64(c.hi512), qint64(c.lo512));
+    while (len >= 64) {
+        x1 = _mm_xor_si128(fold(x1, k), _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)));
+        x2 = _mm_xor_si128(fold(x2, k), _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 16)));
+        x3 = _mm_xor_si128(fold(x3, k), _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 32)));
+        x4 = _mm_xor_si128(fold(x4, k), _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 48)));
+        p += 64;
+        len -= 64;
+    }
+
+    k = _mm_set_epi64x(qint64(c.hi128), qint64(c.lo128));
+    x1 = _mm_xor_si128(fold(x1, k), x2);
+    x1 = _mm_xor_si128(fold(x1, k), x3);
+    x1 = _mm_xor_si128(fold(x1, k), x4);
+    while (len >= 16) {
+        x1 = _mm_xor_si128(fold(x1, k), _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)));
+        p += 16;
+        len -= 16;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out), x1);
+}
+
+/**
+ * @brief Reflected CRC update: PCLMULQDQ folding for the bulk, tables for
+ *        the folded remainder and the tail.
+ */
+template <typename T, int WidthBytes>
+T updateFolded(const ReflectedTables<T, WidthBytes> &tables, const FoldConstants &c,
+               T crc, const uchar *p, size_t len)
+{
+    if (len >= 256) {
+        const size_t bulk = len & ~size_t(15);
+        uchar rest[16];
+        foldBlocks(p, bulk, crc, c, rest);
+        crc = tables.update(0, rest, 16);
+        p += bulk;
+        len -= bulk;
+    }
+    return tables.update(crc, p, len);
+}
+
+// --- SSE4.2 CRC-32C ---
+
+CPU_TARGET("sse4.2")
+quint32 crc32cHardware(quint32 crc, const uchar *p, size_t len)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    quint64 c = crc;
+    while (len >= 8) {
+        quint64 v;
+        memcpy(&v, p, 8);
+        c = _mm_crc32_u64(c, v);
+        p += 8;
+        len -= 8;
+    }
+    crc = quint32(c);
+#endif
+    while (len >= 4) {
+        quint32 v;
+        memcpy(&v, p, 4);
+        crc = _mm_crc32_u32(crc, v);
+        p += 4;
+        len -= 4;
+    }
+    while (len--)
+        crc = _mm_crc32_u8(crc, *p++);
+    return crc;
+}
+
+#endif // CPU_X86
+
+inline const uchar *bytes(const void *data)
+{
+    return static_cast<const uchar *>(data);
+}
+
+} // namespace
+
+quint8 Crc::crc8(const void *data, qsizetype len, quint8 crc)
+{
+    static const NormalTables<8> tables(0x07);
+    if (len <= 0)
+        return crc;
+    return quint8(tables.update(quint32(crc) << 24, bytes(data), size_t(len)) >> 24);
+}
+
+quint16 Crc::crc16Modbus(const void *data, qsizetype len, quint16 crc)
+{
+    static const ReflectedTables<quint16, 2> tables(0xA001);
+    if (len <= 0)
+        return crc;
+    return tables.update(crc, bytes(data), size_t(len));
+}
+
+quint16 Crc::crc16Umts(const void *data, qsizetype len, quint16 crc)
+{
+    static const NormalTables<16> tables(0x8005);
+    if (len <= 0)
+        return crc;
+    return quint16(tables.update(quint32(crc) << 16, bytes(data), size_t(len)) >> 16);
+}
+
+quint32 Crc::crc32(const void *data, qsizetype len, quint32 crc)
+{
+    static const ReflectedTables<quint32, 4> tables(0xEDB88320u);
+    if (len <= 0)
+        return crc;
+#if CPU_X86
+    if (cpuFeatures().pclmul) {
+        static const FoldConstants fold = foldConstants(0x04C11DB7u, 32);
+        return ~updateFolded(tables, fold, quint32(~crc), bytes(data), size_t(len));
+    }
+#endif
+    return ~tables.update(~crc, bytes(data), size_t(len));
+}
+
+quint32 Crc::crc32c(const void *data, qsizetype len, quint32 crc)
+{
+    static const ReflectedTables<quint32, 4> tables(0x82F63B78u);
+    if (len <= 0)
+        return crc;
+#if CPU_X86
+    if (cpuFeatures().sse42)
+        return ~crc32cHardware(~crc, bytes(data), size_t(len));
+#endif
+    return ~tables.update(~crc, bytes(data), size_t(len));
+}
+
+quint64 Crc::crc64(const void *data, qsizetype len, quint64 crc)
+{
+    static const ReflectedTables<quint64, 8> tables(Q_UINT64_C(0xC96C5795D7870F42));
+    if (len <= 0)
+        return crc;
+#if CPU_X86
+    if (cpuFeatures().pclmul) {
+        static const FoldConstants fold = foldConstants(Q_UINT64_C(0x42F0E1EBA9EA3693), 64);
+        return ~updateFolded(tables, fold, quint64(~crc), bytes(data), size_t(len));
+    }
+#endif
+    return ~tables.update(~crc, bytes(data), size_t(len));
+}
+
+const char *Crc::implementation()
+{
+#if CPU_X86
+    if (cpuFeatures().pclmul && cpuFeatures().sse42)
+        return "PCLMULQDQ + SSE4.2";
+    if (cpuFeatures().pclmul)
+        return "PCLMULQDQ";
+    if (cpuFeatures().sse42)
+        return "SSE4.2";
+#endif
+    return "slice-by-16";
+}
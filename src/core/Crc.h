@@ -0,0 +1,54 @@
+/**
+ * @file Crc.h
+ * @brief Table-driven and hardware-accelerated CRC kernels.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * Every CRC runs slice-by-16: sixteen 256-entry tables, built once from the
+ * polynomial, consume 16 bytes per step instead of one. On x86 the
+ * implementation is picked at first use from CPUID:
+ *  - CRC-32 and CRC-64 fold 64-byte blocks with carry-less multiplication
+ *    (PCLMULQDQ) and finish the last bytes with the tables;
+ *  - CRC-32C uses the SSE4.2 crc32 instruction.
+ *
+ * All functions can be chained over consecutive pieces of data by passing
+ * the previous result as @p crc; the default value starts a new checksum.
+ */
+
+#ifndef CRC_H
+#define CRC_H
+
+#include <QtGlobal>
+
+namespace Crc {
+
+/// CRC-8/SMBUS: poly 0x07, init 0x00
+quint8 crc8(const void *data, qsizetype len, quint8 crc = 0);
+
+/// CRC-16/MODBUS: poly 0x8005 reflected, init 0xFFFF (sent low byte first)
+quint16 crc16Modbus(const void *data, qsizetype len, quint16 crc = 0xFFFF);
+
+/// CRC-16/UMTS (BUYPASS): poly 0x8005, init 0x0000, not reflected
+quint16 crc16Umts(const void *data, qsizetype len, quint16 crc = 0);
+
+/// CRC-32 (ISO-HDLC: Ethernet, zip, gzip, PNG)
+quint32 crc32(const void *data, qsizetype len, quint32 crc = 0);
+
+/// CRC-32C (Castagnoli: iSCSI, ext4, SCTP)
+quint32 crc32c(const void *data, qsizetype len, quint32 crc = 0);
+
+/// CRC-64/XZ (ECMA-182 reflected: xz, 7-Zip)
+quint64 crc64(const void *data, qsizetype len, quint64 crc = 0);
+
+/**
+ * @brief Names the kernels in use, e.g. "PCLMULQDQ + SSE4.2" or "slice-by-16".
+ */
+const char *implementation();
+
+} // namespace Crc
+
+#endif // CRC_H
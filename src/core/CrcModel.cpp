@@ -0,0 +1,416 @@
+/**
+ * @file CrcModel.cpp
+ * @brief Implementation of the Rocksoft-model CRC engine and its catalogue.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "CrcModel.h"
+#include "Crc.h"
+
+#include <QByteArray>
+
+#include <iterator>
+#include <utility>
+
+namespace {
+
+using Crc::Model;
+using Table = std::array<quint64, 256>;
+
+constexpr quint64 ALL_ONES = ~quint64(0);
+
+// Parameters and check values from the CRC RevEng catalogue (widths up to 64)
+constexpr Model MODELS[] = {
+    {"CRC-3/GSM", 3, 0x3, 0x0, false, false, 0x7, 0x4},
+    {"CRC-3/ROHC", 3, 0x3, 0x7, true, true, 0x0, 0x6},
+    {"CRC-4/G-704", 4, 0x3, 0x0, true, true, 0x0, 0x7},
+    {"CRC-4/INTERLAKEN", 4, 0x3, 0xF, false, false, 0xF, 0xB},
+    {"CRC-5/EPC-C1G2", 5, 0x09, 0x09, false, false, 0x00, 0x00},
+    {"CRC-5/G-704", 5, 0x15, 0x00, true, true, 0x00, 0x07},
+    {"CRC-5/USB", 5, 0x05, 0x1F, true, true, 0x1F, 0x19},
+    {"CRC-6/CDMA2000-A", 6, 0x27, 0x3F, false, false, 0x00, 0x0D},
+    {"CRC-6/CDMA2000-B", 6, 0x07, 0x3F, false, false, 0x00, 0x3B},
+    {"CRC-6/DARC", 6, 0x19, 0x00, true, true, 0x00, 0x26},
+    {"CRC-6/G-704", 6, 0x03, 0x00, true, true, 0x00, 0x06},
+    {"CRC-6/GSM", 6, 0x2F, 0x00, false, false, 0x3F, 0x13},
+    {"CRC-7/MMC", 7, 0x09, 0x00, false, false, 0x00, 0x75},
+    {"CRC-7/ROHC", 7, 0x4F, 0x7F, true, true, 0x00, 0x53},
+    {"CRC-7/UMTS", 7, 0x45, 0x00, false, false, 0x00, 0x61},
+    {"CRC-8/AUTOSAR", 8, 0x2F, 0xFF, false, false, 0xFF, 0xDF},
+    {"CRC-8/BLUETOOTH", 8, 0xA7, 0x00, true, true, 0x00, 0x26},
+    {"CRC-8/CDMA2000", 8, 0x9B, 0xFF, false, false, 0x00, 0xDA},
+    {"CRC-8/DARC", 8, 0x39, 0x00, true, true, 0x00, 0x15},
+    {"CRC-8/DVB-S2", 8, 0xD5, 0x00, false, false, 0x00, 0xBC},
+    {"CRC-8/GSM-A", 8, 0x1D, 0x00, false, false, 0x00, 0x37},
+    {"CRC-8/GSM-B", 8, 0x49, 0x00, false, false, 0xFF, 0x94},
+    {"CRC-8/HITAG", 8, 0x1D, 0xFF, false, false, 0x00, 0xB4},
+    {"CRC-8/I-432-1", 8, 0x07, 0x00, false, false, 0x55, 0xA1},
+    {"CRC-8/I-CODE", 8, 0x1D, 0xFD, false, false, 0x00, 0x7E},
+    {"CRC-8/LTE", 8, 0x9B, 0x00, false, false, 0x00, 0xEA},
+    {"CRC-8/MAXIM-DOW", 8, 0x31, 0x00, true, true, 0x00, 0xA1},
+    {"CRC-8/MIFARE-MAD", 8, 0x1D, 0xC7, false, false, 0x00, 0x99},
+    {"CRC-8/NRSC-5", 8, 0x31, 0xFF, false, false, 0x00, 0xF7},
+    {"CRC-8/OPENSAFETY", 8, 0x2F, 0x00, false, false, 0x00, 0x3E},
+    {"CRC-8/ROHC", 8, 0x07, 0xFF, true, true, 0x00, 0xD0},
+    {"CRC-8/SAE-J1850", 8, 0x1D, 0xFF, false, false, 0xFF, 0x4B},
+    {"CRC-8/SMBUS", 8, 0x07, 0x00, false, false, 0x00, 0xF4},
+    {"CRC-8/TECH-3250", 8, 0x1D, 0xFF, true, true, 0x00, 0x97},
+    {"CRC-8/WCDMA", 8, 0x9B, 0x00, true, true, 0x00, 0x25},
+    {"CRC-10/ATM", 10, 0x233, 0x000, false, false, 0x000, 0x199},
+    {"CRC-10/CDMA2000", 10, 0x3D9, 0x3FF, false, false, 0x000, 0x233},
+    {"CRC-10/GSM", 10, 0x175, 0x000, false, false, 0x3FF, 0x12A},
+    {"CRC-11/FLEXRAY", 11, 0x385, 0x01A, false, false, 0x000, 0x5A3},
+    {"CRC-11/UMTS", 11, 0x307, 0x000, false, false, 0x000, 0x061},
+    {"CRC-12/CDMA2000", 12, 0xF13, 0xFFF, false, false, 0x000, 0xD4D},
+    {"CRC-12/DECT", 12, 0x80F, 0x000, false, false, 0x000, 0xF5B},
+    {"CRC-12/GSM", 12, 0xD31, 0x000, false, false, 0xFFF, 0xB34},
+    {"CRC-12/UMTS", 12, 0x80F, 0x000, false, true, 0x000, 0xDAF},
+    {"CRC-13/BBC", 13, 0x1CF5, 0x0000, false, false, 0x0000, 0x04FA},
+    {"CRC-14/DARC", 14, 0x0805, 0x0000, true, true, 0x0000, 0x082D},
+    {"CRC-14/GSM", 14, 0x202D, 0x0000, false, false, 0x3FFF, 0x30AE},
+    {"CRC-15/CAN", 15, 0x4599, 0x0000, false, false, 0x0000, 0x059E},
+    {"CRC-15/MPT1327", 15, 0x6815, 0x0000, false, false, 0x0001, 0x2566},
+    {"CRC-16/ARC", 16, 0x8005, 0x0000, true, true, 0x0000, 0xBB3D},
+    {"CRC-16/CDMA2000", 16, 0xC867, 0xFFFF, false, false, 0x0000, 0x4C06},
+    {"CRC-16/CMS", 16, 0x8005, 0xFFFF, false, false, 0x0000, 0xAEE7},
+    {"CRC-16/DDS-110", 16, 0x8005, 0x800D, false, false, 0x0000, 0x9ECF},
+    {"CRC-16/DECT-R", 16, 0x0589, 0x0000, false, false, 0x0001, 0x007E},
+    {"CRC-16/DECT-X", 16, 0x0589, 0x0000, false, false, 0x0000, 0x007F},
+    {"CRC-16/DNP", 16, 0x3D65, 0x0000, true, true, 0xFFFF, 0xEA82},
+    {"CRC-16/EN-13757", 16, 0x3D65, 0x0000, false, false, 0xFFFF, 0xC2B7},
+    {"CRC-16/GENIBUS", 16, 0x1021, 0xFFFF, false, false, 0xFFFF, 0xD64E},
+    {"CRC-16/GSM", 16, 0x1021, 0x0000, false, false, 0xFFFF, 0xCE3C},
+    {"CRC-16/IBM-3740", 16, 0x1021, 0xFFFF, false, false, 0x0000, 0x29B1},
+    {"CRC-16/IBM-SDLC", 16, 0x1021, 0xFFFF, true, true, 0xFFFF, 0x906E},
+    {"CRC-16/ISO-IEC-14443-3-A", 16, 0x1021, 0xC6C6, true, true, 0x0000, 0xBF05},
+    {"CRC-16/KERMIT", 16, 0x1021, 0x0000, true, true, 0x0000, 0x2189},
+    {"CRC-16/LJ1200", 16, 0x6F63, 0x0000, false, false, 0x0000, 0xBDF4},
+    {"CRC-16/M17", 16, 0x5935, 0xFFFF, false, false, 0x0000, 0x772B},
+    {"CRC-16/MAXIM-DOW", 16, 0x8005, 0x0000, true, true, 0xFFFF, 0x44C2},
+    {"CRC-16/MCRF4XX", 16, 0x1021, 0xFFFF, true, true, 0x0000, 0x6F91},
+    {"CRC-16/MODBUS", 16, 0x8005, 0xFFFF, true, true, 0x0000, 0x4B37},
+    {"CRC-16/NRSC-5", 16, 0x080B, 0xFFFF, true, true, 0x0000, 0xA066},
+    {"CRC-16/OPENSAFETY-A", 16, 0x5935, 0x0000, false, false, 0x0000, 0x5D38},
+    {"CRC-16/OPENSAFETY-B", 16, 0x755B, 0x0000, false, false, 0x0000, 0x20FE},
+    {"CRC-16/PROFIBUS", 16, 0x1DCF, 0xFFFF, false, false, 0xFFFF, 0xA819},
+    {"CRC-16/RIELLO", 16, 0x1021, 0xB2AA, true, true, 0x0000, 0x63D0},
+    {"CRC-16/SPI-FUJITSU", 16, 0x1021, 0x1D0F, false, false, 0x0000, 0xE5CC},
+    {"CRC-16/T10-DIF", 16, 0x8BB7, 0x0000, false, false, 0x0000, 0xD0DB},
+    {"CRC-16/TELEDISK", 16, 0xA097, 0x0000, false, false, 0x0000, 0x0FB3},
+    {"CRC-16/TMS37157", 16, 0x1021, 0x89EC, true, true, 0x0000, 0x26B1},
+    {"CRC-16/UMTS", 16, 0x8005, 0x0000, false, false, 0x0000, 0xFEE8},
+    {"CRC-16/USB", 16, 0x8005, 0xFFFF, true, true, 0xFFFF, 0xB4C8},
+    {"CRC-16/XMODEM", 16, 0x1021, 0x0000, false, false, 0x0000, 0x31C3},
+    {"CRC-17/CAN-FD", 17, 0x1685B, 0x00000, false, false, 0x00000, 0x04F03},
+    {"CRC-21/CAN-FD", 21, 0x102899, 0x000000, false, false, 0x000000, 0x0ED841},
+    {"CRC-24/BLE", 24, 0x00065B, 0x555555, true, true, 0x000000, 0xC25A56},
+    {"CRC-24/FLEXRAY-A", 24, 0x5D6DCB, 0xFEDCBA, false, false, 0x000000, 0x7979BD},
+    {"CRC-24/FLEXRAY-B", 24, 0x5D6DCB, 0xABCDEF, false, false, 0x000000, 0x1F23B8},
+    {"CRC-24/INTERLAKEN", 24, 0x328B63, 0xFFFFFF, false, false, 0xFFFFFF, 0xB4F3E6},
+    {"CRC-24/LTE-A", 24, 0x864CFB, 0x000000, false, false, 0x000000, 0xCDE703},
+    {"CRC-24/LTE-B", 24, 0x800063, 0x000000, false, false, 0x000000, 0x23EF52},
+    {"CRC-24/OPENPGP", 24, 0x864CFB, 0xB704CE, false, false, 0x000000, 0x21CF02},
+    {"CRC-24/OS-9", 24, 0x800063, 0xFFFFFF, false, false, 0xFFFFFF, 0x200FA5},
+    {"CRC-30/CDMA", 30, 0x2030B9C7, 0x3FFFFFFF, false, false, 0x3FFFFFFF, 0x04C34ABF},
+    {"CRC-31/PHILIPS", 31, 0x04C11DB7, 0x7FFFFFFF, false, false, 0x7FFFFFFF, 0x0CE9E46C},
+    {"CRC-32/AIXM", 32, 0x814141AB, 0x00000000, false, false, 0x00000000, 0x3010BF7F},
+    {"CRC-32/AUTOSAR", 32, 0xF4ACFB13, 0xFFFFFFFF, true, true, 0xFFFFFFFF, 0x1697D06A},
+    {"CRC-32/BASE91-D", 32, 0xA833982B, 0xFFFFFFFF, true, true, 0xFFFFFFFF, 0x87315576},
+    {"CRC-32/BZIP2", 32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF, 0xFC891918},
+    {"CRC-32/CD-ROM-EDC", 32, 0x8001801B, 0x00000000, true, true, 0x00000000, 0x6EC2EDC4},
+    {"CRC-32/CKSUM", 32, 0x04C11DB7, 0x00000000, false, false, 0xFFFFFFFF, 0x765E7680},
+    {"CRC-32/ISCSI", 32, 0x1EDC6F41, 0xFFFFFFFF, true, true, 0xFFFFFFFF, 0xE3069283},
+    {"CRC-32/ISO-HDLC", 32, 0x04C11DB7, 0xFFFFFFFF, true, true, 0xFFFFFFFF, 0xCBF43926},
+    {"CRC-32/JAMCRC", 32, 0x04C11DB7, 0xFFFFFFFF, true, true, 0x00000000, 0x340BC6D9},
+    {"CRC-32/MEF", 32, 0x741B8CD7, 0xFFFFFFFF, true, true, 0x00000000, 0xD2C22F51},
+    {"CRC-32/MPEG-2", 32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0x00000000, 0x0376E6E7},
+    {"CRC-32/XFER", 32, 0x000000AF, 0x00000000, false, false, 0x00000000, 0xBD0BE338},
+    {"CRC-40/GSM", 40, 0x0004820009, 0x0000000000, false, false, 0xFFFFFFFFFF, 0xD4164FC646},
+    {"CRC-64/ECMA-182", 64, 0x42F0E1EBA9EA3693, 0, false, false, 0, 0x6C40DF5F0B497347},
+    {"CRC-64/GO-ISO", 64, 0x000000000000001B, ALL_ONES, true, true, ALL_ONES, 0xB90956C775A41001},
+    {"CRC-64/MS", 64, 0x259C84CBA6426349, ALL_ONES, true, true, 0, 0x75D4B74F024ECEEA},
+    {"CRC-64/NVME", 64, 0xAD93D23594C93659, ALL_ONES, true, true, ALL_ONES, 0xAE8B14860A799888},
+    {"CRC-64/REDIS", 64, 0xAD93D23594C935A9, 0, true, true, 0, 0xE9C6D914C4B8D9CA},
+    {"CRC-64/WE", 64, 0x42F0E1EBA9EA3693, ALL_ONES, false, false, ALL_ONES, 0x62EC59E3F1A4F00A},
+    {"CRC-64/XZ", 64, 0x42F0E1EBA9EA3693, ALL_ONES, true, true, ALL_ONES, 0x995DC9BBDF1939FA},
+};
+
+constexpr int MODEL_COUNT = int(std::size(MODELS));
+
+struct Alias
+{
+    const char *alias;
+    const char *name;
+};
+
+// Common names that are not the catalogue's primary name
+constexpr Alias ALIASES[] = {
+    {"CRC-8", "CRC-8/SMBUS"},
+    {"CRC-8/MAXIM", "CRC-8/MAXIM-DOW"},
+    {"CRC-8/ITU", "CRC-8/I-432-1"},
+    {"CRC-16", "CRC-16/ARC"},
+    {"CRC-16/IBM", "CRC-16/ARC"},
+    {"CRC-16/LHA", "CRC-16/ARC"},
+    {"CRC-16/BUYPASS", "CRC-16/UMTS"},
+    {"CRC-16/CCITT", "CRC-16/KERMIT"},
+    {"CRC-16/CCITT-TRUE", "CRC-16/KERMIT"},
+    {"CRC-16/CCITT-FALSE", "CRC-16/IBM-3740"},
+    {"CRC-16/AUTOSAR", "CRC-16/IBM-3740"},
+    {"CRC-16/AUG-CCITT", "CRC-16/SPI-FUJITSU"},
+    {"CRC-16/X-25", "CRC-16/IBM-SDLC"},
+    {"CRC-16/ACORN", "CRC-16/XMODEM"},
+    {"CRC-16/ZMODEM", "CRC-16/XMODEM"},
+    {"CRC-16/MAXIM", "CRC-16/MAXIM-DOW"},
+    {"CRC-A", "CRC-16/ISO-IEC-14443-3-A"},
+    {"CRC-24", "CRC-24/OPENPGP"},
+    {"CRC-32", "CRC-32/ISO-HDLC"},
+    {"CRC-32/ADCCP", "CRC-32/ISO-HDLC"},
+    {"CRC-32/V-42", "CRC-32/ISO-HDLC"},
+    {"CRC-32/XZ", "CRC-32/ISO-HDLC"},
+    {"CRC-32C", "CRC-32/ISCSI"},
+    {"CRC-32/CASTAGNOLI", "CRC-32/ISCSI"},
+    {"CRC-32/POSIX", "CRC-32/CKSUM"},
+    {"CRC-32/AAL5", "CRC-32/BZIP2"},
+    {"CRC-32Q", "CRC-32/AIXM"},
+    {"CRC-64", "CRC-64/ECMA-182"},
+    {"CRC-64/ECMA", "CRC-64/ECMA-182"},
+    {"CRC-64/GO-ECMA", "CRC-64/XZ"},
+};
+
+// --- Compile-time tables ---
+
+constexpr quint64 widthMask(int width)
+{
+    return width >= 64 ? ALL_ONES : (quint64(1) << width) - 1;
+}
+
+constexpr quint64 reflect(quint64 value, int width)
+{
+    quint64 out = 0;
+    for (int i = 0; i < width; ++i) {
+        out = (out << 1) | (value & 1);
+        value >>= 1;
+    }
+    return out;
+}
+
+/**
+ * Reflected models keep the register bit-reversed in the low bits; normal
+ * models keep it left-aligned in 64 bits, so one byte step serves every width.
+ */
+constexpr Table makeTable(const Model &m)
+{
+    Table t{};
+    if (m.refin) {
+        const quint64 poly = reflect(m.poly, m.width);
+        for (int b = 0; b < 256; ++b) {
+            quint64 c = quint64(b);
+            for (int k = 0; k < 8; ++k)
+                c = (c & 1) ? (c >> 1) ^ poly : c >> 1;
+            t[b] = c;
+        }
+    } else {
+        const quint64 top = m.poly << (64 - m.width);
+        for (int b = 0; b < 256; ++b) {
+            quint64 c = quint64(b) << 56;
+            for (int k = 0; k < 8; ++k)
+                c = (c >> 63) ? (c << 1) ^ top : c << 1;
+            t[b] = c;
+        }
+    }
+    return t;
+}
+
+// Each table is its own constant expression, which keeps every evaluation
+// well inside the compilers' constexpr step limits
+template <std::size_t I>
+constexpr Table TABLE = makeTable(MODELS[I]);
+
+template <std::size_t... I>
+constexpr std::array<const Table *, sizeof...(I)> tablePointers(std::index_sequence<I...>)
+{
+    return {{&TABLE<I>...}};
+}
+
+constexpr std::array<const Table *, MODEL_COUNT> TABLES =
+    tablePointers(std::make_index_sequence<MODEL_COUNT>());
+
+/// Bit-at-a-time reference, used only to verify the catalogue
+constexpr quint64 referenceCheck(const Model &m)
+{
+    const char text[] = "123456789";
+    const quint64 top = quint64(1) << (m.width - 1);
+    quint64 reg = m.init;
+    for (int i = 0; i < 9; ++i) {
+        quint64 b = quint64(uchar(text[i]));
+        if (m.refin)
+            b = reflect(b, 8);
+        for (int k = 7; k >= 0; --k) {
+            const bool feedback = ((reg & top) != 0) != (((b >> k) & 1) != 0);
+            reg = (reg << 1) & widthMask(m.width);
+            if (feedback)
+                reg ^= m.poly;
+        }
+    }
+    if (m.refout)
+        reg = reflect(reg, m.width);
+    return (reg ^ m.xorout) & widthMask(m.width);
+}
+
+constexpr int firstFailingModel()
+{
+    for (int i = 0; i < MODEL_COUNT; ++i)
+        if (referenceCheck(MODELS[i]) != MODELS[i].check)
+            return i;
+    return -1;
+}
+
+static_assert(firstFailingModel() == -1, "CRC catalogue entry does not match its check value");
+
+// --- Accelerated kernels from Crc.h ---
+
+quint64 kernelCrc8(const void *data, qsizetype len, quint64 crc) { return Crc::crc8(data, len, quint8(crc)); }
+quint64 kernelCrc16Modbus(const void *data, qsizetype len, quint64 crc) { return Crc::crc16Modbus(data, len, quint16(crc)); }
+quint64 kernelCrc16Umts(const void *data, qsizetype len, quint64 crc) { return Crc::crc16Umts(data, len, quint16(crc)); }
+quint64 kernelCrc32(const void *data, qsizetype len, quint64 crc) { return Crc::crc32(data, len, quint32(crc)); }
+quint64 kernelCrc32c(const void *data, qsizetype len, quint64 crc) { return Crc::crc32c(data, len, quint32(crc)); }
+quint64 kernelCrc64(const void *data, qsizetype len, quint64 crc) { return Crc::crc64(data, len, crc); }
+
+struct KernelEntry
+{
+    int width;
+    quint64 poly;
+    bool refin;
+    quint64 (*kernel)(const void *, qsizetype, quint64);
+    quint64 kernelXor;  ///< What the kernel applies on entry and exit
+};
+
+// A kernel updates any model with the same width, poly and input order;
+// init, refout and xorout are applied around it
+const KernelEntry KERNELS[] = {
+    {8, 0x07, false, kernelCrc8, 0},
+    {16, 0x8005, true, kernelCrc16Modbus, 0},
+    {16, 0x8005, false, kernelCrc16Umts, 0},
+    {32, 0x04C11DB7, true, kernelCrc32, 0xFFFFFFFF},
+    {32, 0x1EDC6F41, true, kernelCrc32c, 0xFFFFFFFF},
+    {64, 0x42F0E1EBA9EA3693, true, kernelCrc64, ALL_ONES},
+};
+
+} // namespace
+
+int Crc::modelCount()
+{
+    return MODEL_COUNT;
+}
+
+const Crc::Model &Crc::model(int index)
+{
+    return MODELS[index];
+}
+
+const Crc::Model *Crc::findModel(const QString &name)
+{
+    QString wanted = name.trimmed();
+    for (const Alias &alias : ALIASES) {
+        if (wanted.compare(QLatin1String(alias.alias), Qt::CaseInsensitive) == 0) {
+            wanted = QLatin1String(alias.name);
+            break;
+        }
+    }
+    for (const Model &m : MODELS)
+        if (wanted.compare(QLatin1String(m.name), Qt::CaseInsensitive) == 0)
+            return &m;
+    return nullptr;
+}
+
+QStringList Crc::modelNames()
+{
+    QStringList names;
+    for (const Model &m : MODELS)
+        names << QLatin1String(m.name);
+    return names;
+}
+
+Crc::Engine::Engine(const Model &model) :
+    m_model(model)
+{
+    for (int i = 0; i < MODEL_COUNT; ++i) {
+        const Model &m = MODELS[i];
+        if (m.width == model.width && m.poly == model.poly && m.refin == model.refin) {
+            m_table = TABLES[i]->data();
+            break;
+        }
+    }
+    if (!m_table) {
+        // Not in the catalogue: same generator, evaluated at run time
+        m_customTable = makeTable(model);
+        m_customModel = true;
+    }
+
+    for (const KernelEntry &k : KERNELS) {
+        if (k.width == model.width && k.poly == model.poly && k.refin == model.refin) {
+            m_kernel = k.kernel;
+            m_kernelXor = k.kernelXor;
+            break;
+        }
+    }
+}
+
+quint64 Crc::Engine::begin() const
+{
+    const quint64 init = m_model.init & widthMask(m_model.width);
+    return m_model.refin ? reflect(init, m_model.width) : init << (64 - m_model.width);
+}
+
+quint64 Crc::Engine::update(quint64 reg, const void *data, qsizetype len) const
+{
+    if (len <= 0)
+        return reg;
+    if (m_kernel)
+        return fromValue(m_kernel(data, len, toValue(reg)));
+
+    const uchar *p = static_cast<const uchar *>(data);
+    const quint64 *t = table();
+    if (m_model.refin) {
+        while (len--)
+            reg = (reg >> 8) ^ t[(reg ^ *p++) & 0xFF];
+    } else {
+        while (len--)
+            reg = (reg << 8) ^ t[(reg >> 56) ^ *p++];
+    }
+    return reg;
+}
+
+quint64 Crc::Engine::end(quint64 reg) const
+{
+    quint64 value = m_model.refin ? reg : reg >> (64 - m_model.width);
+    if (m_model.refin != m_model.refout)
+        value = reflect(value, m_model.width);
+    return (value ^ m_model.xorout) & widthMask(m_model.width);
+}
+
+QByteArray Crc::Engine::toBytes(quint64 crc) const
+{
+    const int n = byteCount();
+    QByteArray out(n, Qt::Uninitialized);
+    for (int i = 0; i < n; ++i) {
+        const int shift = m_model.refout ? 8 * i : 8 * (n - 1 - i);
+        out[i] = char(crc >> shift);
+    }
+    return out;
+}
+
+quint64 Crc::Engine::toValue(quint64 reg) const
+{
+    return (m_model.refin ? reg : reg >> (64 - m_model.width)) ^ m_kernelXor;
+}
+
+quint64 Crc::Engine::fromValue(quint64 value) const
+{
+    value ^= m_kernelXor;
+    return m_model.refin ? value : value << (64 - m_model.width);
+}
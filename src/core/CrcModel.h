@@ -0,0 +1,113 @@
+/**
+ * @file CrcModel.h
+ * @brief Rocksoft-model CRC engine and the catalogue of standard CRCs.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * A CRC is described by the Rocksoft parameters (width, poly, init, refin,
+ * refout, xorout), as in the CRC RevEng catalogue. Every catalogue entry
+ * carries its check value (the CRC of "123456789"); the lookup tables are
+ * generated and the check values verified at compile time.
+ *
+ * Models whose polynomial has an accelerated kernel in Crc.h (CRC-32,
+ * CRC-32C, CRC-64/XZ, the 0x8005 CRC-16s, CRC-8/SMBUS and their relatives)
+ * run on that kernel; all others use their byte table.
+ */
+
+#ifndef CRCMODEL_H
+#define CRCMODEL_H
+
+#include <QString>
+#include <QStringList>
+
+#include <array>
+
+namespace Crc {
+
+struct Model
+{
+    const char *name;
+    int width;          ///< 1..64 bits
+    quint64 poly;       ///< Normal (MSB-first) form, without the top bit
+    quint64 init;
+    bool refin;
+    bool refout;
+    quint64 xorout;
+    quint64 check;      ///< CRC of the ASCII bytes "123456789"
+};
+
+/**
+ * @brief Number of models in the catalogue.
+ */
+int modelCount();
+
+/**
+ * @brief Catalogue entry @p index (0 <= index < modelCount()).
+ */
+const Model &model(int index);
+
+/**
+ * @brief Looks a model up by name or common alias, e.g. "CRC-16/XMODEM",
+ *        "CRC-16/CCITT-FALSE" or "crc-32c" (case-insensitive).
+ * @return nullptr if the name is unknown
+ */
+const Model *findModel(const QString &name);
+
+/**
+ * @brief Catalogue names in catalogue order (sorted by width, then name).
+ */
+QStringList modelNames();
+
+/**
+ * @brief Computes any Rocksoft-model CRC.
+ *
+ * The register works in its own internal representation; chain pieces of
+ * data with begin() / update() / end(), or call compute() for one block.
+ */
+class Engine
+{
+public:
+    explicit Engine(const Model &model);
+
+    const Model &model() const { return m_model; }
+
+    /// Width rounded up to whole bytes
+    int byteCount() const { return (m_model.width + 7) / 8; }
+
+    quint64 begin() const;
+    quint64 update(quint64 reg, const void *data, qsizetype len) const;
+    quint64 end(quint64 reg) const;
+
+    quint64 compute(const void *data, qsizetype len) const
+    {
+        return end(update(begin(), data, len));
+    }
+
+    /**
+     * @brief A CRC value as it is usually sent: reflected CRCs low byte
+     *        first, others high byte first.
+     */
+    QByteArray toBytes(quint64 crc) const;
+
+private:
+    using Kernel = quint64 (*)(const void *data, qsizetype len, quint64 crc);
+
+    Model m_model;
+    const quint64 *m_table = nullptr;
+    std::array<quint64, 256> m_customTable;
+    bool m_customModel = false;
+    Kernel m_kernel = nullptr;
+    quint64 m_kernelXor = 0;
+
+    const quint64 *table() const { return m_customModel ? m_customTable.data() : m_table; }
+    quint64 toValue(quint64 reg) const;
+    quint64 fromValue(quint64 value) const;
+};
+
+} // namespace Crc
+
+#endif // CRCMODEL_H
@@ -0,0 +1,588 @@
+/**
+ * @file CrcSolver.cpp
+ * @brief Implementation of the CRC parameter search.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "CrcSolver.h"
+
+#include <QHash>
+#include <QMap>
+#include <QMutexLocker>
+#include <QThread>
+#include <QtAlgorithms>
+
+#include <vector>
+
+namespace {
+
+/// Above this many candidates (times the GCD degree) a variant is reported as underdetermined
+const double MAX_SEARCH_COST = 2e9;
+const int MAX_PAIRS = 64;               ///< Frame pairs folded into the GCD per variant
+const int CHUNKS_PER_SEARCH = 64;
+
+/// GF(2) polynomial of any degree; bit i is the coefficient of x^i
+using Poly = std::vector<quint64>;
+
+quint64 widthMask(int width)
+{
+    return width >= 64 ? ~quint64(0) : (quint64(1) << width) - 1;
+}
+
+quint64 reflect(quint64 value, int width)
+{
+    quint64 r = 0;
+    for (int i = 0; i < width; ++i, value >>= 1)
+        r = (r << 1) | (value & 1);
+    return r;
+}
+
+void trim(Poly &p)
+{
+    while (!p.empty() && !p.back())
+        p.pop_back();
+}
+
+int degree(const Poly &p)
+{
+    for (int i = int(p.size()) - 1; i >= 0; --i) {
+        if (p[i])
+            return 64 * i + 63 - qCountLeadingZeroBits(p[i]);
+    }
+    return -1;
+}
+
+/// a ^= b·x^shift
+void xorShifted(Poly &a, const Poly &b, int shift)
+{
+    const size_t words = size_t(shift / 64);
+    const int bits = shift % 64;
+    if (a.size() < b.size() + words + 1)
+        a.resize(b.size() + words + 1, 0);
+    for (size_t i = 0; i < b.size(); ++i) {
+        a[i + words] ^= b[i] << bits;
+        if (bits)
+            a[i + words + 1] ^= b[i] >> (64 - bits);
+    }
+}
+
+Poly mod(Poly a, const Poly &b)
+{
+    const int db = degree(b);
+    trim(a);
+    for (int da = degree(a); da >= db; da = degree(a)) {
+        xorShifted(a, b, da - db);
+        trim(a);
+    }
+    return a;
+}
+
+Poly divide(Poly a, const Poly &b)
+{
+    const int db = degree(b);
+    Poly q;
+    trim(a);
+    for (int da = degree(a); da >= db; da = degree(a)) {
+        const int s = da - db;
+        if (q.size() <= size_t(s / 64))
+            q.resize(s / 64 + 1, 0);
+        q[s / 64] |= quint64(1) << (s % 64);
+        xorShifted(a, b, s);
+        trim(a);
+    }
+    return q;
+}
+
+Poly gcd(Poly a, Poly b)
+{
+    trim(a);
+    trim(b);
+    while (degree(b) >= 0) {
+        a = mod(std::move(a), b);
+        std::swap(a, b);
+    }
+    return a;
+}
+
+/// g mod (x^width + poly)
+quint64 remainder(const Poly &g, int width, quint64 poly)
+{
+    const quint64 mask = widthMask(width);
+    quint64 r = 0;
+    for (int i = degree(g); i >= 0; --i) {
+        const bool carry = (r >> (width - 1)) & 1;
+        r = ((r << 1) | ((g[i / 64] >> (i % 64)) & 1)) & mask;
+        if (carry)
+            r ^= poly;
+    }
+    return r;
+}
+
+/// One step of the normal (MSB-first) register: r·x mod P
+quint64 timesX(quint64 r, int width, quint64 poly)
+{
+    const bool carry = (r >> (width - 1)) & 1;
+    r = (r << 1) & widthMask(width);
+    return carry ? r ^ poly : r;
+}
+
+/// Normal register after @p message, starting from zero, i.e. M(x)·x^w mod P
+quint64 crcRegister(const QByteArray &message, int width, quint64 poly)
+{
+    const quint64 mask = widthMask(width);
+    quint64 r = 0;
+    for (char c : message) {
+        const uchar b = uchar(c);
+        for (int bit = 7; bit >= 0; --bit) {
+            const bool carry = ((r >> (width - 1)) ^ (b >> bit)) & 1;
+            r = (r << 1) & mask;
+            if (carry)
+                r ^= poly;
+        }
+    }
+    return r;
+}
+
+/**
+ * Column j is the contribution of init bit j to the register after @p length
+ * zero bytes: x^j·x^(8·length) mod P.
+ */
+std::vector<quint64> initColumns(int length, int width, quint64 poly)
+{
+    std::vector<quint64> columns(width);
+    quint64 r = 1;
+    for (qint64 i = 0; i < qint64(length) * 8; ++i)
+        r = timesX(r, width, poly);
+    for (int j = 0; j < width; ++j) {
+        columns[j] = r;
+        r = timesX(r, width, poly);
+    }
+    return columns;
+}
+
+quint64 applyColumns(const std::vector<quint64> &columns, quint64 value)
+{
+    quint64 r = 0;
+    for (size_t j = 0; j < columns.size(); ++j) {
+        if ((value >> j) & 1)
+            r ^= columns[j];
+    }
+    return r;
+}
+
+struct Equation {
+    quint64 coefficients;   ///< Bit j: init bit j takes part
+    bool rhs;
+};
+
+/**
+ * Gaussian elimination over GF(2). Free unknowns are set to zero.
+ * @return false if the system is inconsistent
+ */
+bool solveLinear(std::vector<Equation> rows, int width, quint64 *solution, bool *underdetermined)
+{
+    size_t rank = 0;
+    std::vector<int> pivotRow(width, -1);
+    for (int col = 0; col < width && rank < rows.size(); ++col) {
+        const quint64 bit = quint64(1) << col;
+        size_t r = rank;
+        while (r < rows.size() && !(rows[r].coefficients & bit))
+            ++r;
+        if (r == rows.size())
+            continue;
+        std::swap(rows[r], rows[rank]);
+        for (size_t i = 0; i < rows.size(); ++i) {
+            if (i != rank && (rows[i].coefficients & bit)) {
+                rows[i].coefficients ^= rows[rank].coefficients;
+                rows[i].rhs ^= rows[rank].rhs;
+            }
+        }
+        pivotRow[col] = int(rank++);
+    }
+    for (size_t r = rank; r < rows.size(); ++r) {
+        if (rows[r].rhs)
+            return false;
+    }
+
+    *solution = 0;
+    for (int col = 0; col < width; ++col) {
+        if (pivotRow[col] >= 0 && rows[pivotRow[col]].rhs)
+            *solution |= quint64(1) << col;
+    }
+    *underdetermined = int(rank) < width;
+    return true;
+}
+
+bool coveredRange(int frameSize, int crcBytes, const CrcSolver::Settings &settings, int *from, int *to)
+{
+    // Same convention as FrameValidator
+    const int body = frameSize - crcBytes;
+    *from = settings.from < 0 ? body + settings.from : settings.from;
+    *to = settings.to < 0 ? body + settings.to : settings.to;
+    return body > 0 && *from >= 0 && *to >= *from && *to < body;
+}
+
+} // namespace
+
+struct CrcSolver::Variant
+{
+    int width;
+    int crcBytes;
+    bool refin;
+    bool refout;
+    bool bigEndian;
+    QList<QByteArray> frames;
+    Settings settings;
+
+    // Filled in by solveVariant()
+    QList<QByteArray> covered;      ///< Bytes under the CRC, as captured
+    QList<quint64> received;        ///< CRC field value
+    QList<QByteArray> messages;     ///< covered, bit-reversed per byte if refin
+    QList<quint64> registers;       ///< received, reflected if refout
+    Poly gcd;
+    bool searchQuotient = false;    ///< Enumerate the cofactor instead of the polynomial
+    int searchDegree = 0;
+};
+
+CrcSolver::CrcSolver(QObject *parent) :
+    QObject(parent)
+{
+    m_pool.setMaxThreadCount(QThread::idealThreadCount());
+}
+
+CrcSolver::~CrcSolver()
+{
+    cancel();
+    m_pool.waitForDone();
+}
+
+bool CrcSolver::solve(const QList<QByteArray> &frames, const Settings &settings, QString *errorMessage)
+{
+    // Tasks of a previous search see the new generation and return at once
+    cancel();
+    m_pool.waitForDone();
+
+    {
+        QMutexLocker locker(&m_mutex);
+        m_candidates.clear();
+        m_seen.clear();
+        m_notes.clear();
+    }
+    m_tasksDone = 0;
+    m_tasksTotal = 0;
+    m_timer.start();
+
+    if (frames.size() < 2) {
+        if (errorMessage)
+            *errorMessage = "At least two frames are needed";
+        return false;
+    }
+
+    const QList<int> widths = settings.width > 0 ? QList<int>{settings.width} : QList<int>{8, 16, 24, 32, 64};
+    QList<std::shared_ptr<Variant>> variants;
+    for (int width : widths) {
+        const int crcBytes = (width + 7) / 8;
+        bool fits = true;
+        for (int i = 0; i < frames.size() && fits; ++i) {
+            int from, to;
+            fits = coveredRange(int(frames[i].size()), crcBytes, settings, &from, &to);
+            if (!fits && settings.width > 0 && errorMessage)
+                *errorMessage = QString("Frame %1 is too short for a %2-bit CRC over the selected bytes")
+                                    .arg(i + 1).arg(width);
+        }
+        if (!fits)
+            continue;
+
+        for (int reflection = 0; reflection < 4; ++reflection) {
+            for (int order = 0; order < (crcBytes > 1 ? 2 : 1); ++order) {
+                auto variant = std::make_shared<Variant>();
+                variant->width = width;
+                variant->crcBytes = crcBytes;
+                variant->refin = reflection & 1;
+                variant->refout = reflection & 2;
+                variant->bigEndian = order == 0;
+                variant->frames = frames;
+                variant->settings = settings;
+                variants.append(variant);
+            }
+        }
+    }
+
+    if (variants.isEmpty()) {
+        if (errorMessage && errorMessage->isEmpty())
+            *errorMessage = "The frames are too short for the selected CRC position";
+        return false;
+    }
+
+    // Hold the batch open until every variant is queued, or a variant that
+    // returns at once could bring m_pending to 0 and finish it early
+    const quint64 generation = m_generation.load();
+    ++m_pending;
+    for (const std::shared_ptr<Variant> &variant : variants)
+        submit([this, variant, generation]() { solveVariant(variant, generation); });
+    release();
+    return true;
+}
+
+void CrcSolver::cancel()
+{
+    ++m_generation;
+}
+
+CrcSolver::Candidate CrcSolver::candidate(int index) const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_candidates.value(index);
+}
+
+void CrcSolver::submit(const std::function<void()> &task)
+{
+    ++m_pending;
+    ++m_tasksTotal;
+    m_pool.start([this, task]() {
+        task();
+        emit progress(++m_tasksDone, m_tasksTotal.load());
+        release();
+    });
+}
+
+/**
+ * @brief Drops one pending count; the last one reports the result.
+ */
+void CrcSolver::release()
+{
+    if (--m_pending == 0) {
+        int count;
+        QString note;
+        {
+            QMutexLocker locker(&m_mutex);
+            count = int(m_candidates.size());
+            note = m_notes.join('\n');
+        }
+        emit finished(count, m_timer.elapsed(), note);
+    }
+}
+
+void CrcSolver::solveVariant(const std::shared_ptr<Variant> &variant, quint64 generation)
+{
+    if (m_generation.load() != generation)
+        return;
+
+    Variant &v = *variant;
+    const int w = v.width;
+    const quint64 mask = widthMask(w);
+    for (const QByteArray &frame : v.frames) {
+        int from, to;
+        coveredRange(int(frame.size()), v.crcBytes, v.settings, &from, &to);
+        const QByteArray covered = frame.mid(from, to - from + 1);
+
+        const uchar *p = reinterpret_cast<const uchar *>(frame.constData()) + frame.size() - v.crcBytes;
+        quint64 value = 0;
+        for (int i = 0; i < v.crcBytes; ++i)
+            value |= quint64(p[i]) << (v.bigEndian ? 8 * (v.crcBytes - 1 - i) : 8 * i);
+        if (value & ~mask)
+            return;     // Bits above the width are set: not this width / byte order
+
+        QByteArray message = covered;
+        if (v.refin) {
+            for (char &c : message)
+                c = char(reflect(uchar(c), 8));
+        }
+        v.covered.append(covered);
+        v.received.append(value);
+        v.messages.append(message);
+        v.registers.append(v.refout ? reflect(value, w) : value);
+    }
+
+    // XOR of two equal-length frames: init and xorout cancel, so the
+    // polynomial divides M(x)·x^w + C(x). Fold such differences into a GCD.
+    QHash<int, int> lastOfLength;
+    Poly g;
+    int pairs = 0;
+    for (int i = 0; i < v.messages.size() && pairs < MAX_PAIRS; ++i) {
+        const QByteArray &m = v.messages[i];
+        const auto it = lastOfLength.constFind(int(m.size()));
+        if (it != lastOfLength.constEnd()) {
+            const QByteArray &other = v.messages[*it];
+            Poly d((size_t(m.size()) * 8 + w) / 64 + 2, 0);
+            const int n = int(m.size());
+            for (int k = 0; k < n; ++k) {
+                const uchar b = uchar(m[k] ^ other[k]);
+                if (!b)
+                    continue;
+                const int shift = 8 * (n - 1 - k) + w;
+                for (int bit = 0; bit < 8; ++bit) {
+                    if ((b >> bit) & 1)
+                        d[(shift + bit) / 64] ^= quint64(1) << ((shift + bit) % 64);
+                }
+            }
+            d[0] ^= v.registers[i] ^ v.registers[*it];
+            trim(d);
+            if (degree(d) >= 0) {
+                g = g.empty() ? std::move(d) : gcd(std::move(g), std::move(d));
+                ++pairs;
+                if (degree(g) <= w)
+                    break;
+            }
+        }
+        lastOfLength[int(m.size())] = i;
+    }
+
+    if (pairs == 0) {
+        addNote("Needs at least two different frames whose covered bytes have the same length.");
+        return;
+    }
+
+    const int dg = degree(g);
+    if (dg < w)
+        return;     // No polynomial of this width fits
+    if (dg == w) {
+        tryPolynomial(v, g[0] & mask);
+        return;
+    }
+
+    // The GCD still carries extra factors: enumerate divisors of degree w,
+    // or their cofactors if those are smaller.
+    v.searchQuotient = dg - w < w;
+    v.searchDegree = v.searchQuotient ? dg - w : w;
+    const double cost = double(quint64(1) << qMin(v.searchDegree, 62)) * dg;
+    if (v.searchDegree > 40 || cost > MAX_SEARCH_COST) {
+        addNote(QString("%1-bit: too few frames to pin the polynomial down. "
+                        "Add frames of the same length with different contents.").arg(w));
+        return;
+    }
+    v.gcd = std::move(g);
+
+    const quint64 total = quint64(1) << v.searchDegree;
+    const quint64 chunks = qMin<quint64>(CHUNKS_PER_SEARCH, qMax<quint64>(1, total >> 12));
+    const std::shared_ptr<const Variant> search = variant;
+    for (quint64 c = 0; c < chunks; ++c) {
+        const quint64 first = total * c / chunks;
+        const quint64 last = total * (c + 1) / chunks;
+        submit([this, search, first, last, generation]() { searchDivisors(search, first, last, generation); });
+    }
+}
+
+void CrcSolver::searchDivisors(const std::shared_ptr<const Variant> &variant, quint64 first, quint64 last,
+                               quint64 generation)
+{
+    const Variant &v = *variant;
+    const int w = v.width;
+    for (quint64 c = first; c < last; ++c) {
+        if ((c & 0xFFF) == 0 && m_generation.load() != generation)
+            return;
+        if (remainder(v.gcd, v.searchDegree, c) != 0)
+            continue;
+        if (!v.searchQuotient) {
+            tryPolynomial(v, c);
+            continue;
+        }
+        Poly q(size_t(v.searchDegree / 64 + 1), 0);
+        q[0] = c;
+        q[v.searchDegree / 64] |= quint64(1) << (v.searchDegree % 64);
+        const Poly p = divide(v.gcd, q);
+        if (degree(p) == w)
+            tryPolynomial(v, p[0] & widthMask(w));
+    }
+}
+
+void CrcSolver::tryPolynomial(const Variant &v, quint64 poly)
+{
+    const int w = v.width;
+
+    // Register = M(x)·x^w mod P ^ init·x^(8n) mod P, so for each covered
+    // length n, register ^ crcRegister(M) is the same constant K_n.
+    QMap<int, quint64> constants;
+    for (int i = 0; i < v.messages.size(); ++i) {
+        const int n = int(v.messages[i].size());
+        const quint64 k = v.registers[i] ^ crcRegister(v.messages[i], w, poly);
+        const auto it = constants.constFind(n);
+        if (it == constants.constEnd())
+            constants.insert(n, k);
+        else if (*it != k)
+            return;
+    }
+
+    // K_n ^ K_m = (x^(8n) + x^(8m))·init mod P separates init from xorout
+    const int n0 = constants.firstKey();
+    const quint64 k0 = constants.first();
+    const std::vector<quint64> columns0 = initColumns(n0, w, poly);
+    std::vector<Equation> rows;
+    for (auto it = std::next(constants.constBegin()); it != constants.constEnd(); ++it) {
+        const std::vector<quint64> columns = initColumns(it.key(), w, poly);
+        const quint64 rhs = it.value() ^ k0;
+        for (int r = 0; r < w; ++r) {
+            Equation e{0, bool((rhs >> r) & 1)};
+            for (int j = 0; j < w; ++j) {
+                if (((columns[j] ^ columns0[j]) >> r) & 1)
+                    e.coefficients |= quint64(1) << j;
+            }
+            rows.push_back(e);
+        }
+    }
+
+    quint64 init = 0;
+    bool ambiguous = true;
+    if (!rows.empty() && !solveLinear(rows, w, &init, &ambiguous))
+        return;
+
+    const quint64 x = k0 ^ applyColumns(columns0, init);
+    const quint64 xorout = v.refout ? reflect(x, w) : x;
+
+    auto fits = [&v](const Crc::Model &model) {
+        const Crc::Engine engine(model);
+        for (int i = 0; i < v.covered.size(); ++i) {
+            if (engine.compute(v.covered[i].constData(), v.covered[i].size()) != v.received[i])
+                return false;
+        }
+        return true;
+    };
+
+    // Prefer catalogue names; with one frame length they also settle init
+    bool named = false;
+    for (int i = 0; i < Crc::modelCount(); ++i) {
+        const Crc::Model &m = Crc::model(i);
+        if (m.width == w && m.poly == poly && m.refin == v.refin && m.refout == v.refout && fits(m)) {
+            addCandidate({m, v.bigEndian, false});
+            named = true;
+        }
+    }
+    if (named)
+        return;
+
+    Crc::Model model{nullptr, w, poly, init, v.refin, v.refout, xorout, 0};
+    if (!fits(model))
+        return;
+    model.check = Crc::Engine(model).compute("123456789", 9);
+    addCandidate({model, v.bigEndian, ambiguous});
+}
+
+bool CrcSolver::addCandidate(const Candidate &candidate)
+{
+    const Crc::Model &m = candidate.model;
+    const QByteArray key = QByteArray::number(m.width) + '/' + QByteArray::number(m.poly, 16) + '/'
+                           + QByteArray::number(m.init, 16) + '/' + QByteArray::number(m.xorout, 16) + '/'
+                           + char('0' + m.refin) + char('0' + m.refout) + char('0' + candidate.bigEndian);
+    int index;
+    {
+        QMutexLocker locker(&m_mutex);
+        if (m_seen.contains(key))
+            return false;
+        m_seen.insert(key);
+        index = int(m_candidates.size());
+        m_candidates.append(candidate);
+    }
+    emit candidateFound(index);
+    return true;
+}
+
+void CrcSolver::addNote(const QString &note)
+{
+    QMutexLocker locker(&m_mutex);
+    if (!m_notes.contains(note))
+        m_notes.append(note);
+}
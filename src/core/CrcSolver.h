@@ -0,0 +1,123 @@
+/**
+ * @file CrcSolver.h
+ * @brief Recovers CRC parameters from captured frames.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * Given frames that end in an unknown CRC, the solver searches width,
+ * polynomial, init, xorout, reflection and CRC byte order.
+ *
+ * The search is algebraic rather than exhaustive. For two frames of the
+ * same length, XORing them cancels init and xorout, and the polynomial
+ * must divide M(x)·x^w + C(x), where M is the XOR of the covered bytes
+ * and C the XOR of the CRCs. The GCD of several such differences is
+ * usually the polynomial itself. Only when it is not are its divisors
+ * enumerated, from whichever side is smaller. Init and xorout then follow
+ * from a linear system over frames of different lengths.
+ *
+ * Every (width, reflection, byte order) variant runs as its own task on a
+ * private thread pool, and large divisor enumerations are split further.
+ * Signals are emitted from worker threads.
+ */
+
+#ifndef CRCSOLVER_H
+#define CRCSOLVER_H
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QList>
+#include <QMutex>
+#include <QObject>
+#include <QSet>
+#include <QStringList>
+#include <QThreadPool>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+#include "CrcModel.h"
+
+class CrcSolver : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Settings {
+        int width = 0;          ///< 1..64, or 0 to try 8, 16, 24, 32 and 64
+        int from = 0;           ///< First covered byte; negative counts from the CRC back
+        int to = -1;            ///< Last covered byte; negative counts from the CRC back
+    };
+
+    struct Candidate {
+        Crc::Model model;       ///< name is the catalogue name, or nullptr for an unlisted CRC
+        bool bigEndian = true;  ///< CRC byte order in the frame
+        bool initAmbiguous = false; ///< Init could not be separated from xorout; other pairs fit too
+    };
+
+    explicit CrcSolver(QObject *parent = nullptr);
+
+    /**
+     * @brief Cancels a running search and waits for the workers.
+     */
+    ~CrcSolver() override;
+
+    /**
+     * @brief Starts a search over @p frames (each ending in its CRC).
+     * @return false if the frames cannot be searched (fewer than two, too
+     *         short for every width); @p errorMessage says why.
+     */
+    bool solve(const QList<QByteArray> &frames, const Settings &settings, QString *errorMessage = nullptr);
+
+    /**
+     * @brief Abandons the running search; finished() still follows.
+     */
+    void cancel();
+
+    bool isBusy() const { return m_pending.load() > 0; }
+
+    /**
+     * @brief Candidate @p index, as announced by candidateFound(). Any thread.
+     */
+    Candidate candidate(int index) const;
+
+signals:
+    void candidateFound(int index);
+    void progress(int tasksDone, int tasksTotal);
+
+    /**
+     * @brief The search is over.
+     * @param note Why nothing could be found for some variants, or empty
+     */
+    void finished(int candidates, qint64 elapsedMs, const QString &note);
+
+private:
+    struct Variant;
+
+    void submit(const std::function<void()> &task);
+    void release();
+    void solveVariant(const std::shared_ptr<Variant> &variant, quint64 generation);
+    void searchDivisors(const std::shared_ptr<const Variant> &variant, quint64 first, quint64 last,
+                        quint64 generation);
+    void tryPolynomial(const Variant &variant, quint64 poly);
+    bool addCandidate(const Candidate &candidate);
+    void addNote(const QString &note);
+
+    QThreadPool m_pool;
+    std::atomic<quint64> m_generation{0};
+    std::atomic<int> m_pending{0};
+    std::atomic<int> m_tasksDone{0};
+    std::atomic<int> m_tasksTotal{0};
+    QElapsedTimer m_timer;
+
+    mutable QMutex m_mutex;
+    QList<Candidate> m_candidates;
+    QSet<QByteArray> m_seen;
+    QStringList m_notes;
+};
+
+#endif // CRCSOLVER_H
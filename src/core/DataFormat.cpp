@@ -0,0 +1,83 @@
+/**
+ * @file DataFormat.cpp
+ * @brief Implementation of the shared hex / ASCII formatting helpers.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "DataFormat.h"
+
+static const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+// ASCII control character mnemonics, indexed by byte value 0x00-0x1F
+static const char *const CONTROL_MNEMONICS[32] = {
+    "NUL",  "SOH",  "STX",  "ETX",  "EOT",  "ENQ",  "ACK",  "BEL",
+    "BS",   "TAB",  "LF",   "VT",   "FF",   "CR",   "SO",   "SI",
+    "DLE",  "DC1",  "DC2",  "DC3",  "DC4",  "NAK",  "SYN",  "ETB",
+    "CAN",  "EM",   "SUB",  "ESC",  "FS",   "GS",   "RS",   "US",
+};
+
+namespace DataFormat {
+
+void appendHex(QByteArray &out, const QByteArray &data)
+{
+    if (data.isEmpty())
+        return;
+
+    const qsizetype start = out.size();
+    out.resize(start + data.size() * 3 - 1);
+    char *dst = out.data() + start;
+    const uchar *src = reinterpret_cast<const uchar *>(data.constData());
+
+    for (qsizetype i = 0; i < data.size(); ++i) {
+        if (i > 0)
+            *dst++ = ' ';
+        *dst++ = HEX_DIGITS[src[i] >> 4];
+        *dst++ = HEX_DIGITS[src[i] & 0x0F];
+    }
+}
+
+void appendAsciiWithMnemonics(QByteArray &out, const QByteArray &data, bool htmlEscape)
+{
+    // "<" and ">" of the mnemonics themselves need escaping in HTML
+    const char *open = htmlEscape ? "&lt;" : "<";
+    const char *close = htmlEscape ? "&gt;" : ">";
+
+    out.reserve(out.size() + data.size() * 2);
+
+    for (char ch : data) {
+        const uchar c = static_cast<uchar>(ch);
+
+        if (c < 0x20) {
+            out.append(open).append(CONTROL_MNEMONICS[c]).append(close);
+        } else if (c == 0x7F) {
+            out.append(open).append("DEL").append(close);
+        } else if (c > 0x7F) {
+            out.append(open);
+            out.append(HEX_DIGITS[c >> 4]);
+            out.append(HEX_DIGITS[c & 0x0F]);
+            out.append(close);
+        } else if (htmlEscape && (c == '<' || c == '>' || c == '&' || c == '"')) {
+            switch (c) {
+            case '<': out.append("&lt;"); break;
+            case '>': out.append("&gt;"); break;
+            case '&': out.append("&amp;"); break;
+            default:  out.append("&quot;"); break;
+            }
+        } else {
+            out.append(ch);
+        }
+    }
+}
+
+QString asciiWithMnemonics(const QByteArray &data)
+{
+    QByteArray out;
+    appendAsciiWithMnemonics(out, data, false);
+    return QString::fromLatin1(out);
+}
+
+} // namespace DataFormat
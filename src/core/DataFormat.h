@@ -0,0 +1,43 @@
+/**
+ * @file DataFormat.h
+ * @brief Allocation-light hex / ASCII formatting shared by the UI and loggers.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * The append* functions write straight into a caller-owned QByteArray so a
+ * background writer can format thousands of records into one buffer without
+ * creating intermediate QStrings.
+ */
+
+#ifndef DATAFORMAT_H
+#define DATAFORMAT_H
+
+#include <QByteArray>
+#include <QString>
+
+namespace DataFormat {
+
+/**
+ * @brief Appends upper-case hex separated by spaces ("0A 1B FF").
+ */
+void appendHex(QByteArray &out, const QByteArray &data);
+
+/**
+ * @brief Appends printable ASCII, control characters as mnemonics (<CR>, <LF>)
+ *        and high bytes as <XX>.
+ * @param htmlEscape Escape &, <, > and " for embedding in HTML.
+ */
+void appendAsciiWithMnemonics(QByteArray &out, const QByteArray &data, bool htmlEscape = false);
+
+/**
+ * @brief Convenience wrapper returning the mnemonic form as a QString.
+ */
+QString asciiWithMnemonics(const QByteArray &data);
+
+} // namespace DataFormat
+
+#endif // DATAFORMAT_H
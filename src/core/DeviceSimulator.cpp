@@ -0,0 +1,647 @@
+/**
+ * @file DeviceSimulator.cpp
+ * @brief Implementation of the table-driven device simulator.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "DeviceSimulator.h"
+#include "Checksum.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonParseError>
+#include <QMutexLocker>
+#include <QObject>
+#include <QTimer>
+
+#include <algorithm>
+
+namespace {
+
+int hexValue(QChar c)
+{
+    const ushort u = c.unicode();
+    if (u >= '0' && u <= '9') return u - '0';
+    if (u >= 'a' && u <= 'f') return u - 'a' + 10;
+    if (u >= 'A' && u <= 'F') return u - 'A' + 10;
+    return -1;
+}
+
+bool fail(QString *errorMessage, const QString &message)
+{
+    if (errorMessage)
+        *errorMessage = message;
+    return false;
+}
+
+/**
+ * @brief Reads two hex digits at @p i.
+ */
+bool readHexByte(const QString &text, int &i, QByteArray &out, QString *errorMessage)
+{
+    const int hi = hexValue(text.at(i));
+    const int lo = i + 1 < text.size() ? hexValue(text.at(i + 1)) : -1;
+    if (hi < 0 || lo < 0)
+        return fail(errorMessage, QString("expected two hex digits at column %1").arg(i + 1));
+    out.append(char(hi << 4 | lo));
+    i += 2;
+    return true;
+}
+
+/**
+ * @brief Reads a "quoted" string starting at @p i (on the opening quote).
+ */
+bool readQuoted(const QString &text, int &i, QByteArray &out, QString *errorMessage)
+{
+    const int start = i++;
+    while (i < text.size()) {
+        QChar c = text.at(i++);
+        if (c == '"')
+            return true;
+        if (c != '\\') {
+            if (c.unicode() > 0xFF)
+                return fail(errorMessage, QString("non-Latin-1 character at column %1").arg(i));
+            out.append(char(c.unicode()));
+            continue;
+        }
+        if (i >= text.size())
+            break;
+        c = text.at(i++);
+        switch (c.unicode()) {
+        case 'r': out.append('\r'); break;
+        case 'n': out.append('\n'); break;
+        case 't': out.append('\t'); break;
+        case '0': out.append('\0'); break;
+        case '\\': out.append('\\'); break;
+        case '"': out.append('"'); break;
+        case 'x':
+            if (i >= text.size() || !readHexByte(text, i, out, errorMessage))
+                return fail(errorMessage, QString("bad \\x escape at column %1").arg(i));
+            break;
+        default:
+            return fail(errorMessage, QString("unknown escape \\%1 at column %2").arg(c).arg(i));
+        }
+    }
+    return fail(errorMessage, QString("unterminated string at column %1").arg(start + 1));
+}
+
+bool isSeparator(QChar c)
+{
+    return c.isSpace() || c == ',';
+}
+
+} // namespace
+
+// --- Definition compiler ---
+
+bool DeviceSimulator::parseBytes(const QString &text, bool allowWildcards, QByteArray &bytes,
+                                 QByteArray *mask, QString *errorMessage)
+{
+    bytes.clear();
+    if (mask)
+        mask->clear();
+
+    int i = 0;
+    while (i < text.size()) {
+        const QChar c = text.at(i);
+        const int before = bytes.size();
+        if (isSeparator(c)) {
+            ++i;
+            continue;
+        } else if (c == '"') {
+            if (!readQuoted(text, i, bytes, errorMessage))
+                return false;
+        } else if (c == '?' && allowWildcards) {
+            if (i + 1 >= text.size() || text.at(i + 1) != '?')
+                return fail(errorMessage, QString("expected ?? at column %1").arg(i + 1));
+            bytes.append('\0');
+            i += 2;
+            if (mask)
+                mask->append('\0');
+            continue;
+        } else if (!readHexByte(text, i, bytes, errorMessage)) {
+            return false;
+        }
+        if (mask)
+            mask->append(QByteArray(bytes.size() - before, char(0xFF)));
+    }
+    return true;
+}
+
+bool DeviceSimulator::parseReply(const QString &text, const Definition &def,
+                                 QVector<Field> &fields, QString *errorMessage)
+{
+    fields.clear();
+    QByteArray literal;
+    auto flushLiteral = [&]() {
+        if (literal.isEmpty())
+            return;
+        Field f;
+        f.bytes = literal;
+        fields.append(f);
+        literal.clear();
+    };
+
+    int i = 0;
+    while (i < text.size()) {
+        const QChar c = text.at(i);
+        if (isSeparator(c)) {
+            ++i;
+        } else if (c == '"') {
+            if (!readQuoted(text, i, literal, errorMessage))
+                return false;
+        } else if (c == '{') {
+            const int close = text.indexOf('}', i);
+            if (close < 0)
+                return fail(errorMessage, QString("unterminated field at column %1").arg(i + 1));
+            const QString spec = text.mid(i + 1, close - i - 1).trimmed();
+            const QStringList parts = spec.split(':');
+            const QString kind = parts.first().toLower();
+            const QString where = QString(" at column %1").arg(i + 1);
+
+            Field f;
+            bool ok = true;
+            if (kind == "req" && (parts.size() == 2 || parts.size() == 3)) {
+                f.kind = Field::Request;
+                f.offset = parts.at(1).toInt(&ok);
+                if (ok && parts.size() == 3)
+                    f.count = parts.at(2).toInt(&ok);
+                if (!ok || f.count < 1)
+                    return fail(errorMessage, QString("bad {%1}%2").arg(spec, where));
+            } else if (kind == "counter" && (parts.size() == 2 || parts.size() == 3)) {
+                f.kind = Field::Counter;
+                f.counter = def.counterNames.indexOf(parts.at(1));
+                if (f.counter < 0)
+                    return fail(errorMessage, QString("unknown counter '%1'%2").arg(parts.at(1), where));
+                const QString format = parts.size() == 3 ? parts.at(2).toLower() : QString("u8");
+                if (format == "u8") {
+                    f.width = 1;
+                } else if (format == "u16be" || format == "u16le") {
+                    f.width = 2;
+                } else if (format == "u32be" || format == "u32le") {
+                    f.width = 4;
+                } else {
+                    return fail(errorMessage, QString("unknown counter format '%1'%2").arg(format, where));
+                }
+                f.bigEndian = !format.endsWith("le");
+            } else if (Checksum::algorithms().contains(kind.toUpper()) && parts.size() <= 2) {
+                f.kind = Field::Check;
+                f.algorithm = kind.toUpper();
+                if (parts.size() == 2)
+                    f.offset = parts.at(1).toInt(&ok);
+                if (!ok || f.offset < 0)
+                    return fail(errorMessage, QString("bad {%1}%2").arg(spec, where));
+            } else {
+                return fail(errorMessage, QString("unknown field {%1}%2").arg(spec, where));
+            }
+            flushLiteral();
+            fields.append(f);
+            i = close + 1;
+        } else if (!readHexByte(text, i, literal, errorMessage)) {
+            return false;
+        }
+    }
+    flushLiteral();
+    return true;
+}
+
+bool DeviceSimulator::parseAction(const QJsonObject &json, const Definition &def,
+                                  const QHash<QString, int> &stateIndex, int stateDelayMs,
+                                  Action &action, QString *errorMessage)
+{
+    const QString reply = json.value("reply").toString();
+    QString error;
+    if (!parseReply(reply, def, action.reply, &error))
+        return fail(errorMessage, "reply: " + error);
+    action.hasReply = !action.reply.isEmpty();
+
+    if (json.contains("next")) {
+        const QString next = json.value("next").toString();
+        if (!stateIndex.contains(next))
+            return fail(errorMessage, QString("unknown next state '%1'").arg(next));
+        action.next = stateIndex.value(next);
+    }
+
+    action.delayMs = json.value("delayMs").toInt(stateDelayMs);
+    if (action.delayMs < 0)
+        return fail(errorMessage, "delayMs must not be negative");
+
+    const QJsonArray increments = json.value("increment").toArray();
+    for (const QJsonValue &value : increments) {
+        const int counter = def.counterNames.indexOf(value.toString());
+        if (counter < 0)
+            return fail(errorMessage, QString("unknown counter '%1'").arg(value.toString()));
+        action.increments.append(counter);
+    }
+    return true;
+}
+
+bool DeviceSimulator::compile(const QJsonObject &json, Definition &def, QString *errorMessage)
+{
+    QString error;
+    def.name = json.value("name").toString("Simulator");
+
+    const QJsonObject counters = json.value("counters").toObject();
+    for (auto it = counters.constBegin(); it != counters.constEnd(); ++it) {
+        def.counterNames.append(it.key());
+        def.counterInit.append(quint32(it.value().toDouble()));
+    }
+
+    // Framing
+    const QJsonObject framing = json.value("framing").toObject();
+    const QString mode = framing.value("mode").toString("chunk");
+    def.maxFrame = framing.value("maxFrame").toInt(4096);
+    if (def.maxFrame < 1)
+        return fail(errorMessage, "framing: maxFrame must be positive");
+    if (mode == "chunk") {
+        def.framing = Chunk;
+    } else if (mode == "terminator") {
+        def.framing = Terminator;
+        if (!parseBytes(framing.value("terminator").toString(), false, def.terminator, nullptr, &error))
+            return fail(errorMessage, "framing: terminator: " + error);
+        if (def.terminator.isEmpty())
+            return fail(errorMessage, "framing: terminator is empty");
+    } else if (mode == "fixed") {
+        def.framing = Fixed;
+        def.fixedLength = framing.value("length").toInt();
+        if (def.fixedLength < 1 || def.fixedLength > def.maxFrame)
+            return fail(errorMessage, "framing: length must be between 1 and maxFrame");
+    } else if (mode == "length") {
+        def.framing = LengthField;
+        def.lengthOffset = framing.value("offset").toInt();
+        def.lengthSize = framing.value("size").toInt(1);
+        def.lengthBigEndian = framing.value("endian").toString("big") != "little";
+        def.lengthAdjust = framing.value("adjust").toInt();
+        if (def.lengthOffset < 0 || (def.lengthSize != 1 && def.lengthSize != 2 && def.lengthSize != 4))
+            return fail(errorMessage, "framing: bad length field (offset >= 0, size 1, 2 or 4)");
+    } else {
+        return fail(errorMessage, QString("framing: unknown mode '%1'").arg(mode));
+    }
+
+    // Units sharing the link
+    def.unitIndex = QVector<qint16>(256, -1);
+    if (json.contains("unit")) {
+        const QJsonObject unit = json.value("unit").toObject();
+        def.unitOffset = unit.value("offset").toInt();
+        const QJsonArray ids = unit.value("ids").toArray();
+        if (def.unitOffset < 0 || ids.isEmpty())
+            return fail(errorMessage, "unit: needs an offset >= 0 and a non-empty ids list");
+        def.unitCount = 0;
+        for (const QJsonValue &value : ids) {
+            const int id = value.toInt(-1);
+            if (id < 0 || id > 255)
+                return fail(errorMessage, "unit: ids must be 0-255");
+            if (def.unitIndex[id] < 0)
+                def.unitIndex[id] = qint16(def.unitCount++);
+        }
+    } else {
+        def.unitIndex.fill(0);
+    }
+
+    // States: names first so "next" can refer forward
+    const QJsonObject states = json.value("states").toObject();
+    if (states.isEmpty())
+        return fail(errorMessage, "no states defined");
+    QHash<QString, int> stateIndex;
+    for (auto it = states.constBegin(); it != states.constEnd(); ++it)
+        stateIndex.insert(it.key(), stateIndex.size());
+
+    const QString initial = json.value("initialState").toString();
+    if (initial.isEmpty() && states.size() > 1)
+        return fail(errorMessage, "initialState is required when there are several states");
+    def.initialState = initial.isEmpty() ? 0 : stateIndex.value(initial, -1);
+    if (def.initialState < 0)
+        return fail(errorMessage, QString("unknown initialState '%1'").arg(initial));
+
+    def.states.resize(states.size());
+    for (auto it = states.constBegin(); it != states.constEnd(); ++it) {
+        const QJsonObject stateJson = it.value().toObject();
+        State &state = def.states[stateIndex.value(it.key())];
+        const int stateDelayMs = stateJson.value("delayMs").toInt(0);
+
+        const QJsonArray requests = stateJson.value("requests").toArray();
+        for (int r = 0; r < requests.size(); ++r) {
+            const QString where = QString("state '%1', request %2: ").arg(it.key()).arg(r + 1);
+            const QJsonObject request = requests.at(r).toObject();
+
+            QByteArray bytes, mask;
+            if (!parseBytes(request.value("match").toString(), true, bytes, &mask, &error))
+                return fail(errorMessage, where + "match: " + error);
+            if (bytes.isEmpty())
+                return fail(errorMessage, where + "match is empty");
+
+            Action action;
+            if (!parseAction(request, def, stateIndex, stateDelayMs, action, &error))
+                return fail(errorMessage, where + error);
+
+            Group *group = nullptr;
+            for (Group &g : state.groups) {
+                if (g.length == bytes.size() && g.mask == mask) {
+                    group = &g;
+                    break;
+                }
+            }
+            if (!group) {
+                state.groups.append(Group());
+                group = &state.groups.last();
+                group->length = bytes.size();
+                group->mask = mask;
+                group->wildcards = int(std::count(mask.cbegin(), mask.cend(), '\0'));
+            }
+            if (group->table.contains(bytes))
+                return fail(errorMessage, where + "duplicates an earlier request");
+            group->table.insert(bytes, state.actions.size());
+            state.actions.append(action);
+        }
+
+        if (stateJson.contains("default")) {
+            Action action;
+            if (!parseAction(stateJson.value("default").toObject(), def, stateIndex, stateDelayMs, action, &error))
+                return fail(errorMessage, QString("state '%1', default: %2").arg(it.key(), error));
+            state.defaultAction = state.actions.size();
+            state.actions.append(action);
+        }
+
+        std::stable_sort(state.groups.begin(), state.groups.end(),
+                         [](const Group &a, const Group &b) { return a.wildcards < b.wildcards; });
+    }
+    return true;
+}
+
+// --- Public interface ---
+
+bool DeviceSimulator::load(const QString &path, QString *errorMessage)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return fail(errorMessage, QString("Cannot open %1: %2").arg(path, file.errorString()));
+
+    QJsonParseError parseError;
+    const QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+    if (doc.isNull())
+        return fail(errorMessage, QString("%1: %2 at offset %3")
+                                      .arg(QFileInfo(path).fileName(), parseError.errorString())
+                                      .arg(parseError.offset));
+    if (!doc.isObject())
+        return fail(errorMessage, QString("%1: expected a JSON object").arg(QFileInfo(path).fileName()));
+
+    QJsonObject json = doc.object();
+    if (!json.contains("name"))
+        json.insert("name", QFileInfo(path).completeBaseName());
+    return loadDefinition(json, errorMessage);
+}
+
+bool DeviceSimulator::loadDefinition(const QJsonObject &definition, QString *errorMessage)
+{
+    // Compile outside the lock; the I/O thread keeps answering meanwhile
+    QSharedPointer<Definition> def(new Definition);
+    if (!compile(definition, *def, errorMessage))
+        return false;
+
+    QMutexLocker lock(&m_mutex);
+    m_def = def;
+    m_buffer.clear();
+    m_stats = Stats();
+    ++m_generation;
+    resetSessions();
+    m_active.store(true);
+    return true;
+}
+
+void DeviceSimulator::unload()
+{
+    QMutexLocker lock(&m_mutex);
+    m_active.store(false);
+    m_def.reset();
+    m_sessions.clear();
+    m_buffer.clear();
+    ++m_generation;
+}
+
+QString DeviceSimulator::name() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_def ? m_def->name : QString();
+}
+
+void DeviceSimulator::reset()
+{
+    QMutexLocker lock(&m_mutex);
+    m_buffer.clear();
+    ++m_generation;
+    resetSessions();
+}
+
+DeviceSimulator::Stats DeviceSimulator::stats() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_stats;
+}
+
+void DeviceSimulator::resetSessions()
+{
+    m_sessions.clear();
+    if (!m_def)
+        return;
+
+    Session initial;
+    initial.state = m_def->initialState;
+    initial.counters = m_def->counterInit;
+    m_sessions = QVector<Session>(m_def->unitCount, initial);
+}
+
+// --- Runtime ---
+
+void DeviceSimulator::process(const QByteArray &data, qint64 rxTimestampNs, QObject *context,
+                              const WriteFunction &write)
+{
+    Q_UNUSED(rxTimestampNs);
+    if (!isActive())
+        return;
+
+    QVector<Pending> due;
+    quint64 generation;
+    {
+        QMutexLocker lock(&m_mutex);
+        if (!m_def)
+            return;
+        const Definition &def = *m_def;
+        generation = m_generation;
+
+        if (def.framing == Chunk) {
+            if (data.size() > def.maxFrame)
+                ++m_stats.unmatched;
+            else
+                handleFrame(data, due);
+        } else {
+            m_buffer.append(data);
+            const char *buf = m_buffer.constData();
+            const int size = int(m_buffer.size());
+            int pos = 0;
+
+            // Cut every complete frame; the remainder waits for the next chunk
+            for (;;) {
+                const int avail = size - pos;
+                int length = 0;     // > 0 frame, 0 incomplete, < 0 bytes to skip
+                if (def.framing == Terminator) {
+                    const int end = int(m_buffer.indexOf(def.terminator, pos));
+                    if (end >= 0)
+                        length = end - pos + int(def.terminator.size());
+                    else if (avail > def.maxFrame)
+                        length = -qMax(1, avail - int(def.terminator.size()) + 1);
+                } else if (def.framing == Fixed) {
+                    if (avail >= def.fixedLength)
+                        length = def.fixedLength;
+                } else {
+                    const int header = def.lengthOffset + def.lengthSize;
+                    if (avail >= header) {
+                        quint32 value = 0;
+                        for (int i = 0; i < def.lengthSize; ++i) {
+                            const quint32 b = uchar(buf[pos + def.lengthOffset + i]);
+                            value |= def.lengthBigEndian ? b << ((def.lengthSize - 1 - i) * 8) : b << (i * 8);
+                        }
+                        const qint64 total = qint64(value) + def.lengthAdjust;
+                        if (total < header || total > def.maxFrame)
+                            length = -1;    // Not a plausible header: resync byte by byte
+                        else if (avail >= total)
+                            length = int(total);
+                    }
+                }
+
+                if (length == 0)
+                    break;
+                if (length < 0 || length > def.maxFrame) {
+                    ++m_stats.unmatched;
+                    pos += qAbs(length);
+                    continue;
+                }
+                handleFrame(QByteArray::fromRawData(buf + pos, length), due);
+                pos += length;
+            }
+            m_buffer.remove(0, pos);
+        }
+    }
+
+    // Replies go out without holding the lock
+    for (const Pending &pending : due) {
+        if (pending.delayMs > 0) {
+            const QByteArray reply = pending.reply;
+            QTimer::singleShot(pending.delayMs, Qt::PreciseTimer, context,
+                               [this, write, reply, generation]() {
+                {
+                    QMutexLocker lock(&m_mutex);
+                    if (generation != m_generation)
+                        return;     // Reloaded or reset meanwhile
+                }
+                if (write(reply)) {
+                    QMutexLocker lock(&m_mutex);
+                    ++m_stats.replies;
+                }
+            });
+        } else if (write(pending.reply)) {
+            QMutexLocker lock(&m_mutex);
+            ++m_stats.replies;
+        }
+    }
+}
+
+void DeviceSimulator::handleFrame(const QByteArray &frame, QVector<Pending> &out)
+{
+    const Definition &def = *m_def;
+
+    int sessionIndex = 0;
+    if (def.unitOffset >= 0) {
+        if (frame.size() <= def.unitOffset)
+            return;
+        sessionIndex = def.unitIndex.at(uchar(frame.at(def.unitOffset)));
+        if (sessionIndex < 0)
+            return;     // Another device on the link
+    }
+    ++m_stats.frames;
+
+    Session &session = m_sessions[sessionIndex];
+    const State &state = def.states.at(session.state);
+
+    int actionIndex = -1;
+    for (const Group &group : state.groups) {
+        if (group.length != frame.size())
+            continue;
+
+        QHash<QByteArray, int>::const_iterator it;
+        if (group.wildcards == 0) {
+            it = group.table.constFind(frame);
+        } else {
+            m_key.resize(frame.size());
+            char *key = m_key.data();
+            const char *mask = group.mask.constData();
+            for (int i = 0; i < frame.size(); ++i)
+                key[i] = char(frame.at(i) & mask[i]);
+            it = group.table.constFind(m_key);
+        }
+        if (it != group.table.constEnd()) {
+            actionIndex = it.value();
+            break;
+        }
+    }
+    if (actionIndex < 0)
+        actionIndex = state.defaultAction;
+    if (actionIndex < 0) {
+        ++m_stats.unmatched;
+        return;
+    }
+
+    const Action &action = state.actions.at(actionIndex);
+    if (action.hasReply) {
+        Pending pending;
+        render(action, frame, session, pending.reply);
+        pending.delayMs = action.delayMs;
+        out.append(pending);
+    }
+    for (int counter : action.increments)
+        ++session.counters[counter];
+    if (action.next >= 0)
+        session.state = action.next;
+}
+
+void DeviceSimulator::render(const Action &action, const QByteArray &frame,
+                             const Session &session, QByteArray &out) const
+{
+    for (const Field &f : action.reply) {
+        switch (f.kind) {
+        case Field::Literal:
+            out.append(f.bytes);
+            break;
+        case Field::Request: {
+            int start = f.offset < 0 ? int(frame.size()) + f.offset : f.offset;
+            int count = f.count;
+            if (start < 0) {
+                count += start;
+                start = 0;
+            }
+            if (count > 0 && start < frame.size())
+                out.append(frame.constData() + start, qMin<int>(count, int(frame.size()) - start));
+            break;
+        }
+        case Field::Counter: {
+            const quint32 value = session.counters.at(f.counter);
+            for (int i = 0; i < f.width; ++i) {
+                const int shift = f.bigEndian ? (f.width - 1 - i) * 8 : i * 8;
+                out.append(char((value >> shift) & 0xFF));
+            }
+            break;
+        }
+        case Field::Check: {
+            const int from = qMin<int>(f.offset, int(out.size()));
+            const QByteArray covered = QByteArray::fromRawData(out.constData() + from, out.size() - from);
+            out.append(Checksum::calculate(covered, f.algorithm));
+            break;
+        }
+        }
+    }
+}
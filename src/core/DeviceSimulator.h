@@ -0,0 +1,214 @@
+/**
+ * @file DeviceSimulator.h
+ * @brief Table-driven device emulation answered on the handler's I/O thread.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * A simulator is a state machine loaded from a JSON file. Received data is
+ * cut into frames; each frame is looked up in the current state's request
+ * table and the matching entry's reply is rendered and written straight
+ * back from the I/O thread, like AutoResponder replies. Requests of the
+ * same length and wildcard layout share one hash table keyed by the masked
+ * frame, so a lookup costs one hash of the frame however many requests a
+ * state has.
+ *
+ * @code
+ * {
+ *   "name": "Flow meter",
+ *   "framing": { "mode": "length", "offset": 2, "size": 1, "adjust": 5 },
+ *   "unit": { "offset": 0, "ids": [1, 2, 3] },
+ *   "counters": { "seq": 0 },
+ *   "initialState": "idle",
+ *   "states": {
+ *     "idle": {
+ *       "delayMs": 2,
+ *       "requests": [
+ *         { "match": "?? 10 00 ?? ??", "reply": "{req:0} 90 {counter:seq:u16be} {crc16}",
+ *           "increment": ["seq"], "next": "running" }
+ *       ],
+ *       "default": { "reply": "{req:0} FF {crc16}" }
+ *     },
+ *     "running": { ... }
+ *   }
+ * }
+ * @endcode
+ *
+ * framing.mode: "chunk" (every received chunk is a frame), "terminator"
+ * ("terminator": bytes, kept in the frame), "fixed" ("length") or "length"
+ * (a length field at "offset" of "size" 1/2/4 bytes, "endian" big|little;
+ * frame length = field + "adjust"). "maxFrame" bounds a frame (default 4096).
+ *
+ * "unit" simulates several devices sharing one link (e.g. an RS-485 bus):
+ * the byte at "offset" selects the device and each one keeps its own state
+ * and counters. Frames for other ids are ignored.
+ *
+ * "match": hex bytes, "text" and ?? for any byte. Matching is exact-length.
+ * When several entries match, the one with fewer wildcards wins; "default"
+ * answers frames no entry matches.
+ *
+ * "reply": hex bytes and "text" plus fields, rendered left to right:
+ *   {req:N} {req:N:M}    byte N / M bytes from N of the request (N < 0 counts from the end)
+ *   {counter:name[:u8|u16be|u16le|u32be|u32le]}   counter value (default u8)
+ *   {crc16[:F]} {crc32[:F]} {xor[:F]} {sum8[:F]} {lrc[:F]}
+ *   {CRC-16/XMODEM[:F]}  any model name of the CRC catalogue (CrcModel.h)
+ *                        checksum of the reply so far, from byte F (default 0)
+ * An entry without "reply" changes state silently. "increment" is applied
+ * after rendering, "next" switches state, and "delayMs" (entry, else
+ * state) delays the reply.
+ */
+
+#ifndef DEVICESIMULATOR_H
+#define DEVICESIMULATOR_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QJsonObject>
+#include <QMutex>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include <atomic>
+
+#include "RxResponder.h"
+
+class DeviceSimulator : public RxResponder
+{
+public:
+    struct Stats {
+        quint64 frames = 0;     ///< Frames addressed to a simulated device
+        quint64 replies = 0;    ///< Replies written
+        quint64 unmatched = 0;  ///< Frames with no entry and no default (or oversized)
+    };
+
+    DeviceSimulator() = default;
+
+    /**
+     * @brief Loads and compiles a simulator definition file.
+     * @return false on a read or definition error; the previous definition stays active.
+     */
+    bool load(const QString &path, QString *errorMessage = nullptr);
+
+    /**
+     * @brief Compiles a definition already parsed from JSON.
+     */
+    bool loadDefinition(const QJsonObject &definition, QString *errorMessage = nullptr);
+
+    /**
+     * @brief Drops the definition; the simulator becomes inactive.
+     */
+    void unload();
+
+    QString name() const;
+
+    bool isActive() const override { return m_active.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns every device to its initial state and counters and
+     *        drops any partial frame.
+     */
+    void reset() override;
+
+    /**
+     * @brief Frames a received chunk and answers it. I/O thread only.
+     */
+    void process(const QByteArray &data, qint64 rxTimestampNs, QObject *context,
+                 const WriteFunction &write) override;
+
+    Stats stats() const;
+
+private:
+    enum FramingMode { Chunk, Terminator, Fixed, LengthField };
+
+    struct Field {
+        enum Kind { Literal, Request, Counter, Check };
+        Kind kind = Literal;
+        QByteArray bytes;       ///< Literal bytes
+        QString algorithm;      ///< Checksum::calculate() name
+        int offset = 0;         ///< Request start / checksum start
+        int count = 1;          ///< Request byte count
+        int counter = -1;
+        int width = 1;          ///< Counter bytes
+        bool bigEndian = true;
+    };
+
+    struct Action {
+        QVector<Field> reply;
+        bool hasReply = false;
+        int next = -1;          ///< State index, -1 = stay
+        int delayMs = 0;
+        QVector<int> increments;
+    };
+
+    struct Group {
+        int length = 0;
+        QByteArray mask;        ///< FF = compare, 00 = wildcard
+        int wildcards = 0;
+        QHash<QByteArray, int> table;  ///< Masked frame -> action index
+    };
+
+    struct State {
+        QVector<Group> groups;  ///< Fewest wildcards first
+        QVector<Action> actions;
+        int defaultAction = -1;
+    };
+
+    struct Definition {
+        QString name;
+        FramingMode framing = Chunk;
+        QByteArray terminator;
+        int fixedLength = 0;
+        int lengthOffset = 0;
+        int lengthSize = 1;
+        bool lengthBigEndian = true;
+        int lengthAdjust = 0;
+        int maxFrame = 4096;
+        int unitOffset = -1;    ///< -1 = one device
+        QVector<qint16> unitIndex; ///< Unit byte -> session index, -1 = not simulated
+        int unitCount = 1;
+        QStringList counterNames;
+        QVector<quint32> counterInit;
+        QVector<State> states;
+        int initialState = 0;
+    };
+
+    struct Session {
+        int state = 0;
+        QVector<quint32> counters;
+    };
+
+    struct Pending {
+        QByteArray reply;
+        int delayMs = 0;
+    };
+
+    static bool compile(const QJsonObject &json, Definition &def, QString *errorMessage);
+    static bool parseBytes(const QString &text, bool allowWildcards, QByteArray &bytes,
+                           QByteArray *mask, QString *errorMessage);
+    static bool parseReply(const QString &text, const Definition &def, QVector<Field> &fields,
+                           QString *errorMessage);
+    static bool parseAction(const QJsonObject &json, const Definition &def,
+                            const QHash<QString, int> &stateIndex, int stateDelayMs,
+                            Action &action, QString *errorMessage);
+
+    void resetSessions();
+    void handleFrame(const QByteArray &frame, QVector<Pending> &out);
+    void render(const Action &action, const QByteArray &frame, const Session &session,
+                QByteArray &out) const;
+
+    mutable QMutex m_mutex;
+    QSharedPointer<const Definition> m_def;
+    QVector<Session> m_sessions;
+    QByteArray m_buffer;        ///< Unframed bytes carried between chunks
+    QByteArray m_key;           ///< Scratch for masked lookups
+    Stats m_stats;
+    quint64 m_generation = 0;   ///< Bumped by load/reset; late delayed replies are dropped
+    std::atomic<bool> m_active{false};
+};
+
+#endif // DEVICESIMULATOR_H
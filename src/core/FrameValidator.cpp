@@ -0,0 +1,253 @@
+/**
+ * @file FrameValidator.cpp
+ * @brief Implementation of the per-frame CRC check.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "FrameValidator.h"
+
+#include <QMutexLocker>
+
+namespace {
+
+QString framingError(const FrameValidator::Settings &s)
+{
+    if (s.maxFrame < 1)
+        return "Maximum frame length must be positive";
+    switch (s.framing) {
+    case FrameValidator::PerRead:
+        break;
+    case FrameValidator::Terminator:
+        if (s.terminator.isEmpty())
+            return "Terminator is empty";
+        break;
+    case FrameValidator::FixedLength:
+        if (s.fixedLength < 1 || s.fixedLength > s.maxFrame)
+            return "Frame length must be between 1 and the maximum frame length";
+        break;
+    case FrameValidator::LengthField:
+        if (s.lengthOffset < 0 || (s.lengthSize != 1 && s.lengthSize != 2 && s.lengthSize != 4))
+            return "Bad length field (offset >= 0, size 1, 2 or 4)";
+        break;
+    case FrameValidator::Gap:
+        if (s.gapUs < 1)
+            return "Inter-frame gap must be positive";
+        break;
+    }
+    return QString();
+}
+
+} // namespace
+
+bool FrameValidator::setSettings(const Settings &settings, QString *errorMessage)
+{
+    const Crc::Model *model = Crc::findModel(settings.model);
+    QString error = model ? framingError(settings) : QString("Unknown CRC model '%1'").arg(settings.model);
+    if (settings.enabled && !error.isEmpty()) {
+        if (errorMessage)
+            *errorMessage = error;
+    }
+
+    QMutexLocker lock(&m_mutex);
+    m_settings = settings;
+    m_engine.reset(model ? new Crc::Engine(*model) : nullptr);
+    if (model) {
+        m_littleEndian = settings.byteOrder == LittleEndian
+                         || (settings.byteOrder == ModelOrder && model->refout);
+    }
+    m_buffer.clear();
+    m_active.store(settings.enabled && error.isEmpty());
+    resetStats();
+    return !settings.enabled || error.isEmpty();
+}
+
+FrameValidator::Settings FrameValidator::settings() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_settings;
+}
+
+FrameValidator::Result FrameValidator::check(const QByteArray &frame)
+{
+    if (!isActive())
+        return NotChecked;
+
+    QMutexLocker lock(&m_mutex);
+    if (!m_engine)
+        return NotChecked;
+    const Result result = checkLocked(frame.constData(), int(frame.size()));
+    lock.unlock();
+
+    count(result);
+    return result;
+}
+
+void FrameValidator::feed(const QByteArray &data, qint64 rxTimestampNs, QVector<Frame> &frames)
+{
+    QMutexLocker lock(&m_mutex);
+    if (!isActive() || !m_engine) {
+        frames.append({data, NotChecked});
+        return;
+    }
+    const Settings &s = m_settings;
+
+    if (s.framing == PerRead) {
+        append(data.constData(), int(data.size()), checkLocked(data.constData(), int(data.size())), frames);
+        return;
+    }
+
+    if (s.framing == Gap) {
+        // The reads before this one ended a gap ago: they were a whole frame
+        if (!m_buffer.isEmpty() && rxTimestampNs - m_lastRxNs >= qint64(s.gapUs) * 1000) {
+            append(m_buffer.constData(), int(m_buffer.size()),
+                   checkLocked(m_buffer.constData(), int(m_buffer.size())), frames);
+            m_buffer.clear();
+        }
+        m_lastRxNs = rxTimestampNs;
+        m_buffer.append(data);
+        if (m_buffer.size() > s.maxFrame) {
+            append(m_buffer.constData(), int(m_buffer.size()), Unframed, frames);
+            m_buffer.clear();
+        }
+        return;
+    }
+
+    m_buffer.append(data);
+    const char *buf = m_buffer.constData();
+    const int size = int(m_buffer.size());
+    int pos = 0;
+    int skipped = -1;   // Start of the current Unframed run
+
+    // Cut every complete frame; the remainder waits for the next read
+    for (;;) {
+        const int avail = size - pos;
+        int length = 0;     // > 0 frame, 0 incomplete, < 0 bytes to skip
+        if (s.framing == Terminator) {
+            const int end = int(m_buffer.indexOf(s.terminator, pos));
+            if (end >= 0)
+                length = end - pos + int(s.terminator.size());
+            else if (avail > s.maxFrame)
+                length = -qMax(1, avail - int(s.terminator.size()) + 1);
+        } else if (s.framing == FixedLength) {
+            if (avail >= s.fixedLength)
+                length = s.fixedLength;
+        } else {
+            const int header = s.lengthOffset + s.lengthSize;
+            if (avail >= header) {
+                quint32 value = 0;
+                for (int i = 0; i < s.lengthSize; ++i) {
+                    const quint32 b = uchar(buf[pos + s.lengthOffset + i]);
+                    value |= s.lengthBigEndian ? b << ((s.lengthSize - 1 - i) * 8) : b << (i * 8);
+                }
+                const qint64 total = qint64(value) + s.lengthAdjust;
+                if (total < header || total > s.maxFrame)
+                    length = -1;    // Not a plausible header: resync byte by byte
+                else if (avail >= total)
+                    length = int(total);
+            }
+        }
+
+        if (length < 0 || length > s.maxFrame) {
+            if (skipped < 0)
+                skipped = pos;
+            pos += qAbs(length);
+            continue;
+        }
+        if (skipped >= 0) {
+            append(buf + skipped, pos - skipped, Unframed, frames);
+            skipped = -1;
+        }
+        if (length == 0)
+            break;
+        // The terminator follows the CRC
+        const int checked = s.framing == Terminator ? length - int(s.terminator.size()) : length;
+        append(buf + pos, length, checkLocked(buf + pos, checked), frames);
+        pos += length;
+    }
+    m_buffer.remove(0, pos);
+}
+
+bool FrameValidator::flushIdle(qint64 nowNs, QVector<Frame> &frames)
+{
+    QMutexLocker lock(&m_mutex);
+    if (!isActive() || !m_engine || m_settings.framing != Gap || m_buffer.isEmpty()
+        || nowNs - m_lastRxNs < qint64(m_settings.gapUs) * 1000)
+        return false;
+    append(m_buffer.constData(), int(m_buffer.size()),
+           checkLocked(m_buffer.constData(), int(m_buffer.size())), frames);
+    m_buffer.clear();
+    return true;
+}
+
+int FrameValidator::idleDelayMs(qint64 nowNs) const
+{
+    QMutexLocker lock(&m_mutex);
+    if (!isActive() || m_settings.framing != Gap || m_buffer.isEmpty())
+        return -1;
+    const qint64 remaining = m_lastRxNs + qint64(m_settings.gapUs) * 1000 - nowNs;
+    return remaining > 0 ? int((remaining + 999999) / 1000000) : 0;
+}
+
+/**
+ * @brief CRC verdict for one frame; the caller holds m_mutex and has an engine.
+ */
+FrameValidator::Result FrameValidator::checkLocked(const char *data, int size) const
+{
+    const int crcBytes = m_engine->byteCount();
+    const int body = size - crcBytes;
+    const int from = m_settings.from < 0 ? body + m_settings.from : m_settings.from;
+    const int to = m_settings.to < 0 ? body + m_settings.to : m_settings.to;
+
+    if (body <= 0 || from < 0 || to < from || to >= body)
+        return TooShort;
+
+    const quint64 crc = m_engine->compute(data + from, to - from + 1);
+    const uchar *p = reinterpret_cast<const uchar *>(data) + body;
+    quint64 received = 0;
+    for (int i = 0; i < crcBytes; ++i) {
+        const int shift = m_littleEndian ? 8 * i : 8 * (crcBytes - 1 - i);
+        received |= quint64(p[i]) << shift;
+    }
+    return received == crc ? Passed : Failed;
+}
+
+void FrameValidator::append(const char *data, int size, Result result, QVector<Frame> &frames)
+{
+    frames.append({QByteArray(data, size), result});
+    count(result);
+}
+
+void FrameValidator::count(Result result)
+{
+    m_frames.fetch_add(1, std::memory_order_relaxed);
+    switch (result) {
+    case Passed: m_passed.fetch_add(1, std::memory_order_relaxed); break;
+    case Failed: m_failed.fetch_add(1, std::memory_order_relaxed); break;
+    case Unframed: m_unframed.fetch_add(1, std::memory_order_relaxed); break;
+    default: m_tooShort.fetch_add(1, std::memory_order_relaxed); break;
+    }
+}
+
+FrameValidator::Stats FrameValidator::stats() const
+{
+    Stats s;
+    s.frames = m_frames.load(std::memory_order_relaxed);
+    s.passed = m_passed.load(std::memory_order_relaxed);
+    s.failed = m_failed.load(std::memory_order_relaxed);
+    s.tooShort = m_tooShort.load(std::memory_order_relaxed);
+    s.unframed = m_unframed.load(std::memory_order_relaxed);
+    return s;
+}
+
+void FrameValidator::resetStats()
+{
+    m_frames.store(0);
+    m_passed.store(0);
+    m_failed.store(0);
+    m_tooShort.store(0);
+    m_unframed.store(0);
+}
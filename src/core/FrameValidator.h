@@ -0,0 +1,163 @@
+/**
+ * @file FrameValidator.h
+ * @brief Per-frame CRC check applied to received data in the handler's I/O thread.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * A tab declares "the last N bytes of every frame are CRC-X over bytes
+ * [from..to]" with setSettings(). The communication handler passes what
+ * it reads to feed(), which cuts frames and checks each one before it is
+ * emitted, so the verdict travels with the data and the GUI only colours
+ * the row. Pass/fail counters are atomics and can be read from any thread.
+ *
+ * A read is not a frame: at high rates one read holds several frames and
+ * a frame can be split across reads. The framing modes are those of the
+ * DeviceSimulator: a terminator, a fixed length, a length field, or an
+ * inter-byte gap (Modbus RTU style; the line must be quiet for gapUs).
+ * Gaps are judged from read timestamps, so they must be longer than the
+ * driver's read latency. "Per read" keeps the old behaviour for links
+ * where every read is exactly one frame (UDP datagrams).
+ */
+
+#ifndef FRAMEVALIDATOR_H
+#define FRAMEVALIDATOR_H
+
+#include <QByteArray>
+#include <QMutex>
+#include <QString>
+#include <QVector>
+
+#include <atomic>
+#include <memory>
+
+#include "CrcModel.h"
+
+class FrameValidator
+{
+public:
+    /// Verdict for one frame, as carried by AbstractCommunicationHandler::receivedData()
+    enum Result {
+        NotChecked = 0,
+        Passed = 1,
+        Failed = 2,
+        TooShort = 3,           ///< Shorter than the covered range plus the CRC
+        Unframed = 4            ///< Bytes skipped to find the next frame
+    };
+
+    enum Framing {
+        PerRead,                ///< Every read is one frame
+        Terminator,             ///< Ends with Settings::terminator, which the CRC precedes
+        FixedLength,
+        LengthField,            ///< Length = field + lengthAdjust
+        Gap                     ///< Ends when the line is quiet for Settings::gapUs
+    };
+
+    enum ByteOrder {
+        ModelOrder,             ///< Low byte first for reflected CRCs, else high byte first
+        BigEndian,
+        LittleEndian
+    };
+
+    struct Settings {
+        bool enabled = false;
+        QString model = "CRC-16/MODBUS";   ///< Crc::findModel() name or alias
+        int from = 0;           ///< First covered byte; negative counts from the CRC back
+        int to = -1;            ///< Last covered byte; negative counts from the CRC back
+        ByteOrder byteOrder = ModelOrder;
+
+        Framing framing = PerRead;
+        QByteArray terminator = QByteArray("\r\n");
+        int fixedLength = 8;
+        int lengthOffset = 0;   ///< Position of the length field
+        int lengthSize = 1;     ///< 1, 2 or 4 bytes
+        bool lengthBigEndian = true;
+        int lengthAdjust = 0;
+        int gapUs = 2000;       ///< About 3.5 characters at 19200 baud
+        int maxFrame = 4096;    ///< Longer runs are reported as Unframed
+    };
+
+    /// One frame cut by feed() and its verdict
+    struct Frame {
+        QByteArray data;
+        Result result = NotChecked;
+    };
+
+    struct Stats {
+        quint64 frames = 0;
+        quint64 passed = 0;
+        quint64 failed = 0;
+        quint64 tooShort = 0;
+        quint64 unframed = 0;
+
+        /// Failed, too-short and unframed runs per checked frame, in percent
+        double errorRate() const { return frames ? 100.0 * double(failed + tooShort + unframed) / double(frames) : 0.0; }
+    };
+
+    FrameValidator() = default;
+
+    /**
+     * @brief Applies new settings, clears the counters and drops a partial frame. GUI thread.
+     * @return false if the CRC model or the framing is invalid; checking is then disabled.
+     */
+    bool setSettings(const Settings &settings, QString *errorMessage = nullptr);
+    Settings settings() const;
+
+    /**
+     * @brief True if frames are being checked. Cheap; any thread.
+     */
+    bool isActive() const { return m_active.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Checks one frame that was cut elsewhere and counts the verdict. Any thread.
+     */
+    Result check(const QByteArray &frame);
+
+    /**
+     * @brief Cuts frames out of a read and checks each one. I/O thread only.
+     *
+     * A partial frame is kept for the next call. Bytes that cannot start
+     * a frame come out as an Unframed run, so nothing read is lost.
+     * @param rxTimestampNs RxResponder::nowNs() taken before the read
+     * @param frames Receives the completed frames, in order
+     */
+    void feed(const QByteArray &data, qint64 rxTimestampNs, QVector<Frame> &frames);
+
+    /**
+     * @brief Ends a Gap frame once the line has been quiet long enough. I/O thread only.
+     * @return false if no frame was completed
+     */
+    bool flushIdle(qint64 nowNs, QVector<Frame> &frames);
+
+    /**
+     * @brief Milliseconds until flushIdle() can end the pending Gap frame; -1 if there is none.
+     */
+    int idleDelayMs(qint64 nowNs) const;
+
+    Stats stats() const;
+    void resetStats();
+
+private:
+    mutable QMutex m_mutex;
+    Settings m_settings;
+    std::unique_ptr<Crc::Engine> m_engine;
+    bool m_littleEndian = false;
+    QByteArray m_buffer;        ///< Partial frame carried between reads
+    qint64 m_lastRxNs = 0;      ///< Time of the last read, for Gap framing
+
+    std::atomic<bool> m_active{false};
+    std::atomic<quint64> m_frames{0};
+    std::atomic<quint64> m_passed{0};
+    std::atomic<quint64> m_failed{0};
+    std::atomic<quint64> m_tooShort{0};
+    std::atomic<quint64> m_unframed{0};
+
+    Result checkLocked(const char *data, int size) const;
+    void append(const char *data, int size, Result result, QVector<Frame> &frames);
+    void count(Result result);
+};
+
+#endif // FRAMEVALIDATOR_H
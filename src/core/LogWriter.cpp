@@ -0,0 +1,571 @@
+/**
+ * @file LogWriter.cpp
+ * @brief Implementation of the background traffic log writer.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "LogWriter.h"
+#include "Crc.h"
+#include "DataFormat.h"
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QtEndian>
+#include <QMutexLocker>
+#include <QSettings>
+
+#include <chrono>
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+// The writer never sleeps longer than this, so a slow flush interval cannot
+// let the queue fill up unnoticed.
+static const int MAX_IDLE_WAIT_MS = 250;
+
+static const char HTML_HEADER[] = R"(<!DOCTYPE html>
+<html>
+<head>
+<meta charset="UTF-8">
+<title>PacketForge Log</title>
+<style>
+body { font-family: 'Consolas', monospace; background-color: #1e1e1e; color: #f0f0f0; padding: 20px; }
+.tx { color: #2196F3; }
+.rx { color: #F44336; }
+.time { color: #9E9E9E; }
+.hex { color: #4CAF50; }
+pre { margin: 2px 0; }
+</style>
+</head>
+<body>
+<h2>PacketForge Traffic Log</h2>
+<p>Started: )";
+
+// pcapng block types, options and the link type shared with the pcap export
+static const quint32 PCAPNG_SHB = 0x0A0D0D0A;
+static const quint32 PCAPNG_IDB = 0x00000001;
+static const quint32 PCAPNG_EPB = 0x00000006;
+static const quint32 PCAPNG_BYTE_ORDER_MAGIC = 0x1A2B3C4D;
+static const quint16 OPT_ENDOFOPT = 0;
+static const quint16 OPT_SHB_USERAPPL = 4;
+static const quint16 OPT_IF_NAME = 2;
+static const quint16 OPT_IF_DESCRIPTION = 3;
+static const quint16 OPT_IF_TSRESOL = 9;
+static const quint16 OPT_EPB_FLAGS = 2;
+static const quint32 EPB_FLAG_INBOUND = 1;
+static const quint32 EPB_FLAG_OUTBOUND = 2;
+static const quint16 LINKTYPE_USER0 = 147;
+
+static void appendLE16(QByteArray &out, quint16 v)
+{
+    v = qToLittleEndian(v);
+    out.append(reinterpret_cast<const char *>(&v), sizeof(v));
+}
+
+static void appendLE32(QByteArray &out, quint32 v)
+{
+    v = qToLittleEndian(v);
+    out.append(reinterpret_cast<const char *>(&v), sizeof(v));
+}
+
+static void appendPadding(QByteArray &out, qsizetype len)
+{
+    static const char zeros[4] = {0, 0, 0, 0};
+    out.append(zeros, (4 - (len & 3)) & 3);
+}
+
+static void appendOption(QByteArray &out, quint16 code, const QByteArray &value)
+{
+    appendLE16(out, code);
+    appendLE16(out, static_cast<quint16>(value.size()));
+    out.append(value);
+    appendPadding(out, value.size());
+}
+
+/**
+ * @brief Starts a block; returns its offset for finishBlock().
+ */
+static qsizetype beginBlock(QByteArray &out, quint32 type)
+{
+    const qsizetype start = out.size();
+    appendLE32(out, type);
+    appendLE32(out, 0); // total length, patched by finishBlock()
+    return start;
+}
+
+static void finishBlock(QByteArray &out, qsizetype start)
+{
+    const quint32 len = static_cast<quint32>(out.size() - start + 4);
+    qToLittleEndian(len, out.data() + start + 4);
+    appendLE32(out, len);
+}
+
+// --- gzip ---
+
+/**
+ * @brief Deflates @p data into one self-contained gzip member (RFC 1952).
+ *
+ * qCompress() emits a 4-byte length prefix, a 2-byte zlib header, the raw
+ * deflate stream and an Adler-32 trailer; the deflate stream is re-wrapped
+ * with a gzip header and CRC-32/ISIZE trailer.
+ */
+static void gzipMember(const QByteArray &data, int level, QByteArray &out)
+{
+    static const char header[10] = {'\x1f', '\x8b', 8, 0, 0, 0, 0, 0, 0, '\xff'};
+
+    const QByteArray z = qCompress(data, level);
+    out.resize(0);
+    out.append(header, sizeof(header));
+    out.append(z.constData() + 6, z.size() - 6 - 4);
+    appendLE32(out, Crc::crc32(data.constData(), data.size()));
+    appendLE32(out, static_cast<quint32>(data.size()));
+}
+
+// --- Settings ---
+
+LogWriter::Settings LogWriter::Settings::load()
+{
+    Settings s;
+    QSettings settings("PacketForge", "PacketTransmitter");
+    settings.beginGroup("Logging");
+    s.flushIntervalMs = settings.value("flushIntervalMs", s.flushIntervalMs).toInt();
+    s.flushBytes = settings.value("flushBytes", s.flushBytes).toInt();
+    s.fsyncOnFlush = settings.value("fsyncOnFlush", s.fsyncOnFlush).toBool();
+    s.rotateBytes = settings.value("rotateBytes", s.rotateBytes).toLongLong();
+    s.rotateMinutes = settings.value("rotateMinutes", s.rotateMinutes).toInt();
+    s.maxFiles = settings.value("maxFiles", s.maxFiles).toInt();
+    s.queueCapacity = settings.value("queueCapacity", s.queueCapacity).toInt();
+    s.compressionLevel = settings.value("compressionLevel", s.compressionLevel).toInt();
+    settings.endGroup();
+
+    s.flushIntervalMs = qMax(10, s.flushIntervalMs);
+    s.flushBytes = qMax(4096, s.flushBytes);
+    s.queueCapacity = qBound(1024, s.queueCapacity, 1 << 22);
+    s.compressionLevel = qBound(0, s.compressionLevel, 9);
+    return s;
+}
+
+void LogWriter::Settings::save() const
+{
+    QSettings settings("PacketForge", "PacketTransmitter");
+    settings.beginGroup("Logging");
+    settings.setValue("flushIntervalMs", flushIntervalMs);
+    settings.setValue("flushBytes", flushBytes);
+    settings.setValue("fsyncOnFlush", fsyncOnFlush);
+    settings.setValue("rotateBytes", rotateBytes);
+    settings.setValue("rotateMinutes", rotateMinutes);
+    settings.setValue("maxFiles", maxFiles);
+    settings.setValue("queueCapacity", queueCapacity);
+    settings.setValue("compressionLevel", compressionLevel);
+    settings.endGroup();
+}
+
+// --- Lifecycle (GUI thread) ---
+
+LogWriter::LogWriter(QObject *parent) : QThread(parent)
+{
+}
+
+LogWriter::~LogWriter()
+{
+    close();
+    delete m_queue;
+}
+
+bool LogWriter::open(const QString &directory, Format format, const Settings &settings,
+                     const QString &filePrefix)
+{
+    close();
+
+    QDir dir(directory);
+    if (!dir.exists())
+        dir.mkpath(".");
+
+    m_settings = settings;
+    m_format = format;
+    m_directory = dir.absolutePath();
+    m_baseName = filePrefix + "_" + QDateTime::currentDateTime().toString("yyyyMMdd_HHmmss");
+    m_userAppl = QString("%1 %2").arg(QCoreApplication::applicationName(),
+                                       QCoreApplication::applicationVersion()).toUtf8();
+    m_writtenInterfaces.clear();
+    {
+        QMutexLocker lock(&m_nameMutex);
+        m_interfaces.clear();
+    }
+    m_part = 0;
+    m_files.clear();
+    m_failed = false;
+    m_buffer.clear();
+    m_buffer.reserve(m_settings.flushBytes + 64 * 1024);
+    m_bufferedRecords = 0;
+    m_written.store(0);
+    m_dropped.store(0);
+    m_reportedWritten = 0;
+    m_reportedDropped = 0;
+
+    delete m_queue;
+    m_queue = new SpscQueue<Record>(static_cast<size_t>(m_settings.queueCapacity));
+
+    if (!openFile())
+        return false;
+
+    m_stop.store(false);
+    m_active = true;
+    start(QThread::LowPriority);
+    return true;
+}
+
+void LogWriter::close()
+{
+    if (!m_active)
+        return;
+
+    m_active = false;
+    m_stop.store(true);
+    m_wakeup.release();
+    wait();
+}
+
+int LogWriter::addInterface(const QString &name, const QString &description)
+{
+    // The writer picks new entries up lazily when it first sees their id
+    QMutexLocker lock(&m_nameMutex);
+    m_interfaces.append({name.toUtf8(), description.toUtf8()});
+    return m_interfaces.size() - 1;
+}
+
+bool LogWriter::append(bool isTx, const QByteArray &data, qint64 timestampNs, int interfaceId)
+{
+    if (!m_active)
+        return false;
+
+    Record rec;
+    rec.timestampNs = timestampNs;
+    rec.data = data;
+    rec.interfaceId = interfaceId;
+    rec.isTx = isTx;
+
+    if (!m_queue->push(std::move(rec))) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        if (m_sleeping.exchange(false))
+            m_wakeup.release();
+        return false;
+    }
+
+    // The writer wakes on its own timer; only nudge it when a backlog builds.
+    if (m_queue->size() >= m_queue->capacity() / 4 && m_sleeping.exchange(false))
+        m_wakeup.release();
+    return true;
+}
+
+QString LogWriter::currentFileName() const
+{
+    QMutexLocker lock(&m_nameMutex);
+    return m_currentPath;
+}
+
+qint64 LogWriter::currentTimestampNs()
+{
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count();
+}
+
+// --- Writer thread ---
+
+void LogWriter::run()
+{
+    Record rec;
+    m_sinceFlush.start();
+
+    for (;;) {
+        // Read the flag before draining so nothing queued before close() is lost
+        const bool stopping = m_stop.load();
+
+        while (m_queue->pop(rec)) {
+            formatRecord(rec);
+            rec.data = QByteArray();
+            if (m_buffer.size() >= m_settings.flushBytes)
+                flushBuffer();
+        }
+
+        if (!m_buffer.isEmpty() && m_sinceFlush.elapsed() >= m_settings.flushIntervalMs)
+            flushBuffer();
+
+        if (m_settings.rotateMinutes > 0
+            && m_fileAge.elapsed() >= qint64(m_settings.rotateMinutes) * 60000)
+            rotate();
+
+        if (stopping)
+            break;
+
+        int waitMs = MAX_IDLE_WAIT_MS;
+        if (!m_buffer.isEmpty())
+            waitMs = qBound<qint64>(1, m_settings.flushIntervalMs - m_sinceFlush.elapsed(), waitMs);
+
+        m_sleeping.store(true);
+        if (m_queue->isEmpty() && !m_stop.load())
+            m_wakeup.tryAcquire(1, waitMs);
+        m_sleeping.store(false);
+    }
+
+    closeFile();
+}
+
+void LogWriter::formatRecord(const Record &rec)
+{
+    if (m_format == Pcapng) {
+        appendPacketBlock(rec);
+    } else if (m_format == Html) {
+        m_buffer.append("<pre><span class=\"time\">[");
+        appendTime(rec.timestampNs);
+        m_buffer.append(rec.isTx ? "]</span> <span class=\"tx\">[TX]</span> <span class=\"hex\">"
+                                 : "]</span> <span class=\"rx\">[RX]</span> <span class=\"hex\">");
+        DataFormat::appendHex(m_buffer, rec.data);
+        m_buffer.append("</span>  (");
+        DataFormat::appendAsciiWithMnemonics(m_buffer, rec.data, true);
+        m_buffer.append(")</pre>\n");
+    } else {
+        m_buffer.append('[');
+        appendTime(rec.timestampNs);
+        m_buffer.append(rec.isTx ? "] [TX] " : "] [RX] ");
+        DataFormat::appendHex(m_buffer, rec.data);
+        m_buffer.append("  (");
+        DataFormat::appendAsciiWithMnemonics(m_buffer, rec.data, false);
+        m_buffer.append(")\n");
+    }
+    ++m_bufferedRecords;
+
+    // Compressed size is only known after a flush, so compressed files are
+    // checked against what is already on disk (overshoot: one block at most)
+    const qint64 pending = (m_settings.compressionLevel > 0) ? 0 : m_buffer.size();
+    if (m_settings.rotateBytes > 0 && m_fileBytes + pending >= m_settings.rotateBytes)
+        rotate();
+}
+
+// --- pcapng ---
+
+void LogWriter::appendSectionHeader()
+{
+    const qsizetype start = beginBlock(m_buffer, PCAPNG_SHB);
+    appendLE32(m_buffer, PCAPNG_BYTE_ORDER_MAGIC);
+    appendLE16(m_buffer, 1); // major
+    appendLE16(m_buffer, 0); // minor
+    appendLE32(m_buffer, 0xFFFFFFFF); // section length unknown (-1, 64 bit)
+    appendLE32(m_buffer, 0xFFFFFFFF);
+    appendOption(m_buffer, OPT_SHB_USERAPPL, m_userAppl);
+    appendOption(m_buffer, OPT_ENDOFOPT, QByteArray());
+    finishBlock(m_buffer, start);
+}
+
+void LogWriter::appendInterfaceBlock(const Interface &iface)
+{
+    const qsizetype start = beginBlock(m_buffer, PCAPNG_IDB);
+    appendLE16(m_buffer, LINKTYPE_USER0);
+    appendLE16(m_buffer, 0); // reserved
+    appendLE32(m_buffer, 0); // snaplen: unlimited
+    appendOption(m_buffer, OPT_IF_NAME, iface.name);
+    if (!iface.description.isEmpty())
+        appendOption(m_buffer, OPT_IF_DESCRIPTION, iface.description);
+    appendOption(m_buffer, OPT_IF_TSRESOL, QByteArray(1, char(9))); // 10^-9 s
+    appendOption(m_buffer, OPT_ENDOFOPT, QByteArray());
+    finishBlock(m_buffer, start);
+}
+
+void LogWriter::appendPacketBlock(const Record &rec)
+{
+    // An interface must be described in this file before its first packet
+    if (rec.interfaceId >= m_writtenInterfaces.size()) {
+        QList<Interface> known;
+        {
+            QMutexLocker lock(&m_nameMutex);
+            known = m_interfaces;
+        }
+        while (m_writtenInterfaces.size() <= rec.interfaceId) {
+            const int id = m_writtenInterfaces.size();
+            Interface iface = (id < known.size())
+                                  ? known.at(id)
+                                  : Interface{QString("if%1").arg(id).toUtf8(), QByteArray()};
+            appendInterfaceBlock(iface);
+            m_writtenInterfaces.append(iface);
+        }
+    }
+
+    const quint64 ts = static_cast<quint64>(rec.timestampNs);
+    const quint32 len = static_cast<quint32>(rec.data.size());
+
+    const qsizetype start = beginBlock(m_buffer, PCAPNG_EPB);
+    appendLE32(m_buffer, static_cast<quint32>(rec.interfaceId));
+    appendLE32(m_buffer, static_cast<quint32>(ts >> 32));
+    appendLE32(m_buffer, static_cast<quint32>(ts & 0xFFFFFFFF));
+    appendLE32(m_buffer, len); // captured length
+    appendLE32(m_buffer, len); // original length
+    m_buffer.append(rec.data);
+    appendPadding(m_buffer, rec.data.size());
+
+    appendLE16(m_buffer, OPT_EPB_FLAGS);
+    appendLE16(m_buffer, 4);
+    appendLE32(m_buffer, rec.isTx ? EPB_FLAG_OUTBOUND : EPB_FLAG_INBOUND);
+    appendOption(m_buffer, OPT_ENDOFOPT, QByteArray());
+    finishBlock(m_buffer, start);
+}
+
+/**
+ * @brief Appends "HH:mm:ss.zzz" in local time.
+ *
+ * Converting to local time is the expensive part, so the "HH:mm:ss" text is
+ * cached per second and only the milliseconds are formatted per record.
+ */
+void LogWriter::appendTime(qint64 timestampNs)
+{
+    const qint64 ms = timestampNs / 1000000;
+    const qint64 second = ms / 1000;
+    if (second != m_cachedSecond) {
+        m_cachedSecond = second;
+        m_cachedSecondText = QDateTime::fromSecsSinceEpoch(second).toString("HH:mm:ss").toLatin1();
+    }
+
+    const int frac = static_cast<int>(ms % 1000);
+    m_buffer.append(m_cachedSecondText);
+    m_buffer.append('.');
+    m_buffer.append(char('0' + frac / 100));
+    m_buffer.append(char('0' + (frac / 10) % 10));
+    m_buffer.append(char('0' + frac % 10));
+}
+
+void LogWriter::flushBuffer()
+{
+    m_sinceFlush.restart();
+    if (m_buffer.isEmpty())
+        return;
+
+    const bool compress = (m_settings.compressionLevel > 0);
+    if (compress)
+        gzipMember(m_buffer, m_settings.compressionLevel, m_compressed);
+    const QByteArray &out = compress ? m_compressed : m_buffer;
+
+    const qint64 written = m_file.isOpen() ? m_file.write(out) : -1;
+    if (written == out.size()) {
+        m_file.flush();
+        if (m_settings.fsyncOnFlush) {
+#ifdef Q_OS_WIN
+            _commit(m_file.handle());
+#else
+            ::fsync(m_file.handle());
+#endif
+        }
+        m_fileBytes += written;
+        m_written.fetch_add(m_bufferedRecords, std::memory_order_relaxed);
+        m_failed = false;
+    } else {
+        if (written > 0)
+            m_fileBytes += written;
+        m_dropped.fetch_add(m_bufferedRecords, std::memory_order_relaxed);
+        if (!m_failed) {
+            m_failed = true;
+            emit writeFailed(tr("Could not write log file %1: %2")
+                                 .arg(m_file.fileName(), m_file.errorString()));
+        }
+    }
+
+    // resize() keeps the capacity, clear() would free it
+    m_buffer.resize(0);
+    m_bufferedRecords = 0;
+
+    const quint64 w = m_written.load(std::memory_order_relaxed);
+    const quint64 d = m_dropped.load(std::memory_order_relaxed);
+    if (w != m_reportedWritten || d != m_reportedDropped) {
+        m_reportedWritten = w;
+        m_reportedDropped = d;
+        emit statsChanged(w, d);
+    }
+}
+
+// --- Files ---
+
+QString LogWriter::nextFilePath()
+{
+    ++m_part;
+    QString ext = (m_format == Pcapng) ? ".pcapng"
+                  : (m_format == Html) ? ".html"
+                                       : ".txt";
+    if (m_settings.compressionLevel > 0)
+        ext += ".gz";
+    const QString name = (m_part == 1)
+                             ? m_baseName + ext
+                             : QString("%1_%2%3").arg(m_baseName).arg(m_part, 3, 10, QChar('0')).arg(ext);
+    return QDir(m_directory).filePath(name);
+}
+
+bool LogWriter::openFile()
+{
+    const QString path = nextFilePath();
+    m_file.setFileName(path);
+
+    // Unbuffered: m_buffer already batches writes, QFile's buffer would only add a copy
+    QIODevice::OpenMode mode = QIODevice::WriteOnly | QIODevice::Unbuffered;
+    if (m_format != Pcapng && m_settings.compressionLevel == 0)
+        mode |= QIODevice::Text;
+    if (!m_file.open(mode)) {
+        emit writeFailed(tr("Could not create log file %1: %2").arg(path, m_file.errorString()));
+        return false;
+    }
+
+    {
+        QMutexLocker lock(&m_nameMutex);
+        m_currentPath = path;
+    }
+
+    m_fileBytes = 0;
+    m_fileAge.start();
+    m_files.append(path);
+
+    if (m_format == Pcapng) {
+        // Every file is a complete capture: new section, interfaces re-described lazily
+        appendSectionHeader();
+        m_writtenInterfaces.clear();
+    } else if (m_format == Html) {
+        m_buffer.append(HTML_HEADER);
+        m_buffer.append(QDateTime::currentDateTime().toString("yyyy-MM-dd HH:mm:ss").toLatin1());
+        m_buffer.append("</p>\n<hr>\n");
+    }
+    return true;
+}
+
+void LogWriter::closeFile()
+{
+    if (!m_file.isOpen())
+        return;
+
+    if (m_format == Html) {
+        m_buffer.append("\n<hr>\n<p>Ended: ");
+        m_buffer.append(QDateTime::currentDateTime().toString("yyyy-MM-dd HH:mm:ss").toLatin1());
+        m_buffer.append("</p>\n</body>\n</html>");
+    }
+    flushBuffer();
+    m_file.close();
+}
+
+void LogWriter::rotate()
+{
+    flushBuffer();
+    closeFile();
+
+    // Restarted here too so a failing open is retried once per period, not per wakeup
+    m_fileAge.start();
+    if (!openFile())
+        return;
+
+    // Retention: only files created by this session are ever deleted
+    while (m_settings.maxFiles > 0 && m_files.size() > m_settings.maxFiles)
+        QFile::remove(m_files.takeFirst());
+
+    emit fileRotated(m_currentPath);
+}
@@ -0,0 +1,198 @@
+/**
+ * @file LogWriter.h
+ * @brief Background traffic log writer with buffered flushing and rotation.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * The GUI thread only timestamps a packet and pushes it into a lock-free
+ * queue (the payload QByteArray is shared, not copied). A dedicated thread
+ * formats records into a large buffer and writes it out according to the
+ * flush policy, so a 1 ms auto-send no longer costs a flush syscall per
+ * packet. Files are rotated by size and/or age with an optional retention
+ * limit. If the disk cannot keep up, the queue fills and further records
+ * are counted as dropped instead of blocking the UI.
+ *
+ * In Pcapng format every record becomes an Enhanced Packet Block with its
+ * original nanosecond timestamp and direction flag, and each registered
+ * interface (tab) gets its own Interface Description Block. Only whole
+ * blocks are ever written, so the file stays readable while it grows.
+ *
+ * With compression enabled each flush is deflated on the writer thread into
+ * an independent gzip member. Concatenated members are a valid .gz file
+ * (zcat, Wireshark), and a reader can resume at any member boundary.
+ */
+
+#ifndef LOGWRITER_H
+#define LOGWRITER_H
+
+#include <QThread>
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMutex>
+#include <QSemaphore>
+#include <QStringList>
+
+#include <atomic>
+
+#include "SpscQueue.h"
+
+/**
+ * @brief Threaded, rotating writer for the per-tab traffic log.
+ */
+class LogWriter : public QThread
+{
+    Q_OBJECT
+
+public:
+    enum Format {
+        PlainText,
+        Html,
+        Pcapng
+    };
+
+    /**
+     * @brief Flush, rotation and queue settings. Persisted under "Logging".
+     */
+    struct Settings {
+        int flushIntervalMs = 1000;     ///< Max time data sits in memory
+        int flushBytes = 256 * 1024;    ///< Write out once this much is buffered
+        bool fsyncOnFlush = false;      ///< Force data to the device on every flush
+        qint64 rotateBytes = 0;         ///< Start a new file past this size (0 = off)
+        int rotateMinutes = 0;          ///< Start a new file after this age (0 = off)
+        int maxFiles = 0;               ///< Delete the oldest files beyond this count (0 = keep all)
+        int queueCapacity = 65536;      ///< Records buffered between GUI and writer
+        int compressionLevel = 0;       ///< gzip level 1 (fast) .. 9 (small), 0 = off
+
+        static Settings load();
+        void save() const;
+    };
+
+    explicit LogWriter(QObject *parent = nullptr);
+    ~LogWriter() override;
+
+    /**
+     * @brief Creates the first log file and starts the writer thread.
+     * @param directory Folder for the log files (created if missing)
+     * @param format Plain text or HTML
+     * @param settings Flush / rotation policy for this session
+     * @return false if the file could not be created.
+     */
+    bool open(const QString &directory, Format format, const Settings &settings,
+              const QString &filePrefix = QStringLiteral("PacketLog"));
+
+    /**
+     * @brief Drains the queue, writes the footer and stops the thread.
+     */
+    void close();
+
+    bool isOpen() const { return m_active; }
+
+    /**
+     * @brief Registers a capture interface (one per tab/handler) after open().
+     * @param name Shown as the interface name in Wireshark
+     * @param description Optional free text (port settings, address...)
+     * @return Interface id to pass to append().
+     */
+    int addInterface(const QString &name, const QString &description = QString());
+
+    /**
+     * @brief Queues one packet. Producer side; call from a single thread only.
+     * @return false if the queue was full and the record was dropped.
+     */
+    bool append(bool isTx, const QByteArray &data, qint64 timestampNs = currentTimestampNs(),
+                int interfaceId = 0);
+
+    QString currentFileName() const;
+    quint64 writtenCount() const { return m_written.load(std::memory_order_relaxed); }
+    quint64 droppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Wall-clock time in nanoseconds since the Unix epoch.
+     */
+    static qint64 currentTimestampNs();
+
+signals:
+    /**
+     * @brief A new file was started because of rotation.
+     */
+    void fileRotated(const QString &filePath);
+
+    /**
+     * @brief Emitted after a flush when the counters changed.
+     */
+    void statsChanged(quint64 written, quint64 dropped);
+
+    /**
+     * @brief A write or file creation failed. Emitted once per failing file.
+     */
+    void writeFailed(const QString &message);
+
+protected:
+    void run() override;
+
+private:
+    struct Record {
+        qint64 timestampNs = 0;
+        QByteArray data;
+        int interfaceId = 0;
+        bool isTx = false;
+    };
+
+    struct Interface {
+        QByteArray name;
+        QByteArray description;
+    };
+
+    bool openFile();
+    void closeFile();
+    void rotate();
+    void formatRecord(const Record &rec);
+    void flushBuffer();
+    void appendTime(qint64 timestampNs);
+    void appendSectionHeader();
+    void appendInterfaceBlock(const Interface &iface);
+    void appendPacketBlock(const Record &rec);
+    QString nextFilePath();
+
+    bool m_active = false;          ///< Accepting records; GUI thread only
+
+    // Shared between threads
+    SpscQueue<Record> *m_queue = nullptr;
+    QSemaphore m_wakeup;
+    std::atomic<bool> m_sleeping{false};
+    std::atomic<bool> m_stop{false};
+    std::atomic<quint64> m_written{0};
+    std::atomic<quint64> m_dropped{0};
+    mutable QMutex m_nameMutex;     ///< Guards m_currentPath and m_interfaces
+    QString m_currentPath;
+    QList<Interface> m_interfaces;
+
+    // Writer thread only (set up by open() before start())
+    Settings m_settings;
+    Format m_format = PlainText;
+    QString m_directory;
+    QString m_baseName;
+    QByteArray m_userAppl;          ///< pcapng shb_userappl ("PacketForge x.y.z")
+    QList<Interface> m_writtenInterfaces;  ///< IDBs emitted into the current file
+    int m_part = 0;
+    QFile m_file;
+    qint64 m_fileBytes = 0;
+    QElapsedTimer m_fileAge;
+    QElapsedTimer m_sinceFlush;
+    QByteArray m_buffer;
+    QByteArray m_compressed;        ///< Scratch for the gzip member of m_buffer
+    int m_bufferedRecords = 0;
+    bool m_failed = false;
+    QStringList m_files;            ///< Files of this session, oldest first
+    quint64 m_reportedWritten = 0;
+    quint64 m_reportedDropped = 0;
+    qint64 m_cachedSecond = -1;
+    QByteArray m_cachedSecondText;
+};
+
+#endif // LOGWRITER_H
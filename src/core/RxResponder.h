@@ -0,0 +1,58 @@
+/**
+ * @file RxResponder.h
+ * @brief Interface for logic that answers received data inside the I/O thread.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * A communication handler calls process() with every chunk it reads, in
+ * the thread that owns the device, before the data is handed to the GUI.
+ * Implementations: AutoResponder (trigger rules) and DeviceSimulator.
+ */
+
+#ifndef RXRESPONDER_H
+#define RXRESPONDER_H
+
+#include <QByteArray>
+
+#include <functional>
+
+class QObject;
+
+class RxResponder
+{
+public:
+    /// Writes a reply to the device; returns false if it could not be sent
+    using WriteFunction = std::function<bool(const QByteArray &)>;
+
+    virtual ~RxResponder() = default;
+
+    /**
+     * @brief True if process() would do anything. Cheap; any thread.
+     */
+    virtual bool isActive() const = 0;
+
+    /**
+     * @brief Handles a received chunk and sends any replies. I/O thread only.
+     * @param rxTimestampNs nowNs() taken when the chunk was read
+     * @param context Object in the I/O thread that delayed replies are bound to
+     * @param write Sends one reply (also called later, from @p context, for delayed replies)
+     */
+    virtual void process(const QByteArray &data, qint64 rxTimestampNs, QObject *context,
+                         const WriteFunction &write) = 0;
+
+    /**
+     * @brief Forgets per-connection state (partial frames, device state).
+     */
+    virtual void reset() = 0;
+
+    /**
+     * @brief Monotonic clock used for rxTimestampNs and latency measurements.
+     */
+    static qint64 nowNs();
+};
+
+#endif // RXRESPONDER_H
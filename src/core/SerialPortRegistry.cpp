@@ -0,0 +1,175 @@
+/**
+ * @file SerialPortRegistry.cpp
+ * @brief Implementation of the shared hot-plug serial port registry.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "SerialPortRegistry.h"
+
+#include <QCoreApplication>
+#include <QSocketNotifier>
+
+#ifdef Q_OS_LINUX
+#include <linux/netlink.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#include <dbt.h>
+#endif
+
+// Device nodes and udev permissions settle shortly after the kernel event,
+// and a single plug produces several events (usb, tty, usb-serial...).
+static const int RESCAN_DEBOUNCE_MS = 300;
+
+// Only used on platforms where no hot-plug source could be installed.
+static const int FALLBACK_POLL_MS = 3000;
+
+SerialPortRegistry *SerialPortRegistry::instance()
+{
+    // Parented to the application so it is torn down before QCoreApplication.
+    static SerialPortRegistry *s_instance = new SerialPortRegistry(QCoreApplication::instance());
+    return s_instance;
+}
+
+SerialPortRegistry::SerialPortRegistry(QObject *parent) : QObject(parent)
+{
+    m_debounceTimer.setSingleShot(true);
+    m_debounceTimer.setInterval(RESCAN_DEBOUNCE_MS);
+    connect(&m_debounceTimer, &QTimer::timeout, this, &SerialPortRegistry::rescan);
+
+    // One-time scan; afterwards only device events trigger enumeration.
+    m_ports = QSerialPortInfo::availablePorts();
+    for (const QSerialPortInfo &info : m_ports)
+        m_portNames << info.portName();
+
+    setupHotplugSource();
+}
+
+SerialPortRegistry::~SerialPortRegistry()
+{
+#ifdef Q_OS_WIN
+    if (QCoreApplication::instance())
+        QCoreApplication::instance()->removeNativeEventFilter(this);
+#endif
+#ifdef Q_OS_LINUX
+    delete m_ueventNotifier;
+    if (m_ueventFd >= 0)
+        ::close(m_ueventFd);
+#endif
+}
+
+void SerialPortRegistry::setupHotplugSource()
+{
+    bool haveSource = false;
+
+#ifdef Q_OS_LINUX
+    m_ueventFd = ::socket(AF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC | SOCK_NONBLOCK,
+                          NETLINK_KOBJECT_UEVENT);
+    if (m_ueventFd >= 0) {
+        sockaddr_nl addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.nl_family = AF_NETLINK;
+        addr.nl_pid = 0;        // let the kernel assign a unique id
+        addr.nl_groups = 1;     // kernel uevent multicast group
+
+        if (::bind(m_ueventFd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0) {
+            m_ueventNotifier = new QSocketNotifier(m_ueventFd, QSocketNotifier::Read);
+            connect(m_ueventNotifier, &QSocketNotifier::activated,
+                    this, &SerialPortRegistry::onUeventReadable);
+            haveSource = true;
+        } else {
+            // Typically a sandbox/container without netlink access
+            ::close(m_ueventFd);
+            m_ueventFd = -1;
+        }
+    }
+#endif
+
+#ifdef Q_OS_WIN
+    // Top-level windows receive the DBT_DEVNODES_CHANGED broadcast, and every
+    // message for a Qt window passes through the application filters.
+    QCoreApplication::instance()->installNativeEventFilter(this);
+    haveSource = true;
+#endif
+
+    if (!haveSource) {
+        connect(&m_fallbackTimer, &QTimer::timeout, this, &SerialPortRegistry::rescan);
+        m_fallbackTimer.start(FALLBACK_POLL_MS);
+    }
+}
+
+void SerialPortRegistry::scheduleRescan()
+{
+    m_debounceTimer.start();
+}
+
+void SerialPortRegistry::rescan()
+{
+    const QList<QSerialPortInfo> infos = QSerialPortInfo::availablePorts();
+
+    QStringList names;
+    for (const QSerialPortInfo &info : infos)
+        names << info.portName();
+
+    if (names == m_portNames)
+        return;
+
+    m_ports = infos;
+    m_portNames = names;
+    emit portsChanged(m_ports);
+}
+
+#ifdef Q_OS_LINUX
+/**
+ * @brief Drains pending uevents and schedules a rescan for tty changes.
+ *
+ * Messages look like "add@/devices/...\0ACTION=add\0SUBSYSTEM=tty\0...".
+ */
+void SerialPortRegistry::onUeventReadable()
+{
+    char msg[4096];
+    bool ttyEvent = false;
+
+    for (;;) {
+        ssize_t len = ::recv(m_ueventFd, msg, sizeof(msg) - 1, 0);
+        if (len <= 0)
+            break;
+        msg[len] = '\0';
+
+        for (ssize_t i = 0; i < len; i += static_cast<ssize_t>(std::strlen(msg + i)) + 1) {
+            if (std::strcmp(msg + i, "SUBSYSTEM=tty") == 0) {
+                ttyEvent = true;
+                break;
+            }
+        }
+    }
+
+    if (ttyEvent)
+        scheduleRescan();
+}
+#endif
+
+#ifdef Q_OS_WIN
+bool SerialPortRegistry::nativeEventFilter(const QByteArray &eventType, void *message, qintptr *result)
+{
+    Q_UNUSED(result);
+    if (eventType == "windows_generic_MSG") {
+        const MSG *msg = static_cast<const MSG *>(message);
+        if (msg->message == WM_DEVICECHANGE
+            && (msg->wParam == DBT_DEVNODES_CHANGED
+                || msg->wParam == DBT_DEVICEARRIVAL
+                || msg->wParam == DBT_DEVICEREMOVECOMPLETE)) {
+            scheduleRescan();
+        }
+    }
+    return false;
+}
+#endif
@@ -0,0 +1,105 @@
+/**
+ * @file SerialPortRegistry.h
+ * @brief Application-wide serial port list driven by hot-plug notifications.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * Enumerating serial ports means a sysfs/registry scan, which is far too
+ * expensive to repeat from every tab on a timer. The registry performs a
+ * single scan at startup and rescans only when the OS reports a device
+ * change (netlink uevents on Linux, WM_DEVICECHANGE on Windows). Platforms
+ * without a notification source fall back to one shared slow poll.
+ * Widgets subscribe to portsChanged() instead of enumerating themselves.
+ */
+
+#ifndef SERIALPORTREGISTRY_H
+#define SERIALPORTREGISTRY_H
+
+#include <QObject>
+#include <QList>
+#include <QStringList>
+#include <QTimer>
+#include <QSerialPortInfo>
+
+#ifdef Q_OS_WIN
+#include <QAbstractNativeEventFilter>
+#endif
+
+class QSocketNotifier;
+
+/**
+ * @brief Singleton cache of the available serial ports.
+ */
+class SerialPortRegistry : public QObject
+#ifdef Q_OS_WIN
+    , public QAbstractNativeEventFilter
+#endif
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Returns the shared registry, creating it (and scanning) on first use.
+     */
+    static SerialPortRegistry *instance();
+
+    ~SerialPortRegistry();
+
+    /**
+     * @brief Last known list of ports. Does not touch the OS.
+     */
+    QList<QSerialPortInfo> ports() const { return m_ports; }
+
+    /**
+     * @brief Port names of the last known list, in enumeration order.
+     */
+    QStringList portNames() const { return m_portNames; }
+
+#ifdef Q_OS_WIN
+    bool nativeEventFilter(const QByteArray &eventType, void *message, qintptr *result) override;
+#endif
+
+public slots:
+    /**
+     * @brief Enumerates the ports now and emits portsChanged() if the set differs.
+     */
+    void rescan();
+
+signals:
+    /**
+     * @brief Emitted after a rescan found ports added or removed.
+     * @param ports The new port list.
+     */
+    void portsChanged(const QList<QSerialPortInfo> &ports);
+
+private:
+    explicit SerialPortRegistry(QObject *parent = nullptr);
+
+    /**
+     * @brief Installs the platform hot-plug source, or the fallback poll.
+     */
+    void setupHotplugSource();
+
+    /**
+     * @brief Coalesces bursts of device events into one rescan.
+     */
+    void scheduleRescan();
+
+#ifdef Q_OS_LINUX
+    void onUeventReadable();
+
+    int m_ueventFd = -1;
+    QSocketNotifier *m_ueventNotifier = nullptr;
+#endif
+
+    QTimer m_debounceTimer;                 ///< Single-shot, restarted on every device event
+    QTimer m_fallbackTimer;                 ///< Only used without a notification source
+    QList<QSerialPortInfo> m_ports;
+    QStringList m_portNames;
+};
+
+#endif // SERIALPORTREGISTRY_H
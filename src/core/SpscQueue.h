@@ -0,0 +1,107 @@
+/**
+ * @file SpscQueue.h
+ * @brief Bounded lock-free single-producer / single-consumer ring buffer.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * Exactly one thread may call push() and exactly one other thread may call
+ * pop(). Neither side ever blocks or takes a lock; a full queue makes push()
+ * fail so the producer can count the loss instead of stalling.
+ */
+
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+template <typename T>
+class SpscQueue
+{
+public:
+    /**
+     * @brief Creates a queue holding at least @p capacity items.
+     * @param capacity Rounded up to the next power of two.
+     */
+    explicit SpscQueue(size_t capacity = 4096)
+    {
+        size_t cap = 2;
+        while (cap < capacity)
+            cap <<= 1;
+        m_slots.resize(cap);
+        m_mask = cap - 1;
+    }
+
+    SpscQueue(const SpscQueue &) = delete;
+    SpscQueue &operator=(const SpscQueue &) = delete;
+
+    size_t capacity() const { return m_mask + 1; }
+
+    /**
+     * @brief Producer side. Returns false (and leaves @p item untouched) if full.
+     */
+    bool push(T &&item)
+    {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_cachedHead > m_mask) {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail - m_cachedHead > m_mask)
+                return false;
+        }
+        m_slots[tail & m_mask] = std::move(item);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool push(const T &item)
+    {
+        T copy(item);
+        return push(std::move(copy));
+    }
+
+    /**
+     * @brief Consumer side. Returns false if the queue is empty.
+     */
+    bool pop(T &item)
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_cachedTail) {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head == m_cachedTail)
+                return false;
+        }
+        item = std::move(m_slots[head & m_mask]);
+        m_slots[head & m_mask] = T(); // release shared payloads now, not on wrap-around
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Approximate fill level; exact only when called from either end.
+     */
+    size_t size() const
+    {
+        return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+    }
+
+    bool isEmpty() const { return size() == 0; }
+
+private:
+    std::vector<T> m_slots;
+    size_t m_mask = 0;
+
+    // Producer and consumer indices live on separate cache lines, each next
+    // to the owning side's cached copy of the other index.
+    alignas(64) std::atomic<size_t> m_tail{0};  ///< Written by the producer
+    size_t m_cachedHead = 0;                     ///< Producer's last view of m_head
+    alignas(64) std::atomic<size_t> m_head{0};  ///< Written by the consumer
+    size_t m_cachedTail = 0;                     ///< Consumer's last view of m_tail
+};
+
+#endif // SPSCQUEUE_H
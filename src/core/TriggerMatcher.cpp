@@ -0,0 +1,728 @@
+/**
+ * @file TriggerMatcher.cpp
+ * @brief Implementation of the trigger pattern compiler and matcher.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * pattern text -> parse tree -> Thompson NFA (one for all patterns, each
+ * ending in its own accept state) -> subset construction into the DFA
+ * table. The search is unanchored: the NFA start states are added to every
+ * DFA state, which is equivalent to a leading ".*" on each pattern.
+ */
+
+#include "TriggerMatcher.h"
+
+#include <QHash>
+
+#include <algorithm>
+
+static const int ALPHABET = 256;
+static const int MAX_REPEAT = 64;
+static const int MAX_NFA_STATES = 200000;
+
+namespace {
+
+struct ByteSet {
+    quint64 bits[4] = {0, 0, 0, 0};
+
+    void add(int b) { bits[b >> 6] |= quint64(1) << (b & 63); }
+    bool has(int b) const { return (bits[b >> 6] >> (b & 63)) & 1; }
+    void invert() { for (quint64 &w : bits) w = ~w; }
+    bool isEmpty() const { return !(bits[0] | bits[1] | bits[2] | bits[3]); }
+};
+
+// --- Parse tree ---
+
+struct Node {
+    enum Type { Set, Concat, Alternate, Repeat };
+    Type type = Concat;
+    ByteSet set;
+    QVector<int> children;
+    int min = 1;
+    int max = 1;            ///< -1 = unbounded
+};
+
+class Parser
+{
+public:
+    Parser(const QString &text, QVector<Node> &nodes) : m_src(text.toUtf8()), m_nodes(nodes) {}
+
+    int parse()
+    {
+        int root = parseAlternation();
+        if (root < 0)
+            return -1;
+        skipSpace();
+        if (!atEnd())
+            return fail(QString("Unexpected '%1'").arg(QChar(peek())));
+        return root;
+    }
+
+    QString error() const { return m_error; }
+
+private:
+    bool atEnd() const { return m_pos >= m_src.size(); }
+    char peek(int ahead = 0) const
+    {
+        return (m_pos + ahead < m_src.size()) ? m_src.at(m_pos + ahead) : '\0';
+    }
+    void skipSpace()
+    {
+        while (!atEnd() && (peek() == ' ' || peek() == '\t' || peek() == ',' || peek() == '\r' || peek() == '\n'))
+            ++m_pos;
+    }
+    static int hexValue(char c)
+    {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+    int fail(const QString &message)
+    {
+        if (m_error.isEmpty())
+            m_error = QString("%1 at column %2").arg(message).arg(m_pos + 1);
+        return -1;
+    }
+    int add(const Node &node)
+    {
+        m_nodes.append(node);
+        return m_nodes.size() - 1;
+    }
+    int addSet(const ByteSet &set)
+    {
+        Node node;
+        node.type = Node::Set;
+        node.set = set;
+        return add(node);
+    }
+
+    int parseAlternation()
+    {
+        int first = parseConcat();
+        if (first < 0)
+            return -1;
+        skipSpace();
+        if (peek() != '|')
+            return first;
+
+        Node alt;
+        alt.type = Node::Alternate;
+        alt.children.append(first);
+        while (!atEnd() && peek() == '|') {
+            ++m_pos;
+            int next = parseConcat();
+            if (next < 0)
+                return -1;
+            alt.children.append(next);
+            skipSpace();
+        }
+        return add(alt);
+    }
+
+    int parseConcat()
+    {
+        Node cat;
+        cat.type = Node::Concat;
+        for (;;) {
+            skipSpace();
+            if (atEnd() || peek() == '|' || peek() == ')')
+                break;
+            int item = parseRepeat();
+            if (item < 0)
+                return -1;
+            cat.children.append(item);
+        }
+        return (cat.children.size() == 1) ? cat.children.first() : add(cat);
+    }
+
+    // Quantifiers must follow the item directly. A '?' that starts a byte
+    // ("AA??", "AA?5") is a wildcard, not a quantifier.
+    int parseRepeat()
+    {
+        int item = parseAtom();
+        while (item >= 0 && !atEnd()) {
+            int min, max;
+            const char c = peek();
+            if (c == '*') {
+                min = 0; max = -1; ++m_pos;
+            } else if (c == '+') {
+                min = 1; max = -1; ++m_pos;
+            } else if (c == '?' && peek(1) != '?' && hexValue(peek(1)) < 0) {
+                min = 0; max = 1; ++m_pos;
+            } else if (c == '{') {
+                ++m_pos;
+                if (!parseCount(min))
+                    return fail("Expected a number");
+                max = min;
+                if (peek() == ',') {
+                    ++m_pos;
+                    max = -1;
+                    if (peek() != '}' && !parseCount(max))
+                        return fail("Expected a number");
+                }
+                if (peek() != '}')
+                    return fail("Missing '}'");
+                ++m_pos;
+                if (min > MAX_REPEAT || max > MAX_REPEAT)
+                    return fail(QString("Repeat count above %1").arg(MAX_REPEAT));
+                if (max >= 0 && max < min)
+                    return fail("Repeat maximum below minimum");
+            } else {
+                break;
+            }
+
+            Node rep;
+            rep.type = Node::Repeat;
+            rep.children.append(item);
+            rep.min = min;
+            rep.max = max;
+            item = add(rep);
+        }
+        return item;
+    }
+
+    bool parseCount(int &value)
+    {
+        int digits = 0;
+        value = 0;
+        while (peek() >= '0' && peek() <= '9' && digits < 4) {
+            value = value * 10 + (peek() - '0');
+            ++m_pos;
+            ++digits;
+        }
+        return digits > 0;
+    }
+
+    int parseAtom()
+    {
+        skipSpace();
+        if (atEnd())
+            return fail("Unexpected end of pattern");
+
+        const char c = peek();
+        if (c == '(') {
+            ++m_pos;
+            int inner = parseAlternation();
+            if (inner < 0)
+                return -1;
+            skipSpace();
+            if (peek() != ')')
+                return fail("Missing ')'");
+            ++m_pos;
+            return inner;
+        }
+        if (c == '[')
+            return parseClass();
+        if (c == '"')
+            return parseString();
+        if (c == '.') {
+            ++m_pos;
+            ByteSet any;
+            any.invert();
+            return addSet(any);
+        }
+        if (c == '?' || hexValue(c) >= 0)
+            return parseMaskedByte();
+        return fail(QString("Unexpected '%1'").arg(QChar(c)));
+    }
+
+    // Two characters, each a hex digit or (if allowed) a '?' nibble wildcard
+    bool parseByte(bool allowWildcard, int &value, int &mask)
+    {
+        value = 0;
+        mask = 0;
+        for (int i = 0; i < 2; ++i) {
+            const char c = peek();
+            const int nibble = hexValue(c);
+            value <<= 4;
+            mask <<= 4;
+            if (nibble >= 0) {
+                value |= nibble;
+                mask |= 0xF;
+            } else if (!(allowWildcard && c == '?')) {
+                fail(atEnd() ? QString("Incomplete byte") : QString("Invalid hex digit '%1'").arg(QChar(c)));
+                return false;
+            }
+            ++m_pos;
+        }
+        return true;
+    }
+
+    int parseMaskedByte()
+    {
+        int value, mask;
+        if (!parseByte(true, value, mask))
+            return -1;
+        if (peek() == '/') {
+            ++m_pos;
+            int explicitMask, unused;
+            if (!parseByte(false, explicitMask, unused))
+                return -1;
+            mask &= explicitMask;
+        }
+
+        ByteSet set;
+        for (int b = 0; b < ALPHABET; ++b) {
+            if ((b & mask) == (value & mask))
+                set.add(b);
+        }
+        return addSet(set);
+    }
+
+    int parseClass()
+    {
+        ++m_pos; // '['
+        bool negate = false;
+        if (peek() == '^') {
+            negate = true;
+            ++m_pos;
+        }
+
+        ByteSet set;
+        for (;;) {
+            skipSpace();
+            if (atEnd())
+                return fail("Missing ']'");
+            if (peek() == ']') {
+                ++m_pos;
+                break;
+            }
+            int lo, hi, unused;
+            if (!parseByte(false, lo, unused))
+                return -1;
+            hi = lo;
+            skipSpace();
+            if (peek() == '-') {
+                ++m_pos;
+                skipSpace();
+                if (!parseByte(false, hi, unused))
+                    return -1;
+                if (hi < lo)
+                    return fail("Reversed range");
+            }
+            for (int b = lo; b <= hi; ++b)
+                set.add(b);
+        }
+
+        if (negate)
+            set.invert();
+        if (set.isEmpty())
+            return fail("Empty byte class");
+        return addSet(set);
+    }
+
+    int parseString()
+    {
+        ++m_pos; // '"'
+        Node cat;
+        cat.type = Node::Concat;
+        for (;;) {
+            if (atEnd())
+                return fail("Missing '\"'");
+            char c = peek();
+            ++m_pos;
+            if (c == '"')
+                break;
+            if (c == '\\') {
+                const char e = peek();
+                ++m_pos;
+                switch (e) {
+                case 'r': c = '\r'; break;
+                case 'n': c = '\n'; break;
+                case 't': c = '\t'; break;
+                case '0': c = '\0'; break;
+                case '\\': c = '\\'; break;
+                case '"': c = '"'; break;
+                case 'x': {
+                    int value, unused;
+                    if (!parseByte(false, value, unused))
+                        return -1;
+                    c = char(value);
+                    break;
+                }
+                default:
+                    return fail(QString("Unknown escape '\\%1'").arg(QChar(e)));
+                }
+            }
+            ByteSet set;
+            set.add(uchar(c));
+            cat.children.append(addSet(set));
+        }
+        if (cat.children.isEmpty())
+            return fail("Empty string");
+        return (cat.children.size() == 1) ? cat.children.first() : add(cat);
+    }
+
+    QByteArray m_src;
+    int m_pos = 0;
+    QVector<Node> &m_nodes;
+    QString m_error;
+};
+
+bool matchesEmpty(const QVector<Node> &nodes, int index)
+{
+    const Node &node = nodes.at(index);
+    switch (node.type) {
+    case Node::Set:
+        return false;
+    case Node::Concat:
+        for (int child : node.children) {
+            if (!matchesEmpty(nodes, child))
+                return false;
+        }
+        return true;
+    case Node::Alternate:
+        for (int child : node.children) {
+            if (matchesEmpty(nodes, child))
+                return true;
+        }
+        return false;
+    case Node::Repeat:
+        return node.min == 0 || matchesEmpty(nodes, node.children.first());
+    }
+    return false;
+}
+
+bool parsePattern(const QString &text, QVector<Node> &nodes, int &root, QString *errorMessage)
+{
+    Parser parser(text, nodes);
+    root = parser.parse();
+    if (root < 0) {
+        if (errorMessage)
+            *errorMessage = parser.error();
+        return false;
+    }
+    if (matchesEmpty(nodes, root)) {
+        if (errorMessage)
+            *errorMessage = "Pattern can match empty input";
+        return false;
+    }
+    return true;
+}
+
+// --- Thompson NFA ---
+
+struct NfaState {
+    ByteSet set;
+    bool consumes = false;  ///< Byte transition on 'set' to 'out'
+    int out = -1;           ///< Otherwise epsilon edges to out / out2
+    int out2 = -1;
+    int accept = -1;        ///< Pattern id if this is an accept state
+};
+
+class NfaBuilder
+{
+public:
+    struct Fragment {
+        int start;
+        int end;            ///< Epsilon state with a free 'out'
+    };
+
+    NfaBuilder(const QVector<Node> &nodes, QVector<NfaState> &states) : m_nodes(nodes), m_states(states) {}
+
+    bool overflow() const { return m_overflow; }
+
+    int newState()
+    {
+        if (m_states.size() >= MAX_NFA_STATES)
+            m_overflow = true;
+        m_states.append(NfaState());
+        return m_states.size() - 1;
+    }
+
+    Fragment empty()
+    {
+        const int s = newState();
+        return {s, s};
+    }
+
+    Fragment chain(Fragment a, Fragment b)
+    {
+        m_states[a.end].out = b.start;
+        return {a.start, b.end};
+    }
+
+    Fragment compile(int index)
+    {
+        if (m_overflow)
+            return empty();
+
+        const Node &node = m_nodes.at(index);
+        switch (node.type) {
+        case Node::Set: {
+            const int s = newState();
+            const int e = newState();
+            m_states[s].consumes = true;
+            m_states[s].set = node.set;
+            m_states[s].out = e;
+            return {s, e};
+        }
+        case Node::Concat: {
+            Fragment f = empty();
+            for (int child : node.children)
+                f = chain(f, compile(child));
+            return f;
+        }
+        case Node::Alternate: {
+            const int e = newState();
+            int start = -1;
+            for (int i = node.children.size() - 1; i >= 0; --i) {
+                Fragment f = compile(node.children.at(i));
+                m_states[f.end].out = e;
+                if (start < 0) {
+                    start = f.start;
+                } else {
+                    const int split = newState();
+                    m_states[split].out = f.start;
+                    m_states[split].out2 = start;
+                    start = split;
+                }
+            }
+            return {start, e};
+        }
+        case Node::Repeat: {
+            const int child = node.children.first();
+            Fragment f = empty();
+            for (int i = 0; i < node.min; ++i)
+                f = chain(f, compile(child));
+
+            if (node.max < 0) {
+                const int loop = newState();
+                const int e = newState();
+                Fragment body = compile(child);
+                m_states[loop].out = body.start;
+                m_states[loop].out2 = e;
+                m_states[body.end].out = loop;
+                f = chain(f, {loop, e});
+            } else {
+                for (int i = node.min; i < node.max; ++i) {
+                    const int split = newState();
+                    const int e = newState();
+                    Fragment body = compile(child);
+                    m_states[split].out = body.start;
+                    m_states[split].out2 = e;
+                    m_states[body.end].out = e;
+                    f = chain(f, {split, e});
+                }
+            }
+            return f;
+        }
+        }
+        return empty();
+    }
+
+private:
+    const QVector<Node> &m_nodes;
+    QVector<NfaState> &m_states;
+    bool m_overflow = false;
+};
+
+/**
+ * Epsilon closure, keeping only the states that matter for the DFA
+ * (byte transitions and accepts). Result is sorted, so it can be a hash key.
+ */
+class Closure
+{
+public:
+    explicit Closure(const QVector<NfaState> &states) : m_states(states), m_mark(states.size(), 0) {}
+
+    QVector<int> operator()(const QVector<int> &seeds)
+    {
+        ++m_generation;
+        QVector<int> result;
+        m_stack = seeds;
+        while (!m_stack.isEmpty()) {
+            const int s = m_stack.takeLast();
+            if (s < 0 || m_mark.at(s) == m_generation)
+                continue;
+            m_mark[s] = m_generation;
+
+            const NfaState &state = m_states.at(s);
+            if (state.consumes || state.accept >= 0) {
+                result.append(s);
+            } else {
+                m_stack.append(state.out);
+                m_stack.append(state.out2);
+            }
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+private:
+    const QVector<NfaState> &m_states;
+    QVector<int> m_mark;
+    QVector<int> m_stack;
+    int m_generation = 0;
+};
+
+} // namespace
+
+TriggerMatcher::TriggerMatcher()
+{
+    clear();
+}
+
+void TriggerMatcher::clear()
+{
+    m_stateCount = 1;
+    m_next.fill(0, ALPHABET);
+    m_outputStart.fill(0, 2);
+    m_outputs.clear();
+    m_state = 0;
+}
+
+bool TriggerMatcher::validatePattern(const QString &pattern, QString *errorMessage)
+{
+    QVector<Node> nodes;
+    int root;
+    return parsePattern(pattern, nodes, root, errorMessage);
+}
+
+bool TriggerMatcher::setPatterns(const QStringList &patterns, QString *errorMessage)
+{
+    clear();
+
+    // 1. One NFA for all patterns
+    QVector<NfaState> nfa;
+    QVector<int> starts;
+
+    for (int id = 0; id < patterns.size(); ++id) {
+        if (patterns.at(id).trimmed().isEmpty())
+            continue;
+
+        QVector<Node> nodes;
+        int root;
+        QString error;
+        if (!parsePattern(patterns.at(id), nodes, root, &error)) {
+            if (errorMessage)
+                *errorMessage = QString("Pattern %1: %2").arg(id + 1).arg(error);
+            return false;
+        }
+
+        NfaBuilder patternBuilder(nodes, nfa);
+        NfaBuilder::Fragment f = patternBuilder.compile(root);
+        const int accept = patternBuilder.newState();
+        if (patternBuilder.overflow()) {
+            if (errorMessage)
+                *errorMessage = QString("Pattern %1 is too large").arg(id + 1);
+            return false;
+        }
+        nfa[accept].accept = id;
+        nfa[f.end].out = accept;
+        starts.append(f.start);
+    }
+
+    if (starts.isEmpty())
+        return true;
+
+    // 2. Bytes no NFA transition tells apart share one DFA column computation
+    QVector<int> byteClass(ALPHABET, 0);
+    int classCount = 1;
+    for (const NfaState &state : nfa) {
+        if (!state.consumes)
+            continue;
+        QVector<int> remap(classCount * 2, -1);
+        int next = 0;
+        for (int b = 0; b < ALPHABET; ++b) {
+            int &id = remap[byteClass.at(b) * 2 + (state.set.has(b) ? 1 : 0)];
+            if (id < 0)
+                id = next++;
+            byteClass[b] = id;
+        }
+        classCount = next;
+    }
+    QVector<int> classByte(classCount, -1);
+    for (int b = 0; b < ALPHABET; ++b) {
+        if (classByte.at(byteClass.at(b)) < 0)
+            classByte[byteClass.at(b)] = b;
+    }
+
+    // 3. Subset construction. Every DFA state also contains the start states
+    //    (unanchored search).
+    Closure closure(nfa);
+    QHash<QVector<int>, int> ids;
+    QVector<QVector<int>> sets;
+
+    sets.append(closure(starts));
+    ids.insert(sets.first(), 0);
+    m_next.clear();
+
+    QVector<int> seeds;
+    QVector<int> targets(classCount);
+    for (int d = 0; d < sets.size(); ++d) {
+        for (int k = 0; k < classCount; ++k) {
+            const int b = classByte.at(k);
+            seeds = starts;
+            for (int s : sets.at(d)) {
+                const NfaState &state = nfa.at(s);
+                if (state.consumes && state.set.has(b))
+                    seeds.append(state.out);
+            }
+
+            QVector<int> target = closure(seeds);
+            auto it = ids.constFind(target);
+            if (it == ids.constEnd()) {
+                if (sets.size() >= MAX_STATES) {
+                    clear();
+                    if (errorMessage)
+                        *errorMessage = QString("Patterns are too complex (more than %1 states)").arg(MAX_STATES);
+                    return false;
+                }
+                it = ids.insert(target, sets.size());
+                sets.append(target);
+            }
+            targets[k] = it.value();
+        }
+
+        m_next.resize((d + 1) * ALPHABET);
+        qint32 *row = m_next.data() + d * ALPHABET;
+        for (int b = 0; b < ALPHABET; ++b)
+            row[b] = targets.at(byteClass.at(b));
+    }
+
+    // 4. Accepted pattern ids per DFA state
+    m_stateCount = sets.size();
+    m_outputStart.resize(m_stateCount + 1);
+    for (int d = 0; d < m_stateCount; ++d) {
+        m_outputStart[d] = m_outputs.size();
+        const int first = m_outputs.size();
+        for (int s : sets.at(d)) {
+            if (nfa.at(s).accept >= 0)
+                m_outputs.append(nfa.at(s).accept);
+        }
+        std::sort(m_outputs.begin() + first, m_outputs.end());
+        m_outputs.erase(std::unique(m_outputs.begin() + first, m_outputs.end()), m_outputs.end());
+    }
+    m_outputStart[m_stateCount] = m_outputs.size();
+    m_next.squeeze();
+    return true;
+}
+
+int TriggerMatcher::feed(const char *data, qint64 size, QVector<int> &matches, QVector<qint64> *ends)
+{
+    const qint32 *next = m_next.constData();
+    const qint32 *outputStart = m_outputStart.constData();
+    const int before = matches.size();
+    qint32 state = m_state;
+
+    for (qint64 i = 0; i < size; ++i) {
+        state = next[state * ALPHABET + uchar(data[i])];
+        if (outputStart[state] != outputStart[state + 1]) {
+            for (qint32 k = outputStart[state]; k < outputStart[state + 1]; ++k) {
+                matches.append(m_outputs.at(k));
+                if (ends)
+                    ends->append(i + 1);
+            }
+            state = 0;
+        }
+    }
+
+    m_state = state;
+    return matches.size() - before;
+}
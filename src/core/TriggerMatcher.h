@@ -0,0 +1,96 @@
+/**
+ * @file TriggerMatcher.h
+ * @brief Streaming multi-pattern matcher for auto-answer triggers.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * All patterns are compiled together into one deterministic automaton with
+ * a full 256-entry transition row per state, so matching costs one table
+ * lookup per received byte regardless of how many patterns there are or
+ * how complex they are. The current state is kept between feed() calls: a
+ * match split across two chunks is still found, and no received data has to
+ * be buffered or rescanned. (For plain byte strings the automaton is the
+ * Aho-Corasick automaton.)
+ *
+ * Pattern syntax, whitespace between items is ignored:
+ *   AA          the byte 0xAA
+ *   ?? or .     any byte
+ *   A? / ?5     nibble wildcards
+ *   40/F0       masked byte: (b & F0) == 40
+ *   [30-39 2E]  any listed byte or range; [^0D 0A] any byte except these
+ *   "OK\r\n"    ASCII bytes (escapes \r \n \t \0 \\ \" \xHH)
+ *   ( a | b )   grouping and alternatives
+ *   x* x+ x?    zero or more, one or more, optional
+ *   x{n} x{n,m} x{n,}   counted repetition (n, m <= 64)
+ * A quantifier applies to the whole preceding item, including a quoted
+ * string. e.g. "AA 55 ?? ?? 0D" or "02 [30-39]{1,4} 03".
+ */
+
+#ifndef TRIGGERMATCHER_H
+#define TRIGGERMATCHER_H
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+class TriggerMatcher
+{
+public:
+    static const int MAX_STATES = 4096;    ///< DFA size limit (1 KB per state)
+
+    TriggerMatcher();
+
+    /**
+     * @brief Compiles @p patterns. Pattern ids are their indexes in the list;
+     *        empty patterns never match. Resets the stream state.
+     * @param errorMessage Receives the reason if compilation fails.
+     * @return false on a syntax error or if the automaton would exceed
+     *         MAX_STATES; the matcher is then empty.
+     */
+    bool setPatterns(const QStringList &patterns, QString *errorMessage = nullptr);
+
+    /**
+     * @brief Checks the syntax of a single pattern.
+     */
+    static bool validatePattern(const QString &pattern, QString *errorMessage = nullptr);
+
+    /**
+     * @brief True if no non-empty pattern is loaded.
+     */
+    bool isEmpty() const { return m_outputs.isEmpty(); }
+
+    int stateCount() const { return m_stateCount; }
+
+    /**
+     * @brief Forgets any partial match carried over from previous data.
+     */
+    void reset() { m_state = 0; }
+
+    /**
+     * @brief Scans the next chunk of the stream.
+     * @param matches Receives the ids of the patterns found, in stream order.
+     *        When several patterns end on the same byte they are reported
+     *        together. Matching then restarts after that byte, so a match is
+     *        never re-reported through an overlapping one.
+     * @param ends Optional; receives, for each id, the offset in @p data
+     *        just past the byte that completed the match.
+     * @return Number of ids appended.
+     */
+    int feed(const char *data, qint64 size, QVector<int> &matches, QVector<qint64> *ends = nullptr);
+
+private:
+    void clear();
+
+    QVector<qint32> m_next;         ///< stateCount x 256 transitions
+    QVector<qint32> m_outputStart;  ///< stateCount + 1 offsets into m_outputs
+    QVector<qint32> m_outputs;      ///< Pattern ids accepted in each state
+    int m_stateCount = 1;
+    qint32 m_state = 0;
+};
+
+#endif // TRIGGERMATCHER_H
@@ -0,0 +1,547 @@
+/**
+ * @file XxHash3.cpp
+ * @brief Implementation of XXH3 and its stripe kernels.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "XxHash3.h"
+
+#include "CpuFeatures.h"
+
+#include <QtEndian>
+
+#include <cstring>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#endif
+
+namespace {
+
+const quint32 PRIME32_1 = 0x9E3779B1u;
+const quint32 PRIME32_2 = 0x85EBCA77u;
+const quint32 PRIME32_3 = 0xC2B2AE3Du;
+const quint64 PRIME64_1 = Q_UINT64_C(0x9E3779B185EBCA87);
+const quint64 PRIME64_2 = Q_UINT64_C(0xC2B2AE3D27D4EB4F);
+const quint64 PRIME64_3 = Q_UINT64_C(0x165667B19E3779F9);
+const quint64 PRIME64_4 = Q_UINT64_C(0x85EBCA77C2B2AE63);
+const quint64 PRIME64_5 = Q_UINT64_C(0x27D4EB2F165667C5);
+const quint64 PRIME_MX1 = Q_UINT64_C(0x165667919E3779F9);
+const quint64 PRIME_MX2 = Q_UINT64_C(0x9FB21C651E98DF25);
+
+const int STRIPE_LEN = 64;
+const int SECRET_SIZE = 192;
+const int SECRET_CONSUME_RATE = 8;          // Secret bytes advanced per stripe
+const int STRIPES_PER_BLOCK = (SECRET_SIZE - STRIPE_LEN) / SECRET_CONSUME_RATE;
+const int BLOCK_LEN = STRIPE_LEN * STRIPES_PER_BLOCK;
+const int SECRET_LIMIT = SECRET_SIZE - STRIPE_LEN;  // Where the scramble key starts
+const int MIDSIZE_MAX = 240;
+
+/// The default secret (taken by xxHash from FARSH)
+alignas(64) const uchar kSecret[SECRET_SIZE] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+const quint64 INIT_ACC[8] = {PRIME32_3, PRIME64_1, PRIME64_2, PRIME64_3,
+                             PRIME64_4, PRIME32_2, PRIME64_5, PRIME32_1};
+
+using XxHash3::Hash128;
+
+inline quint64 read64(const uchar *p) { return qFromLittleEndian<quint64>(p); }
+inline quint32 read32(const uchar *p) { return qFromLittleEndian<quint32>(p); }
+inline quint64 rotl64(quint64 x, int r) { return (x << r) | (x >> (64 - r)); }
+inline quint32 rotl32(quint32 x, int r) { return (x << r) | (x >> (32 - r)); }
+inline quint64 swap64(quint64 x) { return qbswap(x); }
+inline quint32 swap32(quint32 x) { return qbswap(x); }
+
+/// Full 128-bit product of two 64-bit values
+inline Hash128 mul128(quint64 a, quint64 b)
+{
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 p = static_cast<unsigned __int128>(a) * b;
+    return {quint64(p), quint64(p >> 64)};
+#elif defined(_MSC_VER) && defined(_M_X64)
+    Hash128 r;
+    r.low = _umul128(a, b, &r.high);
+    return r;
+#else
+    const quint64 lolo = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+    const quint64 hilo = (a >> 32) * (b & 0xFFFFFFFF);
+    const quint64 lohi = (a & 0xFFFFFFFF) * (b >> 32);
+    const quint64 hihi = (a >> 32) * (b >> 32);
+    const quint64 cross = (lolo >> 32) + (hilo & 0xFFFFFFFF) + lohi;
+    return {(cross << 32) | (lolo & 0xFFFFFFFF), (hilo >> 32) + (cross >> 32) + hihi};
+#endif
+}
+
+inline quint64 mulFold64(quint64 a, quint64 b)
+{
+    const Hash128 p = mul128(a, b);
+    return p.low ^ p.high;
+}
+
+quint64 xxh64Avalanche(quint64 h)
+{
+    h ^= h >> 33;
+    h *= PRIME64_2;
+    h ^= h >> 29;
+    h *= PRIME64_3;
+    return h ^ (h >> 32);
+}
+
+quint64 avalanche(quint64 h)
+{
+    h ^= h >> 37;
+    h *= PRIME_MX1;
+    return h ^ (h >> 32);
+}
+
+quint64 rrmxmx(quint64 h, quint64 len)
+{
+    h ^= rotl64(h, 49) ^ rotl64(h, 24);
+    h *= PRIME_MX2;
+    h ^= (h >> 35) + len;
+    h *= PRIME_MX2;
+    return h ^ (h >> 28);
+}
+
+inline quint64 mix16(const uchar *p, const uchar *secret)
+{
+    return mulFold64(read64(p) ^ read64(secret), read64(p + 8) ^ read64(secret + 8));
+}
+
+inline void mix32(Hash128 &acc, const uchar *p1, const uchar *p2, const uchar *secret)
+{
+    acc.low += mix16(p1, secret);
+    acc.low ^= read64(p2) + read64(p2 + 8);
+    acc.high += mix16(p2, secret + 16);
+    acc.high ^= read64(p1) + read64(p1 + 8);
+}
+
+// --- Short inputs (0..240 bytes) ---
+
+quint64 short64(const uchar *p, size_t len)
+{
+    const uchar *s = kSecret;
+    if (len > 8) {
+        const quint64 lo = read64(p) ^ (read64(s + 24) ^ read64(s + 32));
+        const quint64 hi = read64(p + len - 8) ^ (read64(s + 40) ^ read64(s + 48));
+        return avalanche(len + swap64(lo) + hi + mulFold64(lo, hi));
+    }
+    if (len >= 4) {
+        const quint64 input = read32(p + len - 4) + (quint64(read32(p)) << 32);
+        return rrmxmx(input ^ (read64(s + 8) ^ read64(s + 16)), len);
+    }
+    if (len) {
+        const quint32 combined = (quint32(p[0]) << 16) | (quint32(p[len >> 1]) << 24)
+                                 | quint32(p[len - 1]) | (quint32(len) << 8);
+        return xxh64Avalanche(combined ^ quint64(read32(s) ^ read32(s + 4)));
+    }
+    return xxh64Avalanche(read64(s + 56) ^ read64(s + 64));
+}
+
+quint64 medium64(const uchar *p, size_t len)
+{
+    quint64 acc = len * PRIME64_1;
+    if (len <= 128) {
+        if (len > 32) {
+            if (len > 64) {
+                if (len > 96) {
+                    acc += mix16(p + 48, kSecret + 96);
+                    acc += mix16(p + len - 64, kSecret + 112);
+                }
+                acc += mix16(p + 32, kSecret + 64);
+                acc += mix16(p + len - 48, kSecret + 80);
+            }
+            acc += mix16(p + 16, kSecret + 32);
+            acc += mix16(p + len - 32, kSecret + 48);
+        }
+        acc += mix16(p, kSecret);
+        acc += mix16(p + len - 16, kSecret + 16);
+        return avalanche(acc);
+    }
+
+    for (int i = 0; i < 8; ++i)
+        acc += mix16(p + 16 * i, kSecret + 16 * i);
+    acc = avalanche(acc);
+    quint64 accEnd = mix16(p + len - 16, kSecret + 136 - 17);
+    const int rounds = int(len / 16);
+    for (int i = 8; i < rounds; ++i)
+        accEnd += mix16(p + 16 * i, kSecret + 16 * (i - 8) + 3);
+    return avalanche(acc + accEnd);
+}
+
+Hash128 short128(const uchar *p, size_t len)
+{
+    const uchar *s = kSecret;
+    if (len > 8) {
+        const quint64 lo = read64(p);
+        quint64 hi = read64(p + len - 8);
+        Hash128 m = mul128(lo ^ hi ^ (read64(s + 32) ^ read64(s + 40)), PRIME64_1);
+        m.low += quint64(len - 1) << 54;
+        hi ^= read64(s + 48) ^ read64(s + 56);
+        m.high += hi + quint64(quint32(hi)) * (PRIME32_2 - 1);
+        m.low ^= swap64(m.high);
+        Hash128 h = mul128(m.low, PRIME64_2);
+        h.high += m.high * PRIME64_2;
+        return {avalanche(h.low), avalanche(h.high)};
+    }
+    if (len >= 4) {
+        const quint64 input = read32(p) + (quint64(read32(p + len - 4)) << 32);
+        Hash128 m = mul128(input ^ (read64(s + 16) ^ read64(s + 24)), PRIME64_1 + (len << 2));
+        m.high += m.low << 1;
+        m.low ^= m.high >> 3;
+        m.low ^= m.low >> 35;
+        m.low *= PRIME_MX2;
+        m.low ^= m.low >> 28;
+        m.high = avalanche(m.high);
+        return m;
+    }
+    if (len) {
+        const quint32 lo = (quint32(p[0]) << 16) | (quint32(p[len >> 1]) << 24)
+                           | quint32(p[len - 1]) | (quint32(len) << 8);
+        const quint32 hi = rotl32(swap32(lo), 13);
+        return {xxh64Avalanche(lo ^ quint64(read32(s) ^ read32(s + 4))),
+                xxh64Avalanche(hi ^ quint64(read32(s + 8) ^ read32(s + 12)))};
+    }
+    return {xxh64Avalanche(read64(s + 64) ^ read64(s + 72)),
+            xxh64Avalanche(read64(s + 80) ^ read64(s + 88))};
+}
+
+Hash128 medium128(const uchar *p, size_t len)
+{
+    Hash128 acc{len * PRIME64_1, 0};
+    if (len <= 128) {
+        if (len > 32) {
+            if (len > 64) {
+                if (len > 96)
+                    mix32(acc, p + 48, p + len - 64, kSecret + 96);
+                mix32(acc, p + 32, p + len - 48, kSecret + 64);
+            }
+            mix32(acc, p + 16, p + len - 32, kSecret + 32);
+        }
+        mix32(acc, p, p + len - 16, kSecret);
+    } else {
+        for (size_t i = 32; i < 160; i += 32)
+            mix32(acc, p + i - 32, p + i - 16, kSecret + i - 32);
+        acc.low = avalanche(acc.low);
+        acc.high = avalanche(acc.high);
+        for (size_t i = 160; i <= len; i += 32)
+            mix32(acc, p + i - 32, p + i - 16, kSecret + 3 + i - 160);
+        mix32(acc, p + len - 16, p + len - 32, kSecret + 136 - 17 - 16);
+    }
+    const quint64 low = acc.low + acc.high;
+    const quint64 high = acc.low * PRIME64_1 + acc.high * PRIME64_4 + len * PRIME64_2;
+    return {avalanche(low), 0 - avalanche(high)};
+}
+
+// --- Stripe kernels ---
+
+/// Accumulates @p stripes consecutive stripes, advancing the secret by 8 bytes each
+using AccumulateFunction = void (*)(quint64 *acc, const uchar *p, const uchar *secret, size_t stripes);
+/// Scrambles the accumulators at the end of a block
+using ScrambleFunction = void (*)(quint64 *acc, const uchar *secret);
+
+void accumulateScalar(quint64 *acc, const uchar *p, const uchar *secret, size_t stripes)
+{
+    for (size_t n = 0; n < stripes; ++n, p += STRIPE_LEN, secret += SECRET_CONSUME_RATE) {
+        for (int i = 0; i < 8; ++i) {
+            const quint64 data = read64(p + 8 * i);
+            const quint64 key = data ^ read64(secret + 8 * i);
+            acc[i ^ 1] += data;
+            acc[i] += quint64(quint32(key)) * (key >> 32);
+        }
+    }
+}
+
+void scrambleScalar(quint64 *acc, const uchar *secret)
+{
+    for (int i = 0; i < 8; ++i) {
+        quint64 a = acc[i];
+        a ^= a >> 47;
+        a ^= read64(secret + 8 * i);
+        acc[i] = a * PRIME32_1;
+    }
+}
+
+#if CPU_X86
+
+CPU_TARGET("sse2")
+void accumulateSse2(quint64 *acc, const uchar *p, const uchar *secret, size_t stripes)
+{
+    __m128i *a = reinterpret_cast<__m128i *>(acc);
+    __m128i a0 = _mm_load_si128(a), a1 = _mm_load_si128(a + 1);
+    __m128i a2 = _mm_load_si128(a + 2), a3 = _mm_load_si128(a + 3);
+
+    auto lane = [](__m128i acc, const uchar *p, const uchar *secret) {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        const __m128i key = _mm_xor_si128(data, _mm_loadu_si128(reinterpret_cast<const __m128i *>(secret)));
+        // (key & 0xFFFFFFFF) * (key >> 32) per 64-bit lane
+        const __m128i product = _mm_mul_epu32(key, _mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)));
+        const __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+        return _mm_add_epi64(product, _mm_add_epi64(acc, swapped));
+    };
+
+    for (size_t n = 0; n < stripes; ++n, p += STRIPE_LEN, secret += SECRET_CONSUME_RATE) {
+        a0 = lane(a0, p, secret);
+        a1 = lane(a1, p + 16, secret + 16);
+        a2 = lane(a2, p + 32, secret + 32);
+        a3 = lane(a3, p + 48, secret + 48);
+    }
+    _mm_store_si128(a, a0);
+    _mm_store_si128(a + 1, a1);
+    _mm_store_si128(a + 2, a2);
+    _mm_store_si128(a + 3, a3);
+}
+
+CPU_TARGET("sse2")
+void scrambleSse2(quint64 *acc, const uchar *secret)
+{
+    const __m128i prime = _mm_set1_epi32(int(PRIME32_1));
+    __m128i *a = reinterpret_cast<__m128i *>(acc);
+    for (int i = 0; i < 4; ++i) {
+        __m128i v = _mm_load_si128(a + i);
+        v = _mm_xor_si128(v, _mm_srli_epi64(v, 47));
+        v = _mm_xor_si128(v, _mm_loadu_si128(reinterpret_cast<const __m128i *>(secret) + i));
+        const __m128i high = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 3, 0, 1));
+        const __m128i productLow = _mm_mul_epu32(v, prime);
+        const __m128i productHigh = _mm_mul_epu32(high, prime);
+        _mm_store_si128(a + i, _mm_add_epi64(productLow, _mm_slli_epi64(productHigh, 32)));
+    }
+}
+
+CPU_TARGET("avx2")
+void accumulateAvx2(quint64 *acc, const uchar *p, const uchar *secret, size_t stripes)
+{
+    __m256i *a = reinterpret_cast<__m256i *>(acc);
+    __m256i a0 = _mm256_load_si256(a), a1 = _mm256_load_si256(a + 1);
+
+    for (size_t n = 0; n < stripes; ++n, p += STRIPE_LEN, secret += SECRET_CONSUME_RATE) {
+        const __m256i d0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+        const __m256i d1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 32));
+        const __m256i k0 = _mm256_xor_si256(d0, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(secret)));
+        const __m256i k1 = _mm256_xor_si256(d1, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(secret + 32)));
+        const __m256i p0 = _mm256_mul_epu32(k0, _mm256_shuffle_epi32(k0, _MM_SHUFFLE(0, 3, 0, 1)));
+        const __m256i p1 = _mm256_mul_epu32(k1, _mm256_shuffle_epi32(k1, _MM_SHUFFLE(0, 3, 0, 1)));
+        a0 = _mm256_add_epi64(p0, _mm256_add_epi64(a0, _mm256_shuffle_epi32(d0, _MM_SHUFFLE(1, 0, 3, 2))));
+        a1 = _mm256_add_epi64(p1, _mm256_add_epi64(a1, _mm256_shuffle_epi32(d1, _MM_SHUFFLE(1, 0, 3, 2))));
+    }
+    _mm256_store_si256(a, a0);
+    _mm256_store_si256(a + 1, a1);
+}
+
+CPU_TARGET("avx2")
+void scrambleAvx2(quint64 *acc, const uchar *secret)
+{
+    const __m256i prime = _mm256_set1_epi32(int(PRIME32_1));
+    __m256i *a = reinterpret_cast<__m256i *>(acc);
+    for (int i = 0; i < 2; ++i) {
+        __m256i v = _mm256_load_si256(a + i);
+        v = _mm256_xor_si256(v, _mm256_srli_epi64(v, 47));
+        v = _mm256_xor_si256(v, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(secret) + i));
+        const __m256i high = _mm256_shuffle_epi32(v, _MM_SHUFFLE(0, 3, 0, 1));
+        const __m256i productLow = _mm256_mul_epu32(v, prime);
+        const __m256i productHigh = _mm256_mul_epu32(high, prime);
+        _mm256_store_si256(a + i, _mm256_add_epi64(productLow, _mm256_slli_epi64(productHigh, 32)));
+    }
+}
+
+#endif // CPU_X86
+
+struct Kernels
+{
+    AccumulateFunction accumulate;
+    ScrambleFunction scramble;
+    const char *name;
+};
+
+const Kernels &kernels()
+{
+    static const Kernels k = []() -> Kernels {
+#if CPU_X86
+        if (cpuFeatures().avx2)
+            return {accumulateAvx2, scrambleAvx2, "AVX2"};
+        if (cpuFeatures().sse2)
+            return {accumulateSse2, scrambleSse2, "SSE2"};
+#endif
+        return {accumulateScalar, scrambleScalar, "scalar"};
+    }();
+    return k;
+}
+
+/**
+ * @brief Accumulates @p stripes stripes, scrambling at every block boundary.
+ * @param stripesSoFar Stripes already accumulated in the current block; updated
+ */
+void consumeStripes(quint64 *acc, int &stripesSoFar, const uchar *p, size_t stripes)
+{
+    const Kernels &k = kernels();
+    while (stripes > 0) {
+        const size_t n = qMin(stripes, size_t(STRIPES_PER_BLOCK - stripesSoFar));
+        k.accumulate(acc, p, kSecret + stripesSoFar * SECRET_CONSUME_RATE, n);
+        p += n * STRIPE_LEN;
+        stripes -= n;
+        stripesSoFar += int(n);
+        if (stripesSoFar == STRIPES_PER_BLOCK) {
+            k.scramble(acc, kSecret + SECRET_LIMIT);
+            stripesSoFar = 0;
+        }
+    }
+}
+
+/// Folds the accumulators into 64 bits
+quint64 mergeAccs(const quint64 *acc, const uchar *secret, quint64 start)
+{
+    quint64 result = start;
+    for (int i = 0; i < 4; ++i)
+        result += mulFold64(acc[2 * i] ^ read64(secret + 16 * i), acc[2 * i + 1] ^ read64(secret + 16 * i + 8));
+    return avalanche(result);
+}
+
+/// Accumulates an input longer than 240 bytes, including its final stripe
+void hashLong(quint64 *acc, const uchar *p, size_t len)
+{
+    std::memcpy(acc, INIT_ACC, sizeof(INIT_ACC));
+    int stripesSoFar = 0;
+    // Every whole stripe except the last, which is always taken from the very end
+    consumeStripes(acc, stripesSoFar, p, (len - 1) / STRIPE_LEN);
+    kernels().accumulate(acc, p + len - STRIPE_LEN, kSecret + SECRET_LIMIT - 7, 1);
+}
+
+quint64 long64(const quint64 *acc, quint64 len)
+{
+    return mergeAccs(acc, kSecret + 11, len * PRIME64_1);
+}
+
+Hash128 long128(const quint64 *acc, quint64 len)
+{
+    return {mergeAccs(acc, kSecret + 11, len * PRIME64_1),
+            mergeAccs(acc, kSecret + SECRET_SIZE - 64 - 11, ~(len * PRIME64_2))};
+}
+
+} // namespace
+
+quint64 XxHash3::hash64(const void *data, qsizetype len)
+{
+    const uchar *p = static_cast<const uchar *>(data);
+    const size_t n = len > 0 ? size_t(len) : 0;
+    if (n <= 16)
+        return short64(p, n);
+    if (n <= MIDSIZE_MAX)
+        return medium64(p, n);
+    alignas(64) quint64 acc[8];
+    hashLong(acc, p, n);
+    return long64(acc, n);
+}
+
+XxHash3::Hash128 XxHash3::hash128(const void *data, qsizetype len)
+{
+    const uchar *p = static_cast<const uchar *>(data);
+    const size_t n = len > 0 ? size_t(len) : 0;
+    if (n <= 16)
+        return short128(p, n);
+    if (n <= MIDSIZE_MAX)
+        return medium128(p, n);
+    alignas(64) quint64 acc[8];
+    hashLong(acc, p, n);
+    return long128(acc, n);
+}
+
+void XxHash3::State::reset()
+{
+    std::memcpy(m_acc, INIT_ACC, sizeof(INIT_ACC));
+    m_bufferedSize = 0;
+    m_stripesSoFar = 0;
+    m_totalLen = 0;
+}
+
+void XxHash3::State::update(const void *data, qsizetype len)
+{
+    if (len <= 0)
+        return;
+    const uchar *p = static_cast<const uchar *>(data);
+    const uchar *const end = p + len;
+    m_totalLen += quint64(len);
+
+    if (len <= BUFFER_SIZE - m_bufferedSize) {
+        std::memcpy(m_buffer + m_bufferedSize, p, size_t(len));
+        m_bufferedSize += int(len);
+        return;
+    }
+
+    // The buffer is only consumed once more data follows it, so the final
+    // stripe is always still buffered when digest() runs
+    if (m_bufferedSize) {
+        const int fill = BUFFER_SIZE - m_bufferedSize;
+        std::memcpy(m_buffer + m_bufferedSize, p, size_t(fill));
+        p += fill;
+        consumeStripes(m_acc, m_stripesSoFar, m_buffer, BUFFER_SIZE / STRIPE_LEN);
+        m_bufferedSize = 0;
+    }
+    if (end - p > BUFFER_SIZE) {
+        const size_t stripes = size_t(end - 1 - p) / STRIPE_LEN;
+        consumeStripes(m_acc, m_stripesSoFar, p, stripes);
+        p += stripes * STRIPE_LEN;
+        // digestLong() may need the stripe before the remainder
+        std::memcpy(m_buffer + BUFFER_SIZE - STRIPE_LEN, p - STRIPE_LEN, STRIPE_LEN);
+    }
+    std::memcpy(m_buffer, p, size_t(end - p));
+    m_bufferedSize = int(end - p);
+}
+
+void XxHash3::State::digestLong(quint64 acc[8]) const
+{
+    std::memcpy(acc, m_acc, sizeof(m_acc));
+    uchar lastStripe[STRIPE_LEN];
+    const uchar *last;
+    if (m_bufferedSize >= STRIPE_LEN) {
+        int stripesSoFar = m_stripesSoFar;
+        consumeStripes(acc, stripesSoFar, m_buffer, size_t(m_bufferedSize - 1) / STRIPE_LEN);
+        last = m_buffer + m_bufferedSize - STRIPE_LEN;
+    } else {
+        // The final stripe straddles the previous buffer contents
+        const int catchUp = STRIPE_LEN - m_bufferedSize;
+        std::memcpy(lastStripe, m_buffer + BUFFER_SIZE - catchUp, size_t(catchUp));
+        std::memcpy(lastStripe + catchUp, m_buffer, size_t(m_bufferedSize));
+        last = lastStripe;
+    }
+    kernels().accumulate(acc, last, kSecret + SECRET_LIMIT - 7, 1);
+}
+
+quint64 XxHash3::State::digest64() const
+{
+    if (m_totalLen <= quint64(MIDSIZE_MAX))
+        return hash64(m_buffer, qsizetype(m_totalLen));
+    alignas(64) quint64 acc[8];
+    digestLong(acc);
+    return long64(acc, m_totalLen);
+}
+
+XxHash3::Hash128 XxHash3::State::digest128() const
+{
+    if (m_totalLen <= quint64(MIDSIZE_MAX))
+        return hash128(m_buffer, qsizetype(m_totalLen));
+    alignas(64) quint64 acc[8];
+    digestLong(acc);
+    return long128(acc, m_totalLen);
+}
+
+const char *XxHash3::implementation()
+{
+    return kernels().name;
+}
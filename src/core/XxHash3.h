@@ -0,0 +1,74 @@
+/**
+ * @file XxHash3.h
+ * @brief XXH3 64- and 128-bit non-cryptographic hashes.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * XXH3 as specified by xxHash 0.8 with seed 0 and the default secret, so
+ * results match `xxhsum -H3` and `xxhsum -H2`. Inputs up to 240 bytes take
+ * dedicated short paths. Longer inputs are consumed in 64-byte stripes by
+ * eight 64-bit accumulators; on x86 the stripe loop runs on AVX2 or SSE2,
+ * picked at first use from CPUID.
+ *
+ * XXH3 is not a cryptographic hash: it detects corruption, not tampering.
+ */
+
+#ifndef XXHASH3_H
+#define XXHASH3_H
+
+#include <QtGlobal>
+
+namespace XxHash3 {
+
+struct Hash128 {
+    quint64 low = 0;
+    quint64 high = 0;
+};
+
+/// XXH3_64bits() of @p len bytes
+quint64 hash64(const void *data, qsizetype len);
+
+/// XXH3_128bits() of @p len bytes
+Hash128 hash128(const void *data, qsizetype len);
+
+/**
+ * @brief Streaming state; one instance serves both widths.
+ *
+ * digest64() and digest128() of the data added since reset() equal
+ * hash64() and hash128() of the concatenated data.
+ */
+class State
+{
+public:
+    State() { reset(); }
+
+    void reset();
+    void update(const void *data, qsizetype len);
+
+    quint64 digest64() const;
+    Hash128 digest128() const;
+
+private:
+    static const int BUFFER_SIZE = 256;
+
+    alignas(64) quint64 m_acc[8];
+    alignas(64) uchar m_buffer[BUFFER_SIZE];
+    int m_bufferedSize = 0;
+    int m_stripesSoFar = 0;     ///< Stripes accumulated in the current block
+    quint64 m_totalLen = 0;
+
+    void digestLong(quint64 acc[8]) const;
+};
+
+/**
+ * @brief Names the stripe kernel in use: "AVX2", "SSE2" or "scalar".
+ */
+const char *implementation();
+
+} // namespace XxHash3
+
+#endif // XXHASH3_H
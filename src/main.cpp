@@ -17,10 +17,12 @@
 #include "macros.h"
 
 #include "MainWindow.h"
+#include "SerialPortRegistry.h"
 int main(int argc, char *argv[])
 {
     QApplication a(argc, argv);
     a.setApplicationVersion(APP_VERSION);
+    SerialPortRegistry::instance(); // One-time port scan before any tab is created
     MainWindow w;
     w.show();
 
@@ -0,0 +1,172 @@
+/**
+ * @file ChecksumEngine.cpp
+ * @brief Implementation of the parallel file hashing engine.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "ChecksumEngine.h"
+
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QThread>
+
+ChecksumEngine::ChecksumEngine(QObject *parent) :
+    QObject(parent)
+{
+    m_pool.setMaxThreadCount(QThread::idealThreadCount());
+    setIoConcurrency(2);
+}
+
+ChecksumEngine::~ChecksumEngine()
+{
+    cancelAll();
+    m_pool.waitForDone();
+}
+
+void ChecksumEngine::setIoConcurrency(int readers)
+{
+    readers = qMax(1, readers);
+    if (readers > m_ioConcurrency)
+        m_ioSlots.release(readers - m_ioConcurrency);
+    else if (readers < m_ioConcurrency)
+        // Take the surplus slots back as the running reads return them
+        m_pool.start([this, surplus = m_ioConcurrency - readers]() { m_ioSlots.acquire(surplus); });
+    m_ioConcurrency = readers;
+}
+
+void ChecksumEngine::addPaths(const QStringList &paths, const QList<FileHasher::Algorithm> &algorithms)
+{
+    addJobs({Job{paths, algorithms}});
+}
+
+void ChecksumEngine::addJobs(const QList<Job> &jobs)
+{
+    if (m_pending.load() == 0) {
+        m_files = 0;
+        m_cachedFiles = 0;
+        m_bytes = 0;
+        m_batchTimer.start();
+    }
+
+    // Hold the batch open until everything is queued, or a cache hit that
+    // returns at once could bring m_pending to 0 and finish it early
+    ++m_pending;
+    const quint64 generation = m_generation.load();
+    for (const Job &job : jobs) {
+        const Algorithms &algorithms = job.algorithms;
+        for (const QString &path : job.paths) {
+            if (QFileInfo(path).isDir())
+                submit([this, path, algorithms, generation]() { walkDirectory(path, algorithms, generation); });
+            else
+                queueFile(path, algorithms, generation);
+        }
+    }
+    release();
+}
+
+void ChecksumEngine::cancelAll()
+{
+    // Queued tasks still run, see the new generation and return at once
+    ++m_generation;
+}
+
+void ChecksumEngine::submit(const std::function<void()> &task)
+{
+    ++m_pending;
+    m_pool.start([this, task]() {
+        task();
+        release();
+    });
+}
+
+/**
+ * @brief Drops one pending count; the last one reports the batch.
+ */
+void ChecksumEngine::release()
+{
+    if (--m_pending == 0)
+        emit finished(m_files.load(), m_cachedFiles.load(), m_bytes.load(), m_batchTimer.elapsed());
+}
+
+void ChecksumEngine::walkDirectory(const QString &path, const Algorithms &algorithms, quint64 generation)
+{
+    // Subdirectories become their own tasks so wide trees are listed in parallel
+    QDirIterator it(path, QDir::Files | QDir::Dirs | QDir::NoDotAndDotDot | QDir::Hidden | QDir::NoSymLinks);
+    while (it.hasNext()) {
+        if (m_generation.load() != generation)
+            return;
+        const QString entry = it.next();
+        if (it.fileInfo().isDir())
+            submit([this, entry, algorithms, generation]() { walkDirectory(entry, algorithms, generation); });
+        else
+            queueFile(entry, algorithms, generation);
+    }
+}
+
+void ChecksumEngine::queueFile(const QString &path, const Algorithms &algorithms, quint64 generation)
+{
+    emit fileQueued(path);
+    submit([this, path, algorithms, generation]() { hashFile(path, algorithms, generation); });
+}
+
+void ChecksumEngine::hashFile(const QString &path, const Algorithms &algorithms, quint64 generation)
+{
+    if (m_generation.load() != generation)
+        return;
+
+    FileHashCache::Identity identity;
+    const bool identified = FileHashCache::identify(path, &identity);
+
+    QStringList results;
+    Algorithms missing;
+    for (FileHasher::Algorithm algorithm : algorithms) {
+        QString result;
+        if (!identified || !m_cache.lookup(path, identity, algorithm, &result))
+            missing << algorithm;
+        results << result;
+    }
+
+    QString error;
+    if (!missing.isEmpty()) {
+        QElapsedTimer sinceReport;
+        sinceReport.start();
+        auto progress = [&](qint64 done, qint64 total) {
+            if (m_generation.load() != generation)
+                return false;
+            if (sinceReport.elapsed() >= 100) {
+                sinceReport.restart();
+                emit fileProgress(path, done, total);
+            }
+            return true;
+        };
+
+        const QStringList computed = FileHasher::hashFileAll(path, missing, progress, &error, &m_ioSlots);
+        if (m_generation.load() != generation)
+            return;
+
+        if (!computed.isEmpty()) {
+            // Only cache if the file did not change while it was being read
+            FileHashCache::Identity after;
+            const bool cacheable = identified && FileHashCache::identify(path, &after) && after == identity;
+            for (int i = 0, j = 0; i < algorithms.size(); ++i) {
+                if (!results[i].isEmpty())
+                    continue;
+                results[i] = computed[j++];
+                if (cacheable)
+                    m_cache.insert(path, identity, algorithms[i], results[i]);
+            }
+            ++m_files;
+            m_bytes += identified ? identity.size : QFileInfo(path).size();
+        }
+    } else {
+        ++m_files;
+        ++m_cachedFiles;
+    }
+
+    for (int i = 0; i < algorithms.size(); ++i)
+        emit fileFinished(path, algorithms[i], results[i], results[i].isEmpty() ? error : QString());
+}
@@ -0,0 +1,128 @@
+/**
+ * @file ChecksumEngine.h
+ * @brief Parallel file hashing on a worker pool.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * Files are hashed on a private QThreadPool with one thread per core.
+ * Dropped directories are walked on the same pool, one task per
+ * subdirectory, and every file found is queued as soon as it is seen.
+ * Hashing is CPU-parallel but disk reads are not unbounded: at most
+ * ioConcurrency() files are open at once, each read start to end before
+ * its slot goes to the next file, so a spinning disk serves a few long
+ * sequential streams instead of seeking between hundreds. Each file is
+ * hashed as it is read, so fast disks want as many readers as cores.
+ *
+ * Every algorithm requested for a file is computed in the same read pass,
+ * and results are kept in a FileHashCache. A file whose size, mtime and
+ * inode are unchanged is answered from the cache without being opened.
+ *
+ * All signals are emitted from worker threads; connect with the default
+ * (queued) connection type from GUI objects.
+ */
+
+#ifndef CHECKSUMENGINE_H
+#define CHECKSUMENGINE_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QSemaphore>
+#include <QStringList>
+#include <QThreadPool>
+
+#include <atomic>
+#include <functional>
+
+#include "FileHashCache.h"
+#include "FileHasher.h"
+
+class ChecksumEngine : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit ChecksumEngine(QObject *parent = nullptr);
+
+    /**
+     * @brief Cancels outstanding work and waits for the workers.
+     */
+    ~ChecksumEngine() override;
+
+    /**
+     * @brief Maximum number of files open for reading at once (default 2).
+     *        Takes effect for files opened after the call.
+     */
+    void setIoConcurrency(int readers);
+    int ioConcurrency() const { return m_ioConcurrency; }
+
+    /**
+     * @brief True while queued files or directory walks are outstanding.
+     */
+    bool isBusy() const { return m_pending.load() > 0; }
+
+    /**
+     * @brief Queues files and (recursively) directories for hashing.
+     * @param algorithms Computed together; fileFinished() is emitted once per
+     *        algorithm
+     */
+    void addPaths(const QStringList &paths, const QList<FileHasher::Algorithm> &algorithms);
+
+    /// Paths queued with their own algorithms, see addJobs()
+    struct Job {
+        QStringList paths;
+        QList<FileHasher::Algorithm> algorithms;
+    };
+
+    /**
+     * @brief Queues several addPaths() calls as one batch: finished() is not
+     *        emitted before all of them are queued.
+     */
+    void addJobs(const QList<Job> &jobs);
+
+    /**
+     * @brief Forgets all cached results.
+     */
+    void clearCache() { m_cache.clear(); }
+
+    /**
+     * @brief Abandons everything queued or running. In-flight files stop at
+     *        their next chunk and report nothing; finished() still follows.
+     */
+    void cancelAll();
+
+signals:
+    void fileQueued(const QString &path);
+    void fileProgress(const QString &path, qint64 bytesDone, qint64 bytesTotal);
+    void fileFinished(const QString &path, int algorithm, const QString &result, const QString &error);
+
+    /**
+     * @brief Everything queued since the engine was last idle is done.
+     */
+    void finished(qint64 files, qint64 cachedFiles, qint64 bytesRead, qint64 elapsedMs);
+
+private:
+    using Algorithms = QList<FileHasher::Algorithm>;
+
+    void submit(const std::function<void()> &task);
+    void release();
+    void walkDirectory(const QString &path, const Algorithms &algorithms, quint64 generation);
+    void queueFile(const QString &path, const Algorithms &algorithms, quint64 generation);
+    void hashFile(const QString &path, const Algorithms &algorithms, quint64 generation);
+
+    QThreadPool m_pool;
+    QSemaphore m_ioSlots;
+    int m_ioConcurrency = 0;
+    std::atomic<quint64> m_generation{0};
+    std::atomic<int> m_pending{0};
+    std::atomic<qint64> m_files{0};
+    std::atomic<qint64> m_cachedFiles{0};
+    std::atomic<qint64> m_bytes{0};
+    QElapsedTimer m_batchTimer;
+    FileHashCache m_cache;
+};
+
+#endif // CHECKSUMENGINE_H
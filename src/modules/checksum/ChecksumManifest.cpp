@@ -0,0 +1,269 @@
+/**
+ * @file ChecksumManifest.cpp
+ * @brief Implementation of the checksum manifest reader and writer.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "ChecksumManifest.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QRegularExpression>
+
+#include <array>
+#include <iterator>
+
+namespace {
+
+struct Tag
+{
+    const char *name;
+    FileHasher::Algorithm algorithm;
+};
+
+/// BSD tags and file name stems; the first one of an algorithm names its manifests
+const Tag TAGS[] = {
+    {"MD5", FileHasher::MD5},
+    {"SHA1", FileHasher::SHA1},
+    {"SHA256", FileHasher::SHA256},
+    {"SHA384", FileHasher::SHA384},
+    {"SHA512", FileHasher::SHA512},
+    {"SHA3-256", FileHasher::SHA3_256},
+    {"SHA3-512", FileHasher::SHA3_512},
+    {"B3", FileHasher::BLAKE3},
+    {"BLAKE3", FileHasher::BLAKE3},
+    {"XXH3", FileHasher::XXH3_64},
+    {"XXH128", FileHasher::XXH3_128},
+    {"CRC8", FileHasher::CRC8},
+    {"CRC16", FileHasher::CRC16},
+    {"CRC32", FileHasher::CRC32},
+    {"CRC32C", FileHasher::CRC32C},
+    {"CRC64", FileHasher::CRC64},
+    {"ADLER32", FileHasher::ADLER32},
+};
+
+/// Tried in this order when neither a tag nor the file name says more.
+/// Not XXH3_64: a bare 16-digit digest is XXH64, so such lines are skipped.
+const FileHasher::Algorithm BY_LENGTH[] = {
+    FileHasher::MD5, FileHasher::SHA1, FileHasher::SHA256, FileHasher::SHA384,
+    FileHasher::SHA512, FileHasher::CRC32,
+};
+
+int digestLength(FileHasher::Algorithm algorithm)
+{
+    static const std::array<int, FileHasher::ALGORITHM_COUNT> lengths = [] {
+        std::array<int, FileHasher::ALGORITHM_COUNT> l;
+        for (int i = 0; i < FileHasher::ALGORITHM_COUNT; ++i)
+            l[i] = int(FileHasher(FileHasher::Algorithm(i)).result().size());
+        return l;
+    }();
+    return lengths[algorithm];
+}
+
+/// Tag names compare case-insensitively and without '-' or '_'
+QString normalizedTag(const QString &tag)
+{
+    QString t = tag.toUpper();
+    t.remove('-');
+    t.remove('_');
+    return t;
+}
+
+bool findTag(const QString &name, FileHasher::Algorithm *algorithm)
+{
+    const QString wanted = normalizedTag(name);
+    for (const Tag &tag : TAGS) {
+        if (normalizedTag(QLatin1String(tag.name)) == wanted) {
+            *algorithm = tag.algorithm;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Algorithm implied by a manifest's file name: the extension
+ *        ("fw.sha256", "fw.md5sum") or the stem of "SHA256SUMS", "B3SUMS".
+ */
+bool algorithmFromFileName(const QString &path, FileHasher::Algorithm *algorithm)
+{
+    const QFileInfo info(path);
+    QStringList stems{info.suffix(), info.fileName()};
+    for (QString &stem : stems) {
+        if (stem.endsWith(QLatin1String("sums"), Qt::CaseInsensitive))
+            stem.chop(4);
+        else if (stem.endsWith(QLatin1String("sum"), Qt::CaseInsensitive))
+            stem.chop(3);
+        if (!stem.isEmpty() && findTag(stem, algorithm))
+            return true;
+    }
+    return false;
+}
+
+bool isHex(const QString &s)
+{
+    static const QRegularExpression hex("^[0-9A-Fa-f]+$");
+    return hex.match(s).hasMatch();
+}
+
+/// Undoes the GNU escaping of '\\' and newlines in names
+QString unescapeName(const QString &name)
+{
+    QString out;
+    out.reserve(name.size());
+    for (int i = 0; i < name.size(); ++i) {
+        if (name[i] == '\\' && i + 1 < name.size()) {
+            ++i;
+            out += name[i] == 'n' ? QChar('\n') : name[i];
+        } else {
+            out += name[i];
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+bool ChecksumManifest::looksLikeManifest(const QString &path)
+{
+    FileHasher::Algorithm algorithm;
+    return algorithmFromFileName(path, &algorithm)
+           || QFileInfo(path).fileName().endsWith(QLatin1String("SUMS"), Qt::CaseInsensitive);
+}
+
+bool ChecksumManifest::read(const QString &path, QList<Entry> *entries, int *skippedLines,
+                            QString *errorMessage)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        if (errorMessage)
+            *errorMessage = file.errorString();
+        return false;
+    }
+
+    static const QRegularExpression bsdLine("^([A-Za-z0-9_-]+) ?\\((.*)\\) ?= ?([0-9A-Fa-f]+)$");
+
+    FileHasher::Algorithm fromName = FileHasher::SHA256;
+    const bool named = algorithmFromFileName(path, &fromName);
+    const QDir base = QFileInfo(path).absoluteDir();
+    int skipped = 0;
+
+    const QList<QByteArray> lines = file.readAll().split('\n');
+    for (const QByteArray &raw : lines) {
+        QString line = QString::fromUtf8(raw);
+        if (line.endsWith('\r'))
+            line.chop(1);
+        if (line.trimmed().isEmpty())
+            continue;
+
+        const bool escaped = line.startsWith('\\');
+        if (escaped)
+            line.remove(0, 1);
+
+        Entry entry;
+        QString name;
+        bool known = false;
+        const QRegularExpressionMatch bsd = bsdLine.match(line);
+        if (bsd.hasMatch()) {
+            known = findTag(bsd.captured(1), &entry.algorithm);
+            name = bsd.captured(2);
+            entry.digest = bsd.captured(3);
+        } else {
+            // digest, then ' ' and ' ' (text) or '*' (binary), then the name
+            const int space = int(line.indexOf(' '));
+            if (space > 0 && space + 2 <= line.size()
+                && (line[space + 1] == ' ' || line[space + 1] == '*')) {
+                entry.digest = line.left(space);
+                name = line.mid(space + 2);
+            }
+            // xxhsum marks XXH3 digests, whose length is ambiguous otherwise
+            if (entry.digest.startsWith(QLatin1String("XXH3_"))) {
+                entry.digest.remove(0, 5);
+                entry.algorithm = FileHasher::XXH3_64;
+                known = true;
+            }
+        }
+
+        if (name.isEmpty() || !isHex(entry.digest)) {
+            ++skipped;
+            continue;
+        }
+
+        if (!known && named && digestLength(fromName) == entry.digest.size()) {
+            entry.algorithm = fromName;
+            known = true;
+        }
+        for (int i = 0; !known && i < int(std::size(BY_LENGTH)); ++i) {
+            if (digestLength(BY_LENGTH[i]) == entry.digest.size()) {
+                entry.algorithm = BY_LENGTH[i];
+                known = true;
+            }
+        }
+        if (!known || digestLength(entry.algorithm) != entry.digest.size()) {
+            ++skipped;
+            continue;
+        }
+
+        if (escaped)
+            name = unescapeName(name);
+        name = QDir::fromNativeSeparators(name);
+        entry.path = QDir::cleanPath(base.absoluteFilePath(name));
+        entry.digest = entry.digest.toUpper();
+        entries->append(entry);
+    }
+
+    if (skippedLines)
+        *skippedLines = skipped;
+    return true;
+}
+
+bool ChecksumManifest::write(const QString &path, const QList<Entry> &entries, QString *errorMessage)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        if (errorMessage)
+            *errorMessage = file.errorString();
+        return false;
+    }
+
+    const QDir base = QFileInfo(path).absoluteDir();
+    QByteArray text;
+    for (const Entry &entry : entries) {
+        QString name = base.relativeFilePath(entry.path);
+        // Same escaping as coreutils: a leading '\' announces escapes in the name
+        const bool escape = name.contains('\\') || name.contains('\n');
+        if (escape) {
+            name.replace(QLatin1String("\\"), QLatin1String("\\\\"));
+            name.replace(QLatin1String("\n"), QLatin1String("\\n"));
+            text += '\\';
+        }
+        // xxhsum reads a bare 16-digit digest as XXH64; XXH3 needs its marker
+        if (entry.algorithm == FileHasher::XXH3_64)
+            text += "XXH3_";
+        text += entry.digest.toLower().toLatin1();
+        text += "  ";
+        text += name.toUtf8();
+        text += '\n';
+    }
+
+    if (file.write(text) != text.size()) {
+        if (errorMessage)
+            *errorMessage = file.errorString();
+        return false;
+    }
+    return true;
+}
+
+QString ChecksumManifest::defaultFileName(FileHasher::Algorithm algorithm)
+{
+    for (const Tag &tag : TAGS) {
+        if (tag.algorithm == algorithm)
+            return QLatin1String(tag.name) + QLatin1String("SUMS");
+    }
+    return QStringLiteral("CHECKSUMS");
+}
@@ -0,0 +1,72 @@
+/**
+ * @file ChecksumManifest.h
+ * @brief Reading and writing sha256sum-style checksum manifests.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * Two line formats are understood:
+ *  - GNU, as written by sha256sum, md5sum and b3sum: `digest  name`, with
+ *    `*` instead of the second space for binary mode, and a leading `\`
+ *    when the name contains an escaped backslash or newline;
+ *  - BSD tags (`--tag`): `SHA256 (name) = digest`.
+ *
+ * The algorithm comes from the BSD tag, else from the manifest's file name
+ * (SHA256SUMS, firmware.md5, B3SUMS, ...) as long as the digest length
+ * agrees, else from the digest length alone. A bare 16-digit digest is
+ * XXH64 to xxhsum, which is not supported, so XXH3-64 is only recognised
+ * by its "XXH3_" prefix, a tag or the file name. Names are resolved against
+ * the manifest's directory. Lines that cannot be used, such as blank
+ * lines, comments and unknown algorithms, are counted and skipped.
+ */
+
+#ifndef CHECKSUMMANIFEST_H
+#define CHECKSUMMANIFEST_H
+
+#include <QList>
+#include <QString>
+
+#include "FileHasher.h"
+
+class ChecksumManifest
+{
+public:
+    struct Entry
+    {
+        QString path;                   ///< Absolute path of the listed file
+        QString digest;                 ///< Upper-case hex, as FileHasher::result() gives it
+        FileHasher::Algorithm algorithm = FileHasher::SHA256;
+    };
+
+    /**
+     * @brief True if the file name marks a manifest (SHA256SUMS, *.sha256,
+     *        *.md5, *.b3, ...) rather than data to be hashed.
+     */
+    static bool looksLikeManifest(const QString &path);
+
+    /**
+     * @brief Reads all usable entries of a manifest.
+     * @param skippedLines Optional; receives the number of non-empty lines
+     *        that were not understood
+     * @return false if the file cannot be read
+     */
+    static bool read(const QString &path, QList<Entry> *entries, int *skippedLines = nullptr,
+                     QString *errorMessage = nullptr);
+
+    /**
+     * @brief Writes entries in GNU format, with lower-case digests and names
+     *        relative to the manifest's directory where possible. XXH3-64
+     *        digests carry xxhsum's "XXH3_" prefix.
+     */
+    static bool write(const QString &path, const QList<Entry> &entries, QString *errorMessage = nullptr);
+
+    /**
+     * @brief Conventional manifest name for an algorithm, e.g. "SHA256SUMS".
+     */
+    static QString defaultFileName(FileHasher::Algorithm algorithm);
+};
+
+#endif // CHECKSUMMANIFEST_H
@@ -3,8 +3,19 @@
  * @brief Checksum calculator widget supporting multiple hash algorithms.
  *
  * This widget provides a file checksum calculator interface supporting
- * CRC-16, CRC-32, MD5, SHA-1, and SHA-256 algorithms. Features include
- * drag & drop file import, copy-to-clipboard, and batch file processing.
+ * CRC-8/16/32/32C/64, Adler-32, MD5, the SHA families, XXH3 and BLAKE3. The
+ * CRCs, XXH3 and BLAKE3 use the SIMD kernels in Crc.h, XxHash3.h and
+ * Blake3.h. Features include
+ * drag & drop file and folder import, copy-to-clipboard, and batch file
+ * processing. Hashing runs on a ChecksumEngine worker pool, so the window
+ * stays responsive and each row shows its own progress. Algorithms ticked
+ * under "Also Compute" are hashed in the same pass and cached, so switching
+ * to them does not read the files again.
+ *
+ * A checksum manifest (SHA256SUMS, *.md5, B3SUMS, ...) opened with "Verify
+ * Manifest" or dropped onto the table queues every listed file on the same
+ * pool; each row then shows OK, FAILED or MISSING. "Export Manifest" writes
+ * the displayed checksums back out in sha256sum format.
  *
  * @project PacketForge
  * @author Ritesh Pandit (Riteshp2001)
@@ -40,6 +51,15 @@
 #include <QHBoxLayout>
 #include <QTextEdit>
 #include <QTextOption>
+#include <QHash>
+#include <QMenu>
+#include <QSet>
+
+#include <array>
+
+#include "ChecksumEngine.h"
+#include "ChecksumManifest.h"
+#include "FileHasher.h"
 
 QT_BEGIN_NAMESPACE
 namespace Ui { class ChecksumWidget; }
@@ -68,36 +88,9 @@ public:
     ~ChecksumWidget();
 
     /**
-     * @brief Calculates checksum for a file using current algorithm.
-     * @param filePath Path to the file
-     * @return Checksum as hex string
-     */
-    QString CalculateChecksum(const QString &filePath);
-
-    /**
-     * @brief Computes CRC-16 value.
-     * @param message Data buffer
-     * @param blk_len Buffer length
-     * @return CRC-16 value
+     * @brief Supported checksum algorithms (combo box order).
      */
-    unsigned short computeCrc(unsigned char *message, qint64 blk_len);
-
-    /**
-     * @brief Supported checksum algorithms.
-     */
-    enum ChecksumType {
-        CRC8,
-        CRC16,
-        CRC32,
-        ADLER32,
-        MD5,
-        SHA1,
-        SHA256,
-        SHA384,
-        SHA512,
-        SHA3_256,
-        SHA3_512
-    };
+    using ChecksumType = FileHasher::Algorithm;
 
 protected:
     void dragEnterEvent(QDragEnterEvent *event) override;
@@ -109,18 +102,49 @@ private slots:
     void onTableItemClicked(int row, int column);
     void onTableItemDoubleClicked(int row, int column);
     void onChecksumTypeChanged(int index);
+    void on_btnCancel_clicked();
+    void on_btnVerifyManifest_clicked();
+    void on_btnExportManifest_clicked();
+    void onFileQueued(const QString &path);
+    void onFileProgress(const QString &path, qint64 bytesDone, qint64 bytesTotal);
+    void onFileFinished(const QString &path, int algorithm, const QString &result, const QString &error);
+    void onEngineFinished(qint64 files, qint64 cachedFiles, qint64 bytesRead, qint64 elapsedMs);
 
 private:
+    /// Outcome of checking a file against its manifest entry
+    enum Verdict {
+        Pending,
+        Passed,
+        Failed,
+        Missing,
+        Unreadable,
+        NotChecked,             ///< Cancelled before it was hashed
+        VERDICT_COUNT
+    };
+
     Ui::ChecksumWidget *ui;
     ChecksumType currentType;
+    ChecksumEngine *m_engine;
+    QMenu *m_alsoComputeMenu;
+    QHash<QString, int> m_rows;     ///< Full path -> table row
+    QSet<QString> m_pending;        ///< Paths queued but not yet reported
+    int m_queuedCount = 0;
+    QHash<QString, ChecksumManifest::Entry> m_expected;    ///< Full path -> manifest entry
+    QHash<QString, Verdict> m_verdicts;
+    std::array<int, VERDICT_COUNT> m_verdictCounts{};
+    int m_skippedLines = 0;         ///< Manifest lines that could not be used
 
     void setupTable();
     int findRowByPath(const QString &fullFilePath);
-    void processFile(const QString &filePath);
+    int addRow(const QString &filePath);
+    void addPaths(const QStringList &paths);
+    QList<FileHasher::Algorithm> requestedAlgorithms() const;
+    void setChecksumText(const QString &filePath, const QString &text);
+    void updateStatus();
     void updateChecksums();
-    unsigned char computeCrc8(const QByteArray &data);
-    unsigned int computeCrc32(const QByteArray &data);
-    unsigned int computeAdler32(const QByteArray &data);
+    void loadManifest(const QString &path);
+    void setVerdict(const QString &path, Verdict verdict, const QString &detail = QString());
+    QString verdictSummary() const;
 };
 
 #endif // CHECKSUMWIDGET_H
@@ -0,0 +1,146 @@
+/**
+ * @file CrcSolverWidget.cpp
+ * @brief Implementation of the CRC solver tool tab.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "CrcSolverWidget.h"
+#include "ui_CrcSolverWidget.h"
+
+#include <QHeaderView>
+#include <QRegularExpression>
+
+CrcSolverWidget::CrcSolverWidget(QWidget *parent) :
+    QWidget(parent),
+    ui(new Ui::CrcSolverWidget),
+    m_solver(new CrcSolver(this))
+{
+    ui->setupUi(this);
+
+    ui->tableResults->verticalHeader()->hide();
+    ui->tableResults->setColumnWidth(0, 180);
+    for (int col = 1; col < ui->tableResults->columnCount() - 1; ++col)
+        ui->tableResults->setColumnWidth(col, col == 1 ? 60 : 150);
+
+    connect(m_solver, &CrcSolver::candidateFound, this, &CrcSolverWidget::onCandidateFound);
+    connect(m_solver, &CrcSolver::progress, this, &CrcSolverWidget::onProgress);
+    connect(m_solver, &CrcSolver::finished, this, &CrcSolverWidget::onFinished);
+}
+
+CrcSolverWidget::~CrcSolverWidget()
+{
+    // Stop the workers before the slots they signal go away
+    delete m_solver;
+    delete ui;
+}
+
+bool CrcSolverWidget::parseFrames(QList<QByteArray> *frames, QString *errorMessage) const
+{
+    static const QRegularExpression separators("0[xX]|[\\s,:;-]");
+    static const QRegularExpression hexDigits("^[0-9A-Fa-f]*$");
+
+    const QStringList lines = ui->txtFrames->toPlainText().split('\n');
+    for (int i = 0; i < lines.size(); ++i) {
+        QString hex = lines[i];
+        hex.remove(separators);
+        if (hex.isEmpty())
+            continue;
+        if (!hexDigits.match(hex).hasMatch() || hex.size() % 2) {
+            *errorMessage = QString("Line %1 is not a whole number of hex bytes").arg(i + 1);
+            return false;
+        }
+        frames->append(QByteArray::fromHex(hex.toLatin1()));
+    }
+    return true;
+}
+
+void CrcSolverWidget::setRunning(bool running)
+{
+    ui->btnSolve->setEnabled(!running);
+    ui->btnCancel->setEnabled(running);
+    ui->spinWidth->setEnabled(!running);
+    ui->spinFrom->setEnabled(!running);
+    ui->spinTo->setEnabled(!running);
+}
+
+void CrcSolverWidget::on_btnSolve_clicked()
+{
+    QList<QByteArray> frames;
+    QString error;
+    if (!parseFrames(&frames, &error)) {
+        ui->lblStatus->setText(error);
+        return;
+    }
+
+    CrcSolver::Settings settings;
+    settings.width = ui->spinWidth->value();
+    settings.from = ui->spinFrom->value();
+    settings.to = ui->spinTo->value();
+
+    ui->tableResults->setRowCount(0);
+    if (!m_solver->solve(frames, settings, &error)) {
+        ui->lblStatus->setText(error);
+        return;
+    }
+    m_cancelled = false;
+    setRunning(true);
+    ui->lblStatus->setText(QString("Searching %1 frames...").arg(frames.size()));
+}
+
+void CrcSolverWidget::on_btnCancel_clicked()
+{
+    m_cancelled = true;
+    m_solver->cancel();
+}
+
+void CrcSolverWidget::onCandidateFound(int index)
+{
+    const CrcSolver::Candidate candidate = m_solver->candidate(index);
+    const Crc::Model &m = candidate.model;
+    const int digits = (m.width + 3) / 4;
+    auto hex = [digits](quint64 value) {
+        return "0x" + QString::number(value, 16).rightJustified(digits, '0').toUpper();
+    };
+
+    const int row = ui->tableResults->rowCount();
+    ui->tableResults->insertRow(row);
+    const QStringList cells = {
+        m.name ? QString(m.name) : QString("Unlisted"),
+        QString::number(m.width),
+        hex(m.poly),
+        hex(m.init),
+        m.refin ? "true" : "false",
+        m.refout ? "true" : "false",
+        hex(m.xorout),
+        hex(m.check),
+        m.width <= 8 ? "-" : (candidate.bigEndian ? "Big-endian" : "Little-endian"),
+    };
+    for (int col = 0; col < cells.size(); ++col) {
+        QTableWidgetItem *item = new QTableWidgetItem(cells[col]);
+        if (candidate.initAmbiguous && (col == 3 || col == 6))
+            item->setToolTip("Other Init/XorOut pairs fit these frames too. "
+                             "Add frames of other lengths to tell them apart.");
+        ui->tableResults->setItem(row, col, item);
+    }
+}
+
+void CrcSolverWidget::onProgress(int tasksDone, int tasksTotal)
+{
+    if (tasksTotal > 0 && m_solver->isBusy())
+        ui->lblStatus->setText(QString("Searching... %1%").arg(tasksDone * 100 / tasksTotal));
+}
+
+void CrcSolverWidget::onFinished(int candidates, qint64 elapsedMs, const QString &note)
+{
+    setRunning(false);
+    QString text = QString("%1 candidate(s) in %2 ms").arg(candidates).arg(elapsedMs);
+    if (m_cancelled)
+        text += " (cancelled)";
+    if (candidates == 0 && !note.isEmpty())
+        text += "\n" + note;
+    ui->lblStatus->setText(text);
+}
@@ -0,0 +1,57 @@
+/**
+ * @file CrcSolverWidget.h
+ * @brief Tool tab that recovers CRC parameters from captured frames.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * Frames are pasted as hex, one per line, each ending in its CRC. The
+ * covered byte range uses the same convention as the Frame CRC check, so a
+ * found catalogue model can be entered there unchanged. Candidates appear
+ * as the CrcSolver workers find them.
+ */
+
+#ifndef CRCSOLVERWIDGET_H
+#define CRCSOLVERWIDGET_H
+
+#include <QWidget>
+
+#include "CrcSolver.h"
+
+namespace Ui {
+class CrcSolverWidget;
+}
+
+class CrcSolverWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit CrcSolverWidget(QWidget *parent = nullptr);
+    ~CrcSolverWidget();
+
+private slots:
+    void on_btnSolve_clicked();
+    void on_btnCancel_clicked();
+
+    void onCandidateFound(int index);
+    void onProgress(int tasksDone, int tasksTotal);
+    void onFinished(int candidates, qint64 elapsedMs, const QString &note);
+
+private:
+    /**
+     * @brief Parses one hex frame per non-empty line.
+     * @return false on odd digit counts or stray characters; @p errorMessage names the line.
+     */
+    bool parseFrames(QList<QByteArray> *frames, QString *errorMessage) const;
+    void setRunning(bool running);
+
+    Ui::CrcSolverWidget *ui;
+    CrcSolver *m_solver;
+    bool m_cancelled = false;
+};
+
+#endif // CRCSOLVERWIDGET_H
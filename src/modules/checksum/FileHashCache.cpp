@@ -0,0 +1,97 @@
+/**
+ * @file FileHashCache.cpp
+ * @brief Implementation of the checksum result cache.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "FileHashCache.h"
+
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QMutexLocker>
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#endif
+
+bool FileHashCache::identify(const QString &path, Identity *identity)
+{
+#ifdef Q_OS_WIN
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+    BY_HANDLE_FILE_INFORMATION info;
+    if (!GetFileInformationByHandle(HANDLE(_get_osfhandle(file.handle())), &info))
+        return false;
+    identity->size = qint64(quint64(info.nFileSizeHigh) << 32 | info.nFileSizeLow);
+    // FILETIME counts 100 ns intervals
+    identity->mtimeNs = qint64(quint64(info.ftLastWriteTime.dwHighDateTime) << 32
+                               | info.ftLastWriteTime.dwLowDateTime) * 100;
+    identity->device = info.dwVolumeSerialNumber;
+    identity->inode = quint64(info.nFileIndexHigh) << 32 | info.nFileIndexLow;
+    return true;
+#elif defined(Q_OS_UNIX)
+    struct stat st;
+    if (::stat(QFile::encodeName(path).constData(), &st) != 0)
+        return false;
+    identity->size = st.st_size;
+#if defined(Q_OS_DARWIN)
+    identity->mtimeNs = qint64(st.st_mtimespec.tv_sec) * 1000000000 + st.st_mtimespec.tv_nsec;
+#else
+    identity->mtimeNs = qint64(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+#endif
+    identity->device = quint64(st.st_dev);
+    identity->inode = quint64(st.st_ino);
+    return true;
+#else
+    QFileInfo info(path);
+    if (!info.exists())
+        return false;
+    identity->size = info.size();
+    identity->mtimeNs = info.lastModified().toMSecsSinceEpoch() * 1000000;
+    return true;
+#endif
+}
+
+FileHashCache::FileHashCache() :
+    m_entries(MAX_FILES)
+{
+}
+
+bool FileHashCache::lookup(const QString &path, const Identity &identity,
+                           FileHasher::Algorithm algorithm, QString *result)
+{
+    QMutexLocker locker(&m_mutex);
+    const Entry *entry = m_entries.object(path);
+    if (!entry || entry->identity != identity || entry->results[algorithm].isEmpty())
+        return false;
+    *result = entry->results[algorithm];
+    return true;
+}
+
+void FileHashCache::insert(const QString &path, const Identity &identity,
+                           FileHasher::Algorithm algorithm, const QString &result)
+{
+    QMutexLocker locker(&m_mutex);
+    Entry *entry = m_entries.object(path);
+    if (!entry || entry->identity != identity) {
+        entry = new Entry;
+        entry->identity = identity;
+        m_entries.insert(path, entry);
+    }
+    entry->results[algorithm] = result;
+}
+
+void FileHashCache::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_entries.clear();
+}
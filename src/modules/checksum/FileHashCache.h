@@ -0,0 +1,83 @@
+/**
+ * @file FileHashCache.h
+ * @brief Checksums remembered per file identity.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * A result is reused only while the file still has the same size,
+ * modification time (nanoseconds where the OS provides them) and
+ * device/inode (volume serial/file index on Windows). Replacing, touching or
+ * rewriting the file changes one of these and the old results are dropped.
+ * Entries are evicted least-recently-used beyond MAX_FILES. All methods are
+ * thread-safe.
+ */
+
+#ifndef FILEHASHCACHE_H
+#define FILEHASHCACHE_H
+
+#include <QCache>
+#include <QMutex>
+#include <QString>
+
+#include <array>
+
+#include "FileHasher.h"
+
+class FileHashCache
+{
+public:
+    static const int MAX_FILES = 100000;
+
+    struct Identity
+    {
+        qint64 size = -1;
+        qint64 mtimeNs = 0;
+        quint64 device = 0;
+        quint64 inode = 0;
+
+        bool operator==(const Identity &other) const
+        {
+            return size == other.size && mtimeNs == other.mtimeNs
+                   && device == other.device && inode == other.inode;
+        }
+        bool operator!=(const Identity &other) const { return !(*this == other); }
+    };
+
+    /**
+     * @brief Reads the identity of a file from the file system.
+     * @return False if the file cannot be examined
+     */
+    static bool identify(const QString &path, Identity *identity);
+
+    FileHashCache();
+
+    /**
+     * @brief Looks up a result for a file that still has the given identity.
+     */
+    bool lookup(const QString &path, const Identity &identity,
+                FileHasher::Algorithm algorithm, QString *result);
+
+    /**
+     * @brief Stores a result; a different identity replaces the file's entry.
+     */
+    void insert(const QString &path, const Identity &identity,
+                FileHasher::Algorithm algorithm, const QString &result);
+
+    void clear();
+
+private:
+    struct Entry
+    {
+        Identity identity;
+        std::array<QString, FileHasher::ALGORITHM_COUNT> results;
+    };
+
+    QMutex m_mutex;
+    QCache<QString, Entry> m_entries;
+};
+
+#endif // FILEHASHCACHE_H
@@ -0,0 +1,221 @@
+/**
+ * @file FileHasher.cpp
+ * @brief Implementation of the incremental file hasher.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "FileHasher.h"
+#include "Blake3.h"
+#include "CrcModel.h"
+#include "XxHash3.h"
+
+#include <QFile>
+#include <QSemaphore>
+
+#include <vector>
+
+#ifdef Q_OS_UNIX
+#include <fcntl.h>
+#endif
+
+namespace {
+
+QCryptographicHash::Algorithm cryptographicAlgorithm(FileHasher::Algorithm algorithm)
+{
+    switch (algorithm) {
+    case FileHasher::MD5: return QCryptographicHash::Md5;
+    case FileHasher::SHA1: return QCryptographicHash::Sha1;
+    case FileHasher::SHA256: return QCryptographicHash::Sha256;
+    case FileHasher::SHA384: return QCryptographicHash::Sha384;
+    case FileHasher::SHA512: return QCryptographicHash::Sha512;
+    case FileHasher::SHA3_256: return QCryptographicHash::Sha3_256;
+    default: return QCryptographicHash::Sha3_512;
+    }
+}
+
+/// The CRC algorithms are catalogue models run by the shared engine
+const Crc::Engine *crcEngine(FileHasher::Algorithm algorithm)
+{
+    static const Crc::Engine crc8(*Crc::findModel("CRC-8/SMBUS"));
+    static const Crc::Engine crc16(*Crc::findModel("CRC-16/UMTS"));
+    static const Crc::Engine crc32(*Crc::findModel("CRC-32/ISO-HDLC"));
+    static const Crc::Engine crc32c(*Crc::findModel("CRC-32/ISCSI"));
+    static const Crc::Engine crc64(*Crc::findModel("CRC-64/XZ"));
+
+    switch (algorithm) {
+    case FileHasher::CRC8: return &crc8;
+    case FileHasher::CRC16: return &crc16;
+    case FileHasher::CRC32: return &crc32;
+    case FileHasher::CRC32C: return &crc32c;
+    case FileHasher::CRC64: return &crc64;
+    default: return nullptr;
+    }
+}
+
+QString hex(quint64 value, int digits)
+{
+    return QString("%1").arg(value, digits, 16, QChar('0')).toUpper();
+}
+
+} // namespace
+
+FileHasher::FileHasher(Algorithm algorithm) :
+    m_algorithm(algorithm),
+    m_crcEngine(crcEngine(algorithm))
+{
+    if (m_algorithm >= MD5 && m_algorithm <= SHA3_512)
+        m_hash.reset(new QCryptographicHash(cryptographicAlgorithm(m_algorithm)));
+    else if (m_algorithm == XXH3_64 || m_algorithm == XXH3_128)
+        m_xxh3.reset(new XxHash3::State);
+    else if (m_algorithm == BLAKE3)
+        m_blake3.reset(new Blake3::Hasher);
+    reset();
+}
+
+FileHasher::~FileHasher() = default;
+
+void FileHasher::reset()
+{
+    m_crc = m_crcEngine ? m_crcEngine->begin() : 0;
+    m_adlerA = 1;
+    m_adlerB = 0;
+    if (m_hash)
+        m_hash->reset();
+    if (m_xxh3)
+        m_xxh3->reset();
+    if (m_blake3)
+        m_blake3->reset();
+}
+
+void FileHasher::addData(const char *data, qsizetype len)
+{
+    if (m_crcEngine) {
+        m_crc = m_crcEngine->update(m_crc, data, len);
+        return;
+    }
+
+    switch (m_algorithm) {
+    case ADLER32: {
+        // 5552 is the most bytes that can be summed before b may overflow
+        const uchar *p = reinterpret_cast<const uchar *>(data);
+        while (len > 0) {
+            qsizetype n = qMin<qsizetype>(len, 5552);
+            len -= n;
+            while (n--) {
+                m_adlerA += *p++;
+                m_adlerB += m_adlerA;
+            }
+            m_adlerA %= 65521;
+            m_adlerB %= 65521;
+        }
+        break;
+    }
+    case XXH3_64:
+    case XXH3_128:
+        m_xxh3->update(data, len);
+        break;
+    case BLAKE3:
+        m_blake3->update(data, len);
+        break;
+    default:
+        m_hash->addData(QByteArrayView(data, len));
+        break;
+    }
+}
+
+QString FileHasher::result() const
+{
+    if (m_crcEngine)
+        return hex(m_crcEngine->end(m_crc), m_crcEngine->byteCount() * 2);
+
+    switch (m_algorithm) {
+    case ADLER32: return hex(quint64(m_adlerB) << 16 | m_adlerA, 8);
+    case XXH3_64: return hex(m_xxh3->digest64(), 16);
+    case XXH3_128: {
+        // Canonical form, as xxhsum prints it: high half first
+        const XxHash3::Hash128 h = m_xxh3->digest128();
+        return hex(h.high, 16) + hex(h.low, 16);
+    }
+    case BLAKE3: {
+        uchar digest[Blake3::OUT_LEN];
+        m_blake3->finalize(digest);
+        return QString::fromLatin1(QByteArray(reinterpret_cast<const char *>(digest), Blake3::OUT_LEN).toHex().toUpper());
+    }
+    default: return QString::fromLatin1(m_hash->result().toHex().toUpper());
+    }
+}
+
+QString FileHasher::hashFile(const QString &path, Algorithm algorithm,
+                             const ProgressFunction &progress, QString *errorMessage,
+                             QSemaphore *ioSlots)
+{
+    const QStringList results = hashFileAll(path, {algorithm}, progress, errorMessage, ioSlots);
+    return results.isEmpty() ? QString() : results.first();
+}
+
+QStringList FileHasher::hashFileAll(const QString &path, const QList<Algorithm> &algorithms,
+                                    const ProgressFunction &progress, QString *errorMessage,
+                                    QSemaphore *ioSlots)
+{
+    // One slot per open file, held until it is read to the end
+    if (ioSlots)
+        ioSlots->acquire();
+    const QSemaphoreReleaser slot(ioSlots);
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Unbuffered)) {
+        if (errorMessage)
+            *errorMessage = file.errorString();
+        return QStringList();
+    }
+
+#if defined(Q_OS_UNIX) && defined(POSIX_FADV_SEQUENTIAL)
+    // Let the kernel read ahead aggressively; every byte is read exactly once
+    posix_fadvise(file.handle(), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    std::vector<std::unique_ptr<FileHasher>> hashers;
+    for (Algorithm algorithm : algorithms)
+        hashers.emplace_back(new FileHasher(algorithm));
+
+    const qint64 total = file.size();
+    QByteArray buffer(CHUNK_SIZE, Qt::Uninitialized);
+    qint64 done = 0;
+
+    // Cancelled while waiting for the slot: hand it on without reading
+    if (progress && !progress(done, total)) {
+        if (errorMessage)
+            *errorMessage = "Cancelled";
+        return QStringList();
+    }
+
+    for (;;) {
+        const qint64 n = file.read(buffer.data(), CHUNK_SIZE);
+        if (n < 0) {
+            if (errorMessage)
+                *errorMessage = file.errorString();
+            return QStringList();
+        }
+        if (n == 0)
+            break;
+
+        // The chunk is still in cache while each hasher walks it
+        for (const auto &hasher : hashers)
+            hasher->addData(buffer.constData(), n);
+        done += n;
+        if (progress && !progress(done, total)) {
+            if (errorMessage)
+                *errorMessage = "Cancelled";
+            return QStringList();
+        }
+    }
+
+    QStringList results;
+    for (const auto &hasher : hashers)
+        results << hasher->result();
+    return results;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file FileHasher.h
+ * @brief Incremental checksums and constant-memory file hashing.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * A FileHasher is fed consecutive pieces of data with addData() and keeps
+ * only the running state of its algorithm. hashFile() streams a file
+ * through one in fixed CHUNK_SIZE reads, so memory use does not depend on
+ * the file size. hashFileAll() feeds every chunk to several hashers, so
+ * any number of checksums cost a single read of the file.
+ *
+ * XXH3 and BLAKE3 are much faster than the cryptographic digests on large
+ * files: both use the SIMD kernels in XxHash3.h and Blake3.h, and BLAKE3
+ * also spreads every chunk across the global thread pool.
+ */
+
+#ifndef FILEHASHER_H
+#define FILEHASHER_H
+
+#include <QCryptographicHash>
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+#include <functional>
+#include <memory>
+
+class QSemaphore;
+
+namespace Crc { class Engine; }
+namespace Blake3 { class Hasher; }
+namespace XxHash3 { class State; }
+
+class FileHasher
+{
+public:
+    /// Order matches the algorithm combo box of the Checksum Calculator.
+    /// The CRCs are CRC-8/SMBUS, CRC-16/UMTS, CRC-32/ISO-HDLC, CRC-32/ISCSI
+    /// and CRC-64/XZ of the Crc::Model catalogue.
+    enum Algorithm {
+        CRC8,
+        CRC16,
+        CRC32,
+        CRC32C,
+        CRC64,
+        ADLER32,
+        MD5,
+        SHA1,
+        SHA256,
+        SHA384,
+        SHA512,
+        SHA3_256,
+        SHA3_512,
+        XXH3_64,
+        XXH3_128,
+        BLAKE3,
+        ALGORITHM_COUNT
+    };
+
+    static const qint64 CHUNK_SIZE = 4 * 1024 * 1024;
+
+    /// Called after every chunk; return false to cancel
+    using ProgressFunction = std::function<bool(qint64 bytesDone, qint64 bytesTotal)>;
+
+    explicit FileHasher(Algorithm algorithm);
+    ~FileHasher();
+
+    Algorithm algorithm() const { return m_algorithm; }
+
+    /**
+     * @brief Starts a new checksum.
+     */
+    void reset();
+
+    /**
+     * @brief Adds the next piece of data.
+     */
+    void addData(const char *data, qsizetype len);
+
+    /**
+     * @brief Checksum of everything added since reset(), upper-case hex.
+     */
+    QString result() const;
+
+    /**
+     * @brief Hashes a file in CHUNK_SIZE sequential reads.
+     * @param progress Optional; reports bytes hashed and can cancel
+     * @param errorMessage Receives the reason on failure or "Cancelled"
+     * @param ioSlots Optional; one slot is held from opening the file until it is closed
+     * @return The checksum as result() formats it, or an empty string on failure.
+     */
+    static QString hashFile(const QString &path, Algorithm algorithm,
+                            const ProgressFunction &progress = ProgressFunction(),
+                            QString *errorMessage = nullptr,
+                            QSemaphore *ioSlots = nullptr);
+
+    /**
+     * @brief Computes several checksums in one pass over the file.
+     * @return One result per algorithm in the same order, or an empty list
+     *         on failure (see hashFile()).
+     */
+    static QStringList hashFileAll(const QString &path, const QList<Algorithm> &algorithms,
+                                   const ProgressFunction &progress = ProgressFunction(),
+                                   QString *errorMessage = nullptr,
+                                   QSemaphore *ioSlots = nullptr);
+
+private:
+    Algorithm m_algorithm;
+    const Crc::Engine *m_crcEngine;     ///< Set for the CRC algorithms
+    quint64 m_crc = 0;
+    quint32 m_adlerA = 1;
+    quint32 m_adlerB = 0;
+    std::unique_ptr<QCryptographicHash> m_hash;
+    std::unique_ptr<XxHash3::State> m_xxh3;
+    std::unique_ptr<Blake3::Hasher> m_blake3;
+};
+
+#endif // FILEHASHER_H
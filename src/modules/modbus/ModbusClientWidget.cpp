@@ -10,6 +10,7 @@
 
 #include "ModbusClientWidget.h"
 #include "ui_ModbusClientWidget.h"
+#include "SerialPortRegistry.h"
 #include <QSerialPortInfo>
 #include <QSerialPort>
 #include <QMessageBox>
@@ -39,6 +40,8 @@ ModbusClientWidget::ModbusClientWidget(QWidget *parent) :
     connect(ui->chkAutoRead, &QCheckBox::toggled, this, &ModbusClientWidget::on_chkAutoRead_toggled);
     connect(ui->comboMode, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &ModbusClientWidget::on_comboMode_currentIndexChanged);
     connect(m_scanTimer, &QTimer::timeout, this, &ModbusClientWidget::on_btnRead_clicked);
+    connect(SerialPortRegistry::instance(), &SerialPortRegistry::portsChanged,
+            this, &ModbusClientWidget::refreshSerialPorts);
     
     // Initial State
     on_comboMode_currentIndexChanged(0);
@@ -54,13 +57,13 @@ ModbusClientWidget::~ModbusClientWidget()
 }
 
 /**
- * @brief Updates the serial port list.
+ * @brief Updates the serial port list from the shared port registry.
  */
 void ModbusClientWidget::refreshSerialPorts()
 {
     QString current = ui->comboPort->currentText();
     ui->comboPort->clear();
-    for (const QSerialPortInfo &info : QSerialPortInfo::availablePorts()) {
+    for (const QSerialPortInfo &info : SerialPortRegistry::instance()->ports()) {
         ui->comboPort->addItem(info.portName());
     }
     ui->comboPort->setCurrentText(current);
@@ -68,6 +71,9 @@ void ModbusClientWidget::refreshSerialPorts()
 
 void ModbusClientWidget::on_btnRefreshPorts_clicked()
 {
+    // Explicit user request: force an enumeration in case an event was missed.
+    // rescan() only notifies subscribers when the list actually changed.
+    SerialPortRegistry::instance()->rescan();
     refreshSerialPorts();
 }
 
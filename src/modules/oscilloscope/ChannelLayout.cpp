@@ -0,0 +1,200 @@
+/**
+ * @file ChannelLayout.cpp
+ * @brief Implementation of the oscilloscope channel layout loader.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "ChannelLayout.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonParseError>
+#include <QRegularExpression>
+
+#include <iterator>
+
+namespace {
+
+bool fail(QString *errorMessage, const QString &message)
+{
+    if (errorMessage)
+        *errorMessage = message;
+    return false;
+}
+
+/// Colours for channels that do not name one; the first two match raw RX/TX
+const QColor PALETTE[] = {
+    QColor(0, 255, 0), QColor(80, 180, 255), QColor(255, 82, 82), QColor(255, 213, 79),
+    QColor(206, 147, 216), QColor(77, 208, 225), QColor(255, 167, 38), QColor(240, 240, 240),
+};
+
+struct TypeName
+{
+    const char *name;
+    ChannelLayout::Type type;
+};
+
+const TypeName TYPES[] = {
+    {"int8", ChannelLayout::Int8},       {"uint8", ChannelLayout::UInt8},
+    {"int16", ChannelLayout::Int16},     {"uint16", ChannelLayout::UInt16},
+    {"int32", ChannelLayout::Int32},     {"uint32", ChannelLayout::UInt32},
+    {"float32", ChannelLayout::Float32}, {"float64", ChannelLayout::Float64},
+};
+
+bool parseEndian(const QJsonValue &value, bool fallback, bool *bigEndian)
+{
+    if (value.isUndefined()) {
+        *bigEndian = fallback;
+        return true;
+    }
+    const QString text = value.toString();
+    *bigEndian = text == QLatin1String("big");
+    return *bigEndian || text == QLatin1String("little");
+}
+
+} // namespace
+
+ChannelLayout ChannelLayout::rawBytes()
+{
+    ChannelLayout layout;
+    for (const char *name : {"RX", "TX"}) {
+        Channel channel;
+        channel.name = QLatin1String(name);
+        channel.max = 255.0;
+        channel.fixedRange = true;
+        channel.color = PALETTE[layout.channels.size()];
+        layout.channels.append(channel);
+    }
+    return layout;
+}
+
+int ChannelLayout::typeSize(Type type)
+{
+    switch (type) {
+    case Int8: case UInt8: return 1;
+    case Int16: case UInt16: return 2;
+    case Int32: case UInt32: case Float32: return 4;
+    case Float64: return 8;
+    }
+    return 1;
+}
+
+bool ChannelLayout::load(const QString &path, ChannelLayout *layout, QString *errorMessage)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return fail(errorMessage, QString("Cannot open %1: %2").arg(path, file.errorString()));
+
+    QJsonParseError parseError;
+    const QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+    if (doc.isNull())
+        return fail(errorMessage, QString("%1: %2 at offset %3")
+                                      .arg(QFileInfo(path).fileName(), parseError.errorString())
+                                      .arg(parseError.offset));
+    if (!doc.isObject())
+        return fail(errorMessage, QString("%1: expected a JSON object").arg(QFileInfo(path).fileName()));
+
+    QJsonObject json = doc.object();
+    if (!json.contains("name"))
+        json.insert("name", QFileInfo(path).completeBaseName());
+    return fromJson(json, layout, errorMessage);
+}
+
+bool ChannelLayout::fromJson(const QJsonObject &json, ChannelLayout *layout, QString *errorMessage)
+{
+    ChannelLayout def;
+    def.name = json.value("name").toString("Telemetry");
+
+    const QString format = json.value("format").toString("binary");
+    if (format == "binary")
+        def.format = Binary;
+    else if (format == "csv")
+        def.format = Csv;
+    else
+        return fail(errorMessage, QString("format: unknown format '%1' (binary or csv)").arg(format));
+
+    const QString source = json.value("source").toString("rx");
+    if (source != "rx" && source != "tx")
+        return fail(errorMessage, "source: must be rx or tx");
+    def.fromTx = source == "tx";
+
+    bool bigEndian = false;
+    if (!parseEndian(json.value("endian"), false, &bigEndian))
+        return fail(errorMessage, "endian: must be little or big");
+
+    if (def.format == Binary) {
+        QString sync = json.value("sync").toString();
+        sync.remove(QRegularExpression("\\s"));
+        static const QRegularExpression hex("^([0-9A-Fa-f]{2})*$");
+        if (!hex.match(sync).hasMatch())
+            return fail(errorMessage, "sync: expected hex bytes, e.g. \"AA 55\"");
+        def.sync = QByteArray::fromHex(sync.toLatin1());
+        def.frameLength = json.value("length").toInt();
+        if (def.frameLength <= def.sync.size() || def.frameLength > MAX_FRAME)
+            return fail(errorMessage, QString("length: must be longer than sync and at most %1").arg(MAX_FRAME));
+    } else {
+        const QString separator = json.value("separator").toString(",");
+        if (separator.size() != 1 || separator.at(0).unicode() > 0x7F)
+            return fail(errorMessage, "separator: must be a single ASCII character");
+        def.separator = char(separator.at(0).unicode());
+    }
+
+    const QJsonArray channels = json.value("channels").toArray();
+    if (channels.isEmpty() || channels.size() > MAX_CHANNELS)
+        return fail(errorMessage, QString("channels: between 1 and %1 required").arg(MAX_CHANNELS));
+
+    for (const QJsonValue &value : channels) {
+        const QJsonObject object = value.toObject();
+        Channel channel;
+        const int index = def.channels.size();
+        channel.name = object.value("name").toString(QString("ch%1").arg(index + 1));
+        channel.unit = object.value("unit").toString();
+        channel.offset = object.value("offset").toInt(-1);
+        channel.scale = object.value("scale").toDouble(1.0);
+        channel.bias = object.value("bias").toDouble(0.0);
+        const QString where = QString("channels[%1] (%2): ").arg(index).arg(channel.name);
+
+        if (def.format == Binary) {
+            const QString type = object.value("type").toString("uint8");
+            bool known = false;
+            for (const TypeName &t : TYPES) {
+                if (type == QLatin1String(t.name)) {
+                    channel.type = t.type;
+                    known = true;
+                }
+            }
+            if (!known)
+                return fail(errorMessage, where + QString("unknown type '%1'").arg(type));
+            if (!parseEndian(object.value("endian"), bigEndian, &channel.bigEndian))
+                return fail(errorMessage, where + "endian must be little or big");
+            if (channel.offset < 0 || channel.offset + typeSize(channel.type) > def.frameLength)
+                return fail(errorMessage, where + "offset must place the field inside the frame");
+        } else {
+            channel.type = Float64;
+            if (channel.offset < 0)
+                return fail(errorMessage, where + "offset (column) must be 0 or more");
+        }
+
+        if (object.contains("min") && object.contains("max")) {
+            channel.min = object.value("min").toDouble();
+            channel.max = object.value("max").toDouble();
+            channel.fixedRange = true;
+            if (!(channel.max > channel.min))
+                return fail(errorMessage, where + "max must be greater than min");
+        }
+
+        channel.color = QColor(object.value("color").toString());
+        if (!channel.color.isValid())
+            channel.color = PALETTE[index % int(std::size(PALETTE))];
+        def.channels.append(channel);
+    }
+
+    *layout = def;
+    return true;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file ChannelLayout.h
+ * @brief How the oscilloscope turns a byte stream into numeric channels.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * A layout is loaded from a JSON file (see `Files/Telemetry/`):
+ *
+ * @code
+ * {
+ *   "name": "IMU",
+ *   "format": "binary",
+ *   "source": "rx",
+ *   "sync": "AA 55",
+ *   "length": 16,
+ *   "endian": "little",
+ *   "channels": [
+ *     { "name": "ax", "offset": 2, "type": "int16", "scale": 0.000598, "unit": "m/s²",
+ *       "min": -20, "max": 20, "color": "#ff5252" },
+ *     { "name": "temp", "offset": 14, "type": "uint16", "endian": "big",
+ *       "scale": 0.01, "bias": -40 }
+ *   ]
+ * }
+ * @endcode
+ *
+ * "format": "binary" frames start with the "sync" bytes (none = frames
+ * follow each other back to back) and are "length" bytes long including
+ * them; channel "offset"s count from the first sync byte. "type" is one of
+ * int8, uint8, int16, uint16, int32, uint32, float32 and float64, "endian"
+ * little (default) or big, per layout or per channel.
+ *
+ * "format": "csv" reads one frame per text line; "offset" is then the
+ * zero-based column and "separator" (default ",") splits columns.
+ *
+ * Every channel plots raw * "scale" + "bias" (defaults 1 and 0) on its own
+ * axis from "min" to "max"; without both the axis follows the visible data.
+ * "source" picks the direction that carries the telemetry, rx (default) or tx.
+ */
+
+#ifndef CHANNELLAYOUT_H
+#define CHANNELLAYOUT_H
+
+#include <QByteArray>
+#include <QColor>
+#include <QJsonObject>
+#include <QList>
+#include <QString>
+
+struct ChannelLayout
+{
+    enum Format {
+        RawBytes,   ///< Every RX and TX byte is a sample (channels "RX" and "TX")
+        Binary,
+        Csv
+    };
+
+    enum Type { Int8, UInt8, Int16, UInt16, Int32, UInt32, Float32, Float64 };
+
+    struct Channel {
+        QString name;
+        QString unit;
+        int offset = 0;         ///< Byte offset in the frame, or CSV column
+        Type type = UInt8;
+        bool bigEndian = false;
+        double scale = 1.0;
+        double bias = 0.0;
+        double min = 0.0;       ///< Axis range when fixedRange
+        double max = 0.0;
+        bool fixedRange = false;
+        QColor color;
+    };
+
+    static const int MAX_CHANNELS = 16;
+    static const int MAX_FRAME = 4096;
+
+    QString name = QStringLiteral("Raw Bytes");
+    Format format = RawBytes;
+    bool fromTx = false;        ///< Telemetry direction for Binary and Csv
+    QByteArray sync;
+    int frameLength = 0;
+    char separator = ',';
+    QList<Channel> channels;
+
+    /**
+     * @brief The default layout: RX and TX bytes as two 0-255 channels.
+     */
+    static ChannelLayout rawBytes();
+
+    /**
+     * @brief Loads a layout from a JSON file.
+     * @return false on a read or definition error
+     */
+    static bool load(const QString &path, ChannelLayout *layout, QString *errorMessage = nullptr);
+
+    /**
+     * @brief Builds a layout from parsed JSON, checking that every field fits the frame.
+     */
+    static bool fromJson(const QJsonObject &json, ChannelLayout *layout, QString *errorMessage = nullptr);
+
+    /// Size in bytes of a binary field type
+    static int typeSize(Type type);
+};
+
+#endif // CHANNELLAYOUT_H
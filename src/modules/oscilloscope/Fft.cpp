@@ -0,0 +1,115 @@
+/**
+ * @file Fft.cpp
+ * @brief Implementation of the real-input FFT.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "Fft.h"
+
+#include <cmath>
+#include <utility>
+
+Fft::Fft(int size) : m_size(isValidSize(size) ? size : 1024), m_half(m_size / 2)
+{
+    const double pi = 3.14159265358979323846;
+
+    m_twRe.resize(qMax(1, m_half / 2));
+    m_twIm.resize(qMax(1, m_half / 2));
+    for (int k = 0; k < m_half / 2; ++k) {
+        const double a = -2.0 * pi * k / m_half;
+        m_twRe[k] = float(std::cos(a));
+        m_twIm[k] = float(std::sin(a));
+    }
+
+    m_upRe.resize(m_half);
+    m_upIm.resize(m_half);
+    for (int k = 0; k < m_half; ++k) {
+        const double a = -2.0 * pi * k / m_size;
+        m_upRe[k] = float(std::cos(a));
+        m_upIm[k] = float(std::sin(a));
+    }
+
+    m_re.resize(m_half);
+    m_im.resize(m_half);
+    m_workRe.resize(m_half);
+    m_workIm.resize(m_half);
+}
+
+/**
+ * @brief Stockham radix-2: stage by stage, n halves and the stride s doubles.
+ *
+ * Within a stage all s butterflies of a twiddle read and write contiguous
+ * runs, so the inner loop vectorises; the output order comes out natural.
+ */
+void Fft::transform(const float **re, const float **im)
+{
+    const float *xr = m_re.constData();
+    const float *xi = m_im.constData();
+    float *yr = m_workRe.data();
+    float *yi = m_workIm.data();
+    float *otherRe = m_re.data();
+    float *otherIm = m_im.data();
+
+    for (int n = m_half, s = 1; n > 1; n /= 2, s *= 2) {
+        const int m = n / 2;
+        for (int p = 0; p < m; ++p) {
+            const float wr = m_twRe[p * s];
+            const float wi = m_twIm[p * s];
+            const float *ar = xr + s * p;
+            const float *ai = xi + s * p;
+            const float *br = xr + s * (p + m);
+            const float *bi = xi + s * (p + m);
+            float *sumRe = yr + s * 2 * p;
+            float *sumIm = yi + s * 2 * p;
+            float *diffRe = sumRe + s;
+            float *diffIm = sumIm + s;
+            for (int q = 0; q < s; ++q) {
+                const float dr = ar[q] - br[q];
+                const float di = ai[q] - bi[q];
+                sumRe[q] = ar[q] + br[q];
+                sumIm[q] = ai[q] + bi[q];
+                diffRe[q] = dr * wr - di * wi;
+                diffIm[q] = dr * wi + di * wr;
+            }
+        }
+        // The output of this stage is the input of the next
+        std::swap(otherRe, yr);
+        std::swap(otherIm, yi);
+        xr = otherRe;
+        xi = otherIm;
+    }
+    *re = xr;
+    *im = xi;
+}
+
+void Fft::powerSpectrum(const float *in, float *out)
+{
+    float *re = m_re.data();
+    float *im = m_im.data();
+    for (int k = 0; k < m_half; ++k) {
+        re[k] = in[2 * k];
+        im[k] = in[2 * k + 1];
+    }
+
+    const float *zr, *zi;
+    transform(&zr, &zi);
+
+    // Z = E + iO, where E and O are the spectra of the even and odd samples:
+    // X[k] = E[k] + W^k O[k], E[k] = (Z[k] + Z*[h-k]) / 2, O[k] = (Z[k] - Z*[h-k]) / 2i
+    out[0] = (zr[0] + zi[0]) * (zr[0] + zi[0]);
+    out[m_half] = (zr[0] - zi[0]) * (zr[0] - zi[0]);
+    for (int k = 1; k < m_half; ++k) {
+        const float ar = zr[k], ai = zi[k];
+        const float br = zr[m_half - k], bi = -zi[m_half - k];
+        const float er = 0.5f * (ar + br), ei = 0.5f * (ai + bi);
+        const float dr = 0.5f * (ar - br), di = 0.5f * (ai - bi);
+        const float c = m_upRe[k], s = m_upIm[k];
+        const float xr = er + (c * di + s * dr);
+        const float xi = ei - (c * dr - s * di);
+        out[k] = xr * xr + xi * xi;
+    }
+}
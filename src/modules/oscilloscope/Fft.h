@@ -0,0 +1,56 @@
+/**
+ * @file Fft.h
+ * @brief Power spectrum of real samples for the oscilloscope's spectrum view.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * N real samples are packed into N/2 complex ones (even samples real, odd
+ * imaginary), transformed with a radix-2 Stockham FFT and split back into
+ * the N/2 + 1 bins of the real spectrum. Real and imaginary parts live in
+ * separate arrays and the Stockham ordering needs no bit-reversal pass, so
+ * every butterfly loop is a plain unit-stride loop over float arrays that
+ * the compiler vectorises. Twiddles are computed once per size in double.
+ */
+
+#ifndef FFT_H
+#define FFT_H
+
+#include <QVector>
+
+class Fft
+{
+public:
+    /**
+     * @brief Prepares tables for transforms of @p size real samples.
+     * @param size Power of two, at least 4
+     */
+    explicit Fft(int size = 1024);
+
+    int size() const { return m_size; }
+
+    /**
+     * @brief Squared magnitudes of the spectrum of @p in.
+     * @param in size() real samples
+     * @param out Receives size() / 2 + 1 values |X[k]|², DC first
+     */
+    void powerSpectrum(const float *in, float *out);
+
+    static bool isValidSize(int size) { return size >= 4 && (size & (size - 1)) == 0; }
+
+private:
+    int m_size;
+    int m_half;                     ///< Length of the complex transform
+    QVector<float> m_twRe, m_twIm;  ///< exp(-2πik / half), k < half / 2
+    QVector<float> m_upRe, m_upIm;  ///< exp(-2πik / size), k < half; splits the packed result
+    QVector<float> m_re, m_im;      ///< Packed input, then ping-pong buffers
+    QVector<float> m_workRe, m_workIm;
+
+    /// Transforms m_re / m_im; *re / *im point to the result (either buffer pair)
+    void transform(const float **re, const float **im);
+};
+
+#endif // FFT_H
@@ -10,6 +10,11 @@
 
 #include "OscilloscopeWidget.h"
 #include "ui_OscilloscopeWidget.h"
+#include "Paths.h"
+#include "TriggerMatcher.h"
+
+#include <QFileDialog>
+#include <QMessageBox>
 
 OscilloscopeWidget::OscilloscopeWidget(QWidget *parent) :
     QWidget(parent),
@@ -21,19 +26,65 @@ OscilloscopeWidget::OscilloscopeWidget(QWidget *parent) :
     ui->verticalLayout->replaceWidget(ui->plotArea, m_plot);
     delete ui->plotArea;
     
+    m_spectrum = new SpectrumView(this);
+    ui->verticalLayout->replaceWidget(ui->spectrumArea, m_spectrum);
+    delete ui->spectrumArea;
+    m_spectrum->hide();
+    
+    m_analyzer = new SpectrumAnalyzer(this);
+    connect(m_analyzer, &SpectrumAnalyzer::spectrumReady, this, &OscilloscopeWidget::onSpectrumReady);
+    
+    m_decoder = new TelemetryDecoder(this);
+    connect(m_decoder, &TelemetryDecoder::samplesReady, this, &OscilloscopeWidget::onSamplesReady);
+    
+    m_layoutMenu = new QMenu(this);
+    m_layoutMenu->addAction("Raw Bytes", this, [this]() { applyLayout(ChannelLayout::rawBytes()); });
+    m_layoutMenu->addAction("Load Layout...", this, &OscilloscopeWidget::loadLayout);
+    ui->btnLayout->setMenu(m_layoutMenu);
+    
     connect(ui->sliderTimebase, &QSlider::valueChanged, this, &OscilloscopeWidget::on_sliderTimebase_valueChanged);
     connect(ui->chkRun, &QCheckBox::toggled, this, &OscilloscopeWidget::on_chkRun_toggled);
     connect(ui->btnClear, &QPushButton::clicked, this, &OscilloscopeWidget::on_btnClear_clicked);
     connect(ui->cmbChannel, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &OscilloscopeWidget::on_cmbChannel_currentIndexChanged);
+    connect(ui->spinFps, QOverload<int>::of(&QSpinBox::valueChanged), this, &OscilloscopeWidget::onRefreshRateChanged);
+    connect(m_plot, &PlotArea::framePainted, this, &OscilloscopeWidget::updateSampleCount);
+    connect(m_plot, &PlotArea::zoomChanged, this, &OscilloscopeWidget::onZoomChanged);
+    connect(ui->btnFit, &QPushButton::clicked, m_plot, &PlotArea::zoomToFit);
+    connect(ui->cmbMemory, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &OscilloscopeWidget::onMemoryChanged);
     
-    m_plot->setTimebase(ui->sliderTimebase->value());
-    ui->lblTimebaseValue->setText(QString::number(ui->sliderTimebase->value()));
+    connect(ui->cmbTriggerMode, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &OscilloscopeWidget::onTriggerChanged);
+    connect(ui->cmbTriggerType, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &OscilloscopeWidget::onTriggerChanged);
+    connect(ui->cmbTriggerChannel, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &OscilloscopeWidget::onTriggerChanged);
+    connect(ui->spinLevel, QOverload<double>::of(&QDoubleSpinBox::valueChanged), this, &OscilloscopeWidget::onTriggerChanged);
+    connect(ui->spinHysteresis, QOverload<double>::of(&QDoubleSpinBox::valueChanged), this, &OscilloscopeWidget::onTriggerChanged);
+    connect(ui->spinMinWidth, QOverload<int>::of(&QSpinBox::valueChanged), this, &OscilloscopeWidget::onTriggerChanged);
+    connect(ui->spinMaxWidth, QOverload<int>::of(&QSpinBox::valueChanged), this, &OscilloscopeWidget::onTriggerChanged);
+    connect(ui->spinPreTrigger, QOverload<int>::of(&QSpinBox::valueChanged), this, &OscilloscopeWidget::onTriggerChanged);
+    connect(ui->spinPostTrigger, QOverload<int>::of(&QSpinBox::valueChanged), this, &OscilloscopeWidget::onTriggerChanged);
+    connect(ui->txtPattern, &QLineEdit::editingFinished, this, &OscilloscopeWidget::onTriggerChanged);
+    connect(ui->btnRearm, &QPushButton::clicked, this, &OscilloscopeWidget::onRearmClicked);
     
-    on_cmbChannel_currentIndexChanged(0);
+    connect(ui->chkSpectrum, &QCheckBox::toggled, this, &OscilloscopeWidget::onSpectrumToggled);
+    connect(ui->cmbSpectrumChannel, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &OscilloscopeWidget::onSpectrumChannelChanged);
+    connect(ui->cmbFftSize, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &OscilloscopeWidget::onSpectrumSettingsChanged);
+    connect(ui->cmbWindow, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &OscilloscopeWidget::onSpectrumSettingsChanged);
+    connect(ui->cmbOverlap, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &OscilloscopeWidget::onSpectrumSettingsChanged);
+    connect(ui->spinAverages, QOverload<int>::of(&QSpinBox::valueChanged), this, &OscilloscopeWidget::onSpectrumSettingsChanged);
+    connect(ui->spinSampleRate, QOverload<double>::of(&QDoubleSpinBox::valueChanged), m_spectrum, &SpectrumView::setSampleRate);
+    
+    on_sliderTimebase_valueChanged(ui->sliderTimebase->value());
+    onRefreshRateChanged(ui->spinFps->value());
+    onMemoryChanged(ui->cmbMemory->currentIndex());
+    onSpectrumSettingsChanged();
+    onSpectrumToggled(false);
+    
+    applyLayout(ChannelLayout::rawBytes());
 }
 
 OscilloscopeWidget::~OscilloscopeWidget()
 {
+    delete m_decoder;
+    delete m_analyzer;
     delete ui;
 }
 
@@ -52,25 +103,261 @@ void OscilloscopeWidget::addData(bool isTx, const QByteArray &data)
         ui->lblStatus->setStyleSheet("color: #4CAF50; padding: 5px;");
     }
     
-    for (char c : data) {
-        if (isTx) {
-            m_plot->addSampleTx((quint8)c);
-        } else {
-            m_plot->addSampleRx((quint8)c);
+    m_decoder->push(isTx, data);
+}
+
+/**
+ * @brief Plots the blocks the decoder has finished.
+ */
+void OscilloscopeWidget::onSamplesReady()
+{
+    TelemetryDecoder::Block block;
+    while (m_decoder->takeBlock(block)) {
+        // Blocks of a previous layout or from before Clear
+        if (block.generation != m_generation)
+            continue;
+        for (int c = 0; c < block.channels.size(); ++c)
+            m_plot->appendSamples(c, block.channels.at(c).constData(), block.channels.at(c).size());
+        // Several captures per block only happen with short captures; show the newest
+        if (!block.captures.isEmpty())
+            m_plot->showCapture(block.captures.last());
+        
+        const int spectrumChannel = ui->cmbSpectrumChannel->currentIndex();
+        if (ui->chkSpectrum->isChecked() && spectrumChannel >= 0 && spectrumChannel < block.channels.size())
+            m_analyzer->push(block.channels.at(spectrumChannel));
+    }
+}
+
+/**
+ * @brief Shows the newest spectrum of the analyzer.
+ */
+void OscilloscopeWidget::onSpectrumReady()
+{
+    SpectrumAnalyzer::Spectrum spectrum;
+    if (m_analyzer->takeSpectrum(spectrum) && spectrum.generation == m_spectrumGeneration)
+        m_spectrum->setSpectrum(spectrum);
+}
+
+/**
+ * @brief Refreshes the sample counter; called once per painted frame.
+ */
+void OscilloscopeWidget::updateSampleCount()
+{
+    QString text = QString("Samples: %1").arg(m_plot->sampleCount());
+    if (m_layout.format != ChannelLayout::RawBytes) {
+        const TelemetryDecoder::Stats stats = m_decoder->stats();
+        text += QString(" | Frames: %1").arg(stats.frames);
+        if (stats.skippedBytes > 0)
+            text += QString(" | Resync: %1 bytes").arg(stats.skippedBytes);
+        if (stats.badLines > 0)
+            text += QString(" | Bad lines: %1").arg(stats.badLines);
+    }
+    ui->lblSampleCount->setText(text);
+
+    switch (m_decoder->triggerState()) {
+    case ScopeTrigger::Idle:
+        ui->lblTriggerState->setText(ui->cmbTriggerMode->currentIndex() == ScopeTrigger::Off ? "" : "Trigger idle");
+        break;
+    case ScopeTrigger::Armed:
+        ui->lblTriggerState->setText("Armed");
+        break;
+    case ScopeTrigger::Capturing:
+        ui->lblTriggerState->setText("Triggered");
+        break;
+    case ScopeTrigger::Stopped:
+        ui->lblTriggerState->setText("Stopped");
+        break;
+    }
+}
+
+/**
+ * @brief Asks for a channel layout file and switches to it.
+ */
+void OscilloscopeWidget::loadLayout()
+{
+    const QString fileName = QFileDialog::getOpenFileName(
+        this, "Load Channel Layout", FILES_FOLDER_PATH + "/Telemetry",
+        "Channel Layouts (*.json);;All Files (*)");
+    if (fileName.isEmpty())
+        return;
+
+    ChannelLayout layout;
+    QString error;
+    if (!ChannelLayout::load(fileName, &layout, &error)) {
+        QMessageBox::warning(this, "Channel Layout", error);
+        return;
+    }
+    applyLayout(layout);
+}
+
+/**
+ * @brief Switches decoder and plot to @p layout and lists its channels.
+ */
+void OscilloscopeWidget::applyLayout(const ChannelLayout &layout)
+{
+    m_layout = layout;
+    m_generation = m_decoder->setLayout(layout);
+    m_plot->setChannelLayout(layout);
+    ui->btnLayout->setText("Layout: " + layout.name);
+
+    const QSignalBlocker blocker(ui->cmbChannel);
+    ui->cmbChannel->clear();
+    if (layout.format == ChannelLayout::RawBytes) {
+        ui->cmbChannel->addItems({"RX Only", "TX Only", "Both"});
+    } else {
+        ui->cmbChannel->addItem("All Channels");
+        for (const ChannelLayout::Channel &channel : layout.channels)
+            ui->cmbChannel->addItem(channel.name);
+    }
+    ui->cmbChannel->setCurrentIndex(0);
+    on_cmbChannel_currentIndexChanged(0);
+
+    {
+        const QSignalBlocker triggerBlocker(ui->cmbTriggerChannel);
+        ui->cmbTriggerChannel->clear();
+        for (const ChannelLayout::Channel &channel : layout.channels)
+            ui->cmbTriggerChannel->addItem(channel.name);
+        ui->cmbTriggerChannel->setCurrentIndex(0);
+    }
+    onTriggerChanged();
+
+    {
+        const QSignalBlocker spectrumBlocker(ui->cmbSpectrumChannel);
+        ui->cmbSpectrumChannel->clear();
+        for (const ChannelLayout::Channel &channel : layout.channels)
+            ui->cmbSpectrumChannel->addItem(channel.name);
+        ui->cmbSpectrumChannel->setCurrentIndex(0);
+    }
+    onSpectrumChannelChanged(0);
+    updateSampleCount();
+}
+
+/**
+ * @brief Reads the trigger row.
+ */
+ScopeTrigger::Settings OscilloscopeWidget::triggerSettings() const
+{
+    ScopeTrigger::Settings settings;
+    settings.mode = ScopeTrigger::Mode(ui->cmbTriggerMode->currentIndex());
+    settings.type = ScopeTrigger::Type(ui->cmbTriggerType->currentIndex());
+    settings.channel = qMax(0, ui->cmbTriggerChannel->currentIndex());
+    settings.level = ui->spinLevel->value();
+    settings.hysteresis = ui->spinHysteresis->value();
+    settings.minWidth = ui->spinMinWidth->value();
+    settings.maxWidth = qMax(ui->spinMinWidth->value(), ui->spinMaxWidth->value());
+    settings.pattern = ui->txtPattern->text();
+    settings.preTrigger = ui->spinPreTrigger->value();
+    settings.postTrigger = ui->spinPostTrigger->value();
+    return settings;
+}
+
+/**
+ * @brief Shows the controls that apply to the selected mode and type.
+ */
+void OscilloscopeWidget::updateTriggerControls()
+{
+    const bool on = ui->cmbTriggerMode->currentIndex() != ScopeTrigger::Off;
+    const int type = ui->cmbTriggerType->currentIndex();
+    const bool pattern = type == ScopeTrigger::BytePattern;
+    const bool pulse = type == ScopeTrigger::PositivePulse || type == ScopeTrigger::NegativePulse;
+
+    const QList<QWidget *> controls = {ui->cmbTriggerType, ui->cmbTriggerChannel, ui->spinLevel,
+                                       ui->spinHysteresis, ui->spinMinWidth, ui->spinMaxWidth,
+                                       ui->txtPattern, ui->spinPreTrigger, ui->spinPostTrigger};
+    for (QWidget *w : controls)
+        w->setEnabled(on);
+
+    ui->lblLevel->setVisible(!pattern);
+    ui->spinLevel->setVisible(!pattern);
+    ui->spinHysteresis->setVisible(!pattern);
+    ui->lblWidth->setVisible(pulse);
+    ui->spinMinWidth->setVisible(pulse);
+    ui->spinMaxWidth->setVisible(pulse);
+    ui->txtPattern->setVisible(pattern);
+    ui->btnRearm->setEnabled(ui->cmbTriggerMode->currentIndex() == ScopeTrigger::Single);
+}
+
+/**
+ * @brief Sends the trigger row to the decoder and the plot; re-arms the trigger.
+ */
+void OscilloscopeWidget::onTriggerChanged()
+{
+    updateTriggerControls();
+
+    const ScopeTrigger::Settings settings = triggerSettings();
+    if (settings.mode != ScopeTrigger::Off && settings.type == ScopeTrigger::BytePattern) {
+        QString error;
+        if (settings.pattern.trimmed().isEmpty() || !TriggerMatcher::validatePattern(settings.pattern, &error)) {
+            ui->txtPattern->setStyleSheet("border: 1px solid #F44336;");
+            ui->txtPattern->setToolTip(error.isEmpty() ? "Enter a byte pattern" : error);
+            ui->lblTriggerState->setText("Invalid pattern");
+            return;
         }
     }
-    
-    ui->lblSampleCount->setText(QString("Samples: %1").arg(m_plot->sampleCount()));
+    ui->txtPattern->setStyleSheet("");
+    ui->txtPattern->setToolTip("Byte pattern in trigger syntax, e.g. AA 55 ?? 0D");
+
+    m_decoder->setTrigger(settings);
+    m_plot->setTrigger(settings);
+    updateSampleCount();
+}
+
+/**
+ * @brief Arms a Single trigger for the next capture.
+ */
+void OscilloscopeWidget::onRearmClicked()
+{
+    onTriggerChanged();
 }
 
 /**
  * @brief Handles timebase slider changes.
- * @param value New timebase value
+ * @param value Zoom in tenths of a power of two pixels per sample
  */
 void OscilloscopeWidget::on_sliderTimebase_valueChanged(int value)
 {
-    m_plot->setTimebase(value);
-    ui->lblTimebaseValue->setText(QString::number(value));
+    m_plot->setZoom(value);
+    updateTimebaseLabel();
+}
+
+/**
+ * @brief Follows zooming with the mouse wheel or "Fit" on the slider.
+ * @param zoom New zoom of the plot
+ */
+void OscilloscopeWidget::onZoomChanged(int zoom)
+{
+    const QSignalBlocker blocker(ui->sliderTimebase);
+    ui->sliderTimebase->setValue(zoom);
+    updateTimebaseLabel();
+}
+
+void OscilloscopeWidget::updateTimebaseLabel()
+{
+    const double pixelsPerSample = m_plot->pixelsPerSample();
+    if (pixelsPerSample >= 1.0)
+        ui->lblTimebaseValue->setText(QString("%1 px/S").arg(pixelsPerSample, 0, 'g', 3));
+    else
+        ui->lblTimebaseValue->setText(QString("%1 S/px").arg(qRound(1.0 / pixelsPerSample)));
+}
+
+/**
+ * @brief Handles sample memory changes.
+ * @param index 0=4M, 1=16M, 2=32M, 3=64M, 4=128M samples
+ */
+void OscilloscopeWidget::onMemoryChanged(int index)
+{
+    static const int megaSamples[] = {4, 16, 32, 64, 128};
+    m_plot->setMemoryDepth(quint64(megaSamples[qBound(0, index, 4)]) << 20);
+}
+
+/**
+ * @brief Handles refresh rate changes.
+ * @param fps Maximum plot repaints per second
+ */
+void OscilloscopeWidget::onRefreshRateChanged(int fps)
+{
+    m_plot->setMaxFps(fps);
+    m_spectrum->setMaxFps(fps);
 }
 
 /**
@@ -87,7 +374,10 @@ void OscilloscopeWidget::on_chkRun_toggled(bool checked)
  */
 void OscilloscopeWidget::on_btnClear_clicked()
 {
+    m_generation = m_decoder->reset();
     m_plot->clear();
+    m_spectrumGeneration = m_analyzer->reset();
+    m_spectrum->clear();
     ui->lblSampleCount->setText("Samples: 0");
     m_hasData = false;
     ui->lblStatus->setText("💡 Tip: Connect to a serial port or network socket in a Terminal tab, then data will appear here automatically.");
@@ -96,13 +386,60 @@ void OscilloscopeWidget::on_btnClear_clicked()
 
 /**
  * @brief Handles channel selection changes.
- * @param index 0=RX only, 1=TX only, 2=Both
+ * @param index Raw bytes: 0=RX only, 1=TX only, 2=Both.
+ *              Layouts: 0=all channels, else only channel index - 1.
  */
 void OscilloscopeWidget::on_cmbChannel_currentIndexChanged(int index)
 {
-    switch (index) {
-        case 0: m_plot->setChannels(true, false); break;
-        case 1: m_plot->setChannels(false, true); break;
-        case 2: m_plot->setChannels(true, true); break;
+    if (m_layout.format == ChannelLayout::RawBytes) {
+        m_plot->setChannelVisible(0, index != 1);
+        m_plot->setChannelVisible(1, index != 0);
+        return;
+    }
+    for (int c = 0; c < m_plot->channelCount(); ++c)
+        m_plot->setChannelVisible(c, index == 0 || index == c + 1);
+}
+
+/**
+ * @brief Shows or hides the spectrum panel; its controls follow.
+ * @param checked true to analyse the selected channel
+ */
+void OscilloscopeWidget::onSpectrumToggled(bool checked)
+{
+    const QList<QWidget *> controls = {ui->cmbSpectrumChannel, ui->cmbFftSize, ui->cmbWindow,
+                                       ui->cmbOverlap, ui->spinAverages, ui->spinSampleRate};
+    for (QWidget *w : controls)
+        w->setEnabled(checked);
+    m_spectrum->setVisible(checked);
+    if (!checked) {
+        m_spectrumGeneration = m_analyzer->reset();
+        m_spectrum->clear();
     }
 }
+
+/**
+ * @brief Restarts the spectrum on another channel.
+ * @param index Index into the layout's channels
+ */
+void OscilloscopeWidget::onSpectrumChannelChanged(int index)
+{
+    if (index >= 0 && index < m_layout.channels.size())
+        m_spectrum->setColor(m_layout.channels.at(index).color);
+    m_spectrumGeneration = m_analyzer->reset();
+    m_spectrum->clear();
+}
+
+/**
+ * @brief Sends FFT size, window, overlap and averaging to the analyzer.
+ */
+void OscilloscopeWidget::onSpectrumSettingsChanged()
+{
+    static const int overlaps[] = {0, 50, 75, 90};
+
+    SpectrumAnalyzer::Settings settings;
+    settings.size = SpectrumAnalyzer::MIN_SIZE << ui->cmbFftSize->currentIndex();
+    settings.window = SpectrumAnalyzer::Window(ui->cmbWindow->currentIndex());
+    settings.overlap = overlaps[qBound(0, ui->cmbOverlap->currentIndex(), 3)];
+    settings.averages = ui->spinAverages->value();
+    m_spectrumGeneration = m_analyzer->setSettings(settings);
+}
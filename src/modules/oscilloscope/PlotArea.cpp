@@ -0,0 +1,491 @@
+/**
+ * @file PlotArea.cpp
+ * @brief Implementation of the oscilloscope waveform plot.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "PlotArea.h"
+
+#include <QVector>
+#include <QLineF>
+#include <QMouseEvent>
+#include <QWheelEvent>
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+const int AXIS_LABEL_WIDTH = 64;
+const int WHEEL_ZOOM_STEP = 5;      ///< Zoom units per wheel notch, a factor of √2
+
+} // namespace
+
+PlotArea::PlotArea(QWidget *parent) : QWidget(parent)
+{
+    m_frameTimer.setSingleShot(true);
+    connect(&m_frameTimer, &QTimer::timeout, this, QOverload<>::of(&QWidget::update));
+    setChannelLayout(ChannelLayout::rawBytes());
+}
+
+void PlotArea::setChannelLayout(const ChannelLayout &layout)
+{
+    m_traces.clear();
+    for (const ChannelLayout::Channel &channel : layout.channels) {
+        Trace trace;
+        trace.channel = channel;
+        trace.min = channel.min;
+        trace.max = channel.fixedRange ? channel.max : 1.0;
+        m_traces.append(trace);
+    }
+    setMemoryDepth(m_memoryDepth);
+    m_live = true;
+    setTrigger(m_trigger);
+}
+
+void PlotArea::appendSamples(int channel, const float *samples, qsizetype count)
+{
+    if (channel < 0 || channel >= m_traces.size() || count <= 0)
+        return;
+    m_traces[channel].ring.append(samples, count);
+    scheduleRepaint();
+}
+
+void PlotArea::setZoom(int zoom)
+{
+    m_zoom = qBound(MIN_ZOOM, zoom, MAX_ZOOM);
+    m_pixelsPerSample = std::pow(2.0, m_zoom / 10.0);
+    // Zoomed out, a pixel column holds a whole number of samples
+    if (m_pixelsPerSample < 1.0)
+        m_pixelsPerSample = 1.0 / qRound(1.0 / m_pixelsPerSample);
+    update();
+}
+
+void PlotArea::zoomToFit()
+{
+    qsizetype samples = 0;
+    for (const Trace &trace : qAsConst(m_traces))
+        samples = qMax(samples, trace.ring.size());
+    if (samples == 0)
+        return;
+    setZoom(int(std::floor(10.0 * std::log2(double(width()) / double(samples)))));
+    m_live = true;
+    emit zoomChanged(m_zoom);
+}
+
+void PlotArea::goLive()
+{
+    m_live = true;
+    update();
+}
+
+void PlotArea::setMemoryDepth(quint64 samples)
+{
+    m_memoryDepth = samples;
+    const quint64 depth = channelDepth();
+    for (Trace &trace : m_traces)
+        trace.ring.setDepth(depth);
+    update();
+}
+
+quint64 PlotArea::channelDepth() const
+{
+    return qMax<quint64>(1, m_memoryDepth / quint64(qMax(1, int(m_traces.size()))));
+}
+
+/// Index of the newest sample of any channel, -1 if there is none
+double PlotArea::newestIndex() const
+{
+    quint64 end = 0;
+    for (const Trace &trace : qAsConst(m_traces))
+        end = qMax(end, trace.ring.end());
+    return double(end) - 1.0;
+}
+
+double PlotArea::oldestIndex() const
+{
+    quint64 begin = 0;
+    bool any = false;
+    for (const Trace &trace : qAsConst(m_traces)) {
+        if (!trace.ring.isEmpty()) {
+            begin = any ? qMin(begin, trace.ring.begin()) : trace.ring.begin();
+            any = true;
+        }
+    }
+    return double(begin);
+}
+
+/**
+ * @brief Moves the right edge to @p index; reaching the newest sample goes live.
+ */
+void PlotArea::setViewLast(double index)
+{
+    const double newest = newestIndex();
+    if (index >= newest) {
+        m_live = true;
+        return;
+    }
+    m_viewLast = qMax(index, oldestIndex());
+    m_live = false;
+}
+
+void PlotArea::setMaxFps(int fps)
+{
+    m_frameIntervalMs = 1000 / qBound(1, fps, 1000);
+}
+
+void PlotArea::clear()
+{
+    for (Trace &trace : m_traces) {
+        trace.ring.clear();
+        trace.capture.clear();
+    }
+    m_haveCapture = false;
+    m_live = true;
+    update();
+}
+
+quint64 PlotArea::sampleCount() const
+{
+    quint64 count = 0;
+    for (const Trace &trace : m_traces)
+        count += trace.ring.end();
+    return count;
+}
+
+void PlotArea::setChannelVisible(int channel, bool visible)
+{
+    if (channel < 0 || channel >= m_traces.size())
+        return;
+    m_traces[channel].visible = visible;
+    update();
+}
+
+void PlotArea::setTrigger(const ScopeTrigger::Settings &settings)
+{
+    m_trigger = settings;
+    const int depth = qMax(1, settings.preTrigger + settings.postTrigger);
+    for (Trace &trace : m_traces)
+        trace.capture = SampleStore(settings.mode == ScopeTrigger::Off ? 2 : depth);
+    m_haveCapture = false;
+    update();
+}
+
+void PlotArea::showCapture(const ScopeTrigger::Capture &capture)
+{
+    if (m_trigger.mode == ScopeTrigger::Off)
+        return;
+    for (int c = 0; c < m_traces.size(); ++c) {
+        SampleStore &ring = m_traces[c].capture;
+        ring.clear();
+        if (c < capture.channels.size())
+            ring.append(capture.channels.at(c).constData(), capture.channels.at(c).size());
+    }
+    m_captureTrigger = capture.triggerOffset;
+    m_captureForced = capture.forced;
+    m_haveCapture = true;
+    scheduleRepaint();
+}
+
+/**
+ * @brief Repaints now if the last frame is old enough, else when it is.
+ */
+void PlotArea::scheduleRepaint()
+{
+    if (m_frameTimer.isActive())
+        return;
+    const qint64 since = m_sinceFrame.isValid() ? m_sinceFrame.elapsed() : m_frameIntervalMs;
+    m_frameTimer.start(int(qMax<qint64>(0, m_frameIntervalMs - since)));
+}
+
+/**
+ * @brief X position of the trigger sample in the capture view.
+ */
+double PlotArea::triggerX() const
+{
+    const int depth = m_trigger.preTrigger + m_trigger.postTrigger;
+    return depth > 0 ? width() * double(m_trigger.preTrigger) / depth : 0.0;
+}
+
+/**
+ * @brief Roll view: newest sample (or, panned, m_viewLast) at the right
+ *        edge. Capture view: the trigger sample at triggerX().
+ */
+PlotArea::Span PlotArea::spanOf(const Trace &trace) const
+{
+    if (m_trigger.mode == ScopeTrigger::Off) {
+        const quint64 end = trace.ring.end();
+        if (end == 0)
+            return {&trace.ring, 0, double(width())};
+        if (m_live)
+            return {&trace.ring, end - 1, double(width())};
+        const double right = qMin(m_viewLast, double(end - 1));
+        const quint64 last = quint64(right);
+        return {&trace.ring, last, width() - (m_viewLast - double(last)) * m_pixelsPerSample};
+    }
+    const quint64 last = trace.capture.end() > 0 ? trace.capture.end() - 1 : 0;
+    return {&trace.capture, last,
+            triggerX() + (double(last) - m_captureTrigger) * m_pixelsPerSample};
+}
+
+void PlotArea::visibleRange(const Span &span, quint64 *first, quint64 *end) const
+{
+    const SampleStore &ring = *span.ring;
+    // One extra sample on each side so the trace reaches the edges
+    const quint64 left = quint64(qMax(0.0, span.xLast) / m_pixelsPerSample) + 1;
+    const quint64 right = span.xLast > width()
+                              ? quint64((span.xLast - width()) / m_pixelsPerSample) : 0;
+    *first = qMax(ring.begin(), span.last >= left ? span.last - left : 0);
+    *end = qMax(*first, span.last + 1 - qMin(right, span.last + 1));
+    *end = qMin(*end, ring.end());
+}
+
+/**
+ * @brief Fits an auto-ranged axis to the samples on screen, with a margin.
+ */
+void PlotArea::updateRange(Trace &trace) const
+{
+    if (trace.channel.fixedRange)
+        return;
+    const Span span = spanOf(trace);
+    quint64 first, end;
+    visibleRange(span, &first, &end);
+    float lo, hi;
+    if (!span.ring->minMax(first, end, &lo, &hi))
+        return;
+    const double margin = hi > lo ? (double(hi) - lo) * 0.05 : qMax(1.0, qAbs(double(hi)) * 0.05);
+    trace.min = lo - margin;
+    trace.max = hi + margin;
+}
+
+void PlotArea::paintEvent(QPaintEvent *)
+{
+    m_sinceFrame.start();
+
+    QPainter p(this);
+    p.fillRect(rect(), QColor(10, 10, 20));
+
+    int w = width();
+    int h = height();
+
+    // Draw grid
+    p.setPen(QPen(QColor(30, 40, 50), 1, Qt::DotLine));
+    for (int x = 0; x < w; x += 50) p.drawLine(x, 0, x, h);
+    for (int y = 0; y < h; y += 50) p.drawLine(0, y, w, y);
+
+    // Draw center line
+    p.setPen(QPen(QColor(60, 60, 80), 1, Qt::DashLine));
+    p.drawLine(0, h/2, w, h/2);
+
+    for (Trace &trace : m_traces) {
+        if (trace.visible) {
+            updateRange(trace);
+            drawChannel(p, trace);
+        }
+    }
+    if (m_trigger.mode != ScopeTrigger::Off) {
+        drawTriggerMarkers(p);
+    } else if (!m_live) {
+        p.setPen(QColor(136, 136, 136));
+        p.drawText(rect().adjusted(0, 5, 0, 0), Qt::AlignHCenter | Qt::AlignTop,
+                   QString("%1 samples back - double-click to follow live data")
+                       .arg(qint64(newestIndex() - m_viewLast)));
+    }
+
+    // Y-axis labels and legend, one column / line per visible channel
+    p.setRenderHint(QPainter::Antialiasing, false);
+    int axisX = 5;
+    int legendY = 20;
+    for (const Trace &trace : qAsConst(m_traces)) {
+        if (!trace.visible)
+            continue;
+        p.setPen(trace.channel.color);
+        p.drawText(axisX, 15, QString::number(trace.max, 'g', 4));
+        p.drawText(axisX, h/2 + 5, QString::number((trace.min + trace.max) / 2, 'g', 4));
+        p.drawText(axisX, h - 5, QString::number(trace.min, 'g', 4));
+        axisX += AXIS_LABEL_WIDTH;
+
+        QString label = "● " + trace.channel.name;
+        if (!trace.channel.unit.isEmpty())
+            label += " [" + trace.channel.unit + "]";
+        p.drawText(w - 10 - p.fontMetrics().horizontalAdvance(label), legendY, label);
+        legendY += 15;
+    }
+
+    emit framePainted();
+}
+
+/**
+ * @brief Zooms in or out by √2 per notch: around the cursor in a panned
+ *        view, else keeping the right edge (or the trigger point) fixed.
+ */
+void PlotArea::wheelEvent(QWheelEvent *event)
+{
+    const int notches = event->angleDelta().y() / 120;
+    if (notches == 0)
+        return;
+    const double oldPixelsPerSample = m_pixelsPerSample;
+    setZoom(m_zoom + notches * WHEEL_ZOOM_STEP);
+    if (!m_live && m_trigger.mode == ScopeTrigger::Off) {
+        const double fromRight = width() - event->position().x();
+        const double anchor = m_viewLast - fromRight / oldPixelsPerSample;
+        setViewLast(anchor + fromRight / m_pixelsPerSample);
+    }
+    emit zoomChanged(m_zoom);
+    event->accept();
+}
+
+void PlotArea::mousePressEvent(QMouseEvent *event)
+{
+    if (event->button() != Qt::LeftButton || m_trigger.mode != ScopeTrigger::Off) {
+        QWidget::mousePressEvent(event);
+        return;
+    }
+    m_dragging = true;
+    m_dragX = qRound(event->position().x());
+    m_dragViewLast = m_live ? newestIndex() : m_viewLast;
+    setCursor(Qt::ClosedHandCursor);
+}
+
+/**
+ * @brief Drags the history; the view stays where it was left while data arrives.
+ */
+void PlotArea::mouseMoveEvent(QMouseEvent *event)
+{
+    if (!m_dragging) {
+        QWidget::mouseMoveEvent(event);
+        return;
+    }
+    const int dx = qRound(event->position().x()) - m_dragX;
+    if (m_live && dx <= 0)
+        return;
+    setViewLast(m_dragViewLast - dx / m_pixelsPerSample);
+    update();
+}
+
+void PlotArea::mouseReleaseEvent(QMouseEvent *event)
+{
+    if (!m_dragging) {
+        QWidget::mouseReleaseEvent(event);
+        return;
+    }
+    m_dragging = false;
+    unsetCursor();
+}
+
+void PlotArea::mouseDoubleClickEvent(QMouseEvent *)
+{
+    goLive();
+}
+
+/**
+ * @brief Draws the trigger point, the trigger level and the capture state.
+ */
+void PlotArea::drawTriggerMarkers(QPainter &p)
+{
+    const int w = width();
+    const int h = height();
+    const QColor color(255, 152, 0);
+    p.setRenderHint(QPainter::Antialiasing, false);
+
+    const int x = qRound(triggerX());
+    p.setPen(QPen(color, 1, Qt::DashLine));
+    p.drawLine(x, 0, x, h);
+    p.setPen(color);
+    p.drawText(x + 4, h - 20, "T");
+
+    const bool hasLevel = m_trigger.type != ScopeTrigger::BytePattern;
+    if (hasLevel && m_trigger.channel >= 0 && m_trigger.channel < m_traces.size()) {
+        const Trace &trace = m_traces.at(m_trigger.channel);
+        if (trace.visible && trace.max > trace.min) {
+            const int y = qRound(h - (m_trigger.level - trace.min) * h / (trace.max - trace.min));
+            p.setPen(QPen(color, 1, Qt::DashLine));
+            p.drawLine(0, y, w, y);
+            p.setPen(color);
+            p.drawText(w - 20, y - 4, "T");
+        }
+    }
+
+    QString state;
+    if (!m_haveCapture)
+        state = "Waiting for trigger...";
+    else if (m_captureForced)
+        state = "Auto (no trigger)";
+    if (!state.isEmpty()) {
+        p.setPen(color);
+        p.drawText(rect().adjusted(0, 5, 0, 0), Qt::AlignHCenter | Qt::AlignTop, state);
+    }
+}
+
+/**
+ * @brief Draws one channel's span: the roll history or the capture.
+ */
+void PlotArea::drawChannel(QPainter &p, const Trace &trace)
+{
+    const Span span = spanOf(trace);
+    const SampleStore &ring = *span.ring;
+    if (ring.isEmpty())
+        return;
+    quint64 first, end;
+    visibleRange(span, &first, &end);
+    if (first >= end)
+        return;
+
+    const int h = height();
+    const double yScale = h / (trace.max - trace.min);
+    const double yMin = trace.min;
+    auto mapY = [h, yScale, yMin](float v) -> double {
+        return h - (v - yMin) * yScale;
+    };
+
+    if (m_pixelsPerSample >= 1.0) {
+        // One vertex per sample
+        QVector<QPointF> points;
+        points.reserve(int(end - first));
+        for (quint64 i = first; i < end; ++i)
+            points.append(QPointF(span.xLast - (double(span.last) - double(i)) * m_pixelsPerSample,
+                                  mapY(ring.at(i))));
+
+        p.setRenderHint(QPainter::Antialiasing, true);
+        p.setPen(QPen(trace.channel.color, 2));
+        p.drawPolyline(points.constData(), int(points.size()));
+        return;
+    }
+
+    // Column k covers the absolute samples [k * perColumn, (k + 1) * perColumn)
+    const quint64 perColumn = quint64(qRound(1.0 / m_pixelsPerSample));
+    const quint64 lastColumn = span.last / perColumn;
+
+    QVector<QLineF> lines;
+    lines.reserve(int((end - 1) / perColumn - first / perColumn + 1));
+    float prevLo = 0, prevHi = 0;
+    bool havePrev = false;
+    for (quint64 k = first / perColumn; k <= (end - 1) / perColumn; ++k) {
+        float lo, hi;
+        if (!ring.minMax(qMax(k * perColumn, first), qMin((k + 1) * perColumn, end), &lo, &hi)) {
+            havePrev = false;
+            continue;
+        }
+        // Reach back to the previous column so steep edges stay connected
+        float top = hi, bottom = lo;
+        if (havePrev) {
+            bottom = std::min(lo, prevHi);
+            top = std::max(hi, prevLo);
+        }
+        prevLo = lo;
+        prevHi = hi;
+        havePrev = true;
+
+        const double x = std::ceil(span.xLast) - 0.5 - (double(lastColumn) - double(k));
+        const double yTop = mapY(top);
+        lines.append(QLineF(x, yTop, x, std::max(mapY(bottom), yTop + 1.0)));
+    }
+
+    p.setRenderHint(QPainter::Antialiasing, false);
+    p.setPen(QPen(trace.channel.color, 1));
+    p.drawLines(lines.constData(), int(lines.size()));
+}
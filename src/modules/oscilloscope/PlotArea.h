@@ -0,0 +1,213 @@
+/**
+ * @file PlotArea.h
+ * @brief Waveform plot of the oscilloscope.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * The plot shows the channels of a ChannelLayout, each with its own colour
+ * and vertical axis; the axis labels of the visible channels sit side by
+ * side on the left. Samples are appended in batches to one SampleStore per
+ * channel and never trigger a paint directly: a dirty plot is repainted at
+ * most once per frame interval (setMaxFps()), however fast data arrives.
+ * setMemoryDepth() shares the sample memory between the channels.
+ *
+ * Zoomed in, each sample is a vertex of an antialiased polyline. Zoomed out
+ * to several samples per pixel, every pixel column is drawn as one vertical
+ * line from the minimum to the maximum of its samples, so spikes stay
+ * visible and a frame costs one line per column. Columns cover fixed runs
+ * of absolute sample indices, so the trace does not shimmer as it scrolls.
+ * The stores' min/max pyramids keep a column cheap at any zoom, so the whole
+ * memory can be shown at once.
+ *
+ * The view follows the newest sample ("live") until it is dragged back into
+ * the history; the mouse wheel zooms around the cursor and a double-click
+ * returns to live. The view position is an absolute sample index shared by
+ * all channels, which match up sample for sample in a layout.
+ *
+ * With a trigger mode other than Off the plot shows the latest capture
+ * instead, with the trigger sample at preTrigger / (preTrigger +
+ * postTrigger) of the width and markers for the trigger point and level.
+ */
+
+#ifndef PLOTAREA_H
+#define PLOTAREA_H
+
+#include <QWidget>
+#include <QPainter>
+#include <QTimer>
+#include <QElapsedTimer>
+
+#include "ChannelLayout.h"
+#include "SampleStore.h"
+#include "ScopeTrigger.h"
+
+/**
+ * @brief Custom widget for rendering the oscilloscope plot area.
+ *
+ * Renders a real-time waveform with configurable timebase and grid overlay.
+ * In raw mode the channels are RX (green) and TX (blue).
+ */
+class PlotArea : public QWidget {
+    Q_OBJECT
+public:
+    /**
+     * @brief Constructs a PlotArea widget.
+     * @param parent Parent widget
+     */
+    explicit PlotArea(QWidget* parent = nullptr);
+
+    /**
+     * @brief Replaces the channels with those of @p layout, all visible and empty.
+     */
+    void setChannelLayout(const ChannelLayout &layout);
+
+    /**
+     * @brief Appends decoded samples to one channel.
+     * @param channel Index into the layout's channels
+     * @param samples Values to plot, oldest first
+     */
+    void appendSamples(int channel, const float *samples, qsizetype count);
+
+    static const int MIN_ZOOM = -200;
+    static const int MAX_ZOOM = 40;
+
+    /**
+     * @brief Sets the horizontal scale.
+     * @param zoom Tenths of a power of two pixels per sample: 0 draws one
+     *        sample per pixel, 40 sixteen pixels per sample, -200 about a
+     *        million samples per pixel column
+     */
+    void setZoom(int zoom);
+    int zoom() const { return m_zoom; }
+    double pixelsPerSample() const { return m_pixelsPerSample; }
+
+    /**
+     * @brief Zooms out until all stored samples fit, and follows the newest.
+     */
+    void zoomToFit();
+
+    /**
+     * @brief Follows the newest samples again after a pan.
+     */
+    void goLive();
+    bool isLive() const { return m_live; }
+
+    /**
+     * @brief Sets the sample memory shared by all channels.
+     * @param samples Total; each of n channels keeps at least samples / n
+     */
+    void setMemoryDepth(quint64 samples);
+
+    /**
+     * @brief Caps how often new data repaints the plot.
+     * @param fps Frames per second
+     */
+    void setMaxFps(int fps);
+
+    /**
+     * @brief Clears all data from every channel.
+     */
+    void clear();
+
+    /**
+     * @brief Returns total samples received.
+     * @return Sample count
+     */
+    quint64 sampleCount() const;
+
+    int channelCount() const { return int(m_traces.size()); }
+
+    /**
+     * @brief Shows or hides one channel.
+     */
+    void setChannelVisible(int channel, bool visible);
+
+    /**
+     * @brief Switches between the roll display (mode Off) and captures, and
+     *        places the trigger markers. Drops the capture shown.
+     */
+    void setTrigger(const ScopeTrigger::Settings &settings);
+
+    /**
+     * @brief Shows a capture completed by the trigger.
+     */
+    void showCapture(const ScopeTrigger::Capture &capture);
+
+signals:
+    /**
+     * @brief Emitted after each repaint, at most at the frame rate cap.
+     */
+    void framePainted();
+
+    /**
+     * @brief The wheel or zoomToFit() changed the zoom.
+     */
+    void zoomChanged(int zoom);
+
+protected:
+    /**
+     * @brief Paints the oscilloscope display.
+     */
+    void paintEvent(QPaintEvent *) override;
+    void wheelEvent(QWheelEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void mouseReleaseEvent(QMouseEvent *event) override;
+    void mouseDoubleClickEvent(QMouseEvent *event) override;
+
+private:
+    struct Trace {
+        ChannelLayout::Channel channel;
+        SampleStore ring;
+        SampleStore capture{2};     ///< Latest trigger capture, indices from 0
+        bool visible = true;
+        double min = 0.0;           ///< Axis range of the current frame
+        double max = 1.0;
+    };
+
+    /// Samples a trace shows: absolute index last is drawn at x = xLast
+    struct Span {
+        const SampleStore *ring;
+        quint64 last;
+        double xLast;
+    };
+
+    QList<Trace> m_traces;
+    double m_pixelsPerSample = 1.0;
+    int m_zoom = 0;
+    quint64 m_memoryDepth = quint64(32) << 20;
+
+    bool m_live = true;
+    double m_viewLast = 0.0;        ///< Sample index at the right edge when not live
+    bool m_dragging = false;
+    int m_dragX = 0;
+    double m_dragViewLast = 0.0;
+
+    ScopeTrigger::Settings m_trigger;
+    bool m_haveCapture = false;
+    bool m_captureForced = false;
+    int m_captureTrigger = 0;       ///< Index of the trigger sample in the captures
+
+    QTimer m_frameTimer;            ///< Single shot; fires when the next frame is due
+    QElapsedTimer m_sinceFrame;
+    int m_frameIntervalMs = 33;
+
+    void scheduleRepaint();
+    quint64 channelDepth() const;
+    double newestIndex() const;
+    double oldestIndex() const;
+    void setViewLast(double index);
+    Span spanOf(const Trace &trace) const;
+    /// Absolute indices [*first, *end) of the span that fall on screen
+    void visibleRange(const Span &span, quint64 *first, quint64 *end) const;
+    double triggerX() const;
+    void updateRange(Trace &trace) const;
+    void drawChannel(QPainter &p, const Trace &trace);
+    void drawTriggerMarkers(QPainter &p);
+};
+
+#endif // PLOTAREA_H
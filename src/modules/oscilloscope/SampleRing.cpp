@@ -0,0 +1,88 @@
+/**
+ * @file SampleRing.cpp
+ * @brief Implementation of the oscilloscope sample ring.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "SampleRing.h"
+
+#include <algorithm>
+
+SampleRing::SampleRing(qsizetype capacity)
+{
+    qsizetype cap = 2;
+    while (cap < capacity)
+        cap <<= 1;
+    m_data.resize(cap);
+    m_mask = quint64(cap - 1);
+}
+
+void SampleRing::clear()
+{
+    m_begin = 0;
+    m_end = 0;
+}
+
+template <typename Convert, typename T>
+void SampleRing::appendWith(const T *samples, qsizetype count, Convert convert)
+{
+    // Of a burst larger than the ring only the tail survives
+    const qsizetype cap = capacity();
+    if (count > cap) {
+        m_end += quint64(count - cap);
+        samples += count - cap;
+        count = cap;
+    }
+
+    float *data = m_data.data();
+    qsizetype pos = qsizetype(m_end & m_mask);
+    while (count > 0) {
+        const qsizetype run = qMin(count, cap - pos);
+        std::transform(samples, samples + run, data + pos, convert);
+        samples += run;
+        count -= run;
+        m_end += quint64(run);
+        pos = 0;
+    }
+    if (m_end - m_begin > quint64(cap))
+        m_begin = m_end - quint64(cap);
+}
+
+void SampleRing::append(const float *samples, qsizetype count)
+{
+    appendWith(samples, count, [](float v) { return v; });
+}
+
+void SampleRing::appendBytes(const char *bytes, qsizetype count)
+{
+    appendWith(bytes, count, [](char c) { return float(quint8(c)); });
+}
+
+bool SampleRing::minMax(quint64 first, quint64 last, float *min, float *max) const
+{
+    first = qMax(first, m_begin);
+    last = qMin(last, m_end);
+    if (first >= last)
+        return false;
+
+    // At most two contiguous runs; plain loops so the compiler vectorises them
+    const float *data = m_data.constData();
+    float lo = data[first & m_mask];
+    float hi = lo;
+    while (first < last) {
+        const qsizetype pos = qsizetype(first & m_mask);
+        const qsizetype run = qsizetype(qMin<quint64>(last - first, quint64(capacity() - pos)));
+        for (const float *p = data + pos, *e = p + run; p != e; ++p) {
+            lo = std::min(lo, *p);
+            hi = std::max(hi, *p);
+        }
+        first += quint64(run);
+    }
+    *min = lo;
+    *max = hi;
+    return true;
+}
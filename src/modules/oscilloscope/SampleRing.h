@@ -0,0 +1,70 @@
+/**
+ * @file SampleRing.h
+ * @brief Fixed-capacity sample history for one oscilloscope channel.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * Samples are addressed by their absolute index since the last clear(), so
+ * a view can keep pointing at the same sample while new data pushes old
+ * data out. Only the newest capacity() samples are kept; appending never
+ * allocates or moves the stored data.
+ */
+
+#ifndef SAMPLERING_H
+#define SAMPLERING_H
+
+#include <QVector>
+#include <QtGlobal>
+
+class SampleRing
+{
+public:
+    /**
+     * @brief Creates a ring holding at least @p capacity samples.
+     * @param capacity Rounded up to the next power of two
+     */
+    explicit SampleRing(qsizetype capacity = 1 << 20);
+
+    qsizetype capacity() const { return m_mask + 1; }
+    qsizetype size() const { return qsizetype(m_end - m_begin); }
+    bool isEmpty() const { return m_end == m_begin; }
+
+    /// Absolute index of the oldest sample still held
+    quint64 begin() const { return m_begin; }
+    /// Absolute index one past the newest sample, i.e. samples appended so far
+    quint64 end() const { return m_end; }
+
+    /// Sample at absolute index @p index, which must lie in [begin(), end())
+    float at(quint64 index) const { return m_data[qsizetype(index & m_mask)]; }
+
+    void clear();
+
+    /// Appends @p count samples, dropping the oldest ones once full
+    void append(const float *samples, qsizetype count);
+    /// Appends raw bytes as samples 0-255
+    void appendBytes(const char *bytes, qsizetype count);
+
+    /**
+     * @brief Smallest and largest sample in the absolute range [first, last).
+     *
+     * The range is clipped to what the ring still holds.
+     * @return false if nothing of the range is left
+     */
+    bool minMax(quint64 first, quint64 last, float *min, float *max) const;
+
+private:
+    QVector<float> m_data;
+    quint64 m_mask = 0;
+    quint64 m_begin = 0;
+    quint64 m_end = 0;
+
+    /// Copies @p count samples in at most two contiguous runs
+    template <typename Convert, typename T>
+    void appendWith(const T *samples, qsizetype count, Convert convert);
+};
+
+#endif // SAMPLERING_H
@@ -0,0 +1,208 @@
+/**
+ * @file SampleStore.cpp
+ * @brief Implementation of the chunked oscilloscope sample memory.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "SampleStore.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+/// Folds values [first, last) into lo / hi; a plain loop the compiler vectorises
+inline void scan(const float *values, int first, int last, float &lo, float &hi)
+{
+    for (const float *p = values + first, *e = values + last; p < e; ++p) {
+        lo = std::min(lo, *p);
+        hi = std::max(hi, *p);
+    }
+}
+
+inline void scan(const float *mins, const float *maxs, int first, int last, float &lo, float &hi)
+{
+    for (int i = first; i < last; ++i) {
+        lo = std::min(lo, mins[i]);
+        hi = std::max(hi, maxs[i]);
+    }
+}
+
+} // namespace
+
+SampleStore::SampleStore(quint64 depth)
+{
+    setDepth(depth);
+}
+
+void SampleStore::setDepth(quint64 depth)
+{
+    m_depth = qMax<quint64>(1, depth);
+    trim();
+}
+
+void SampleStore::clear()
+{
+    if (!m_chunks.isEmpty())
+        m_spare = m_chunks.last();
+    m_chunks.clear();
+    m_firstChunk = 0;
+    m_end = 0;
+}
+
+void SampleStore::append(const float *samples, qsizetype count)
+{
+    while (count > 0) {
+        const int offset = int(m_end & CHUNK_MASK);
+        if (offset == 0) {
+            Chunk chunk;
+            std::swap(chunk, m_spare);
+            if (chunk.samples.size() != CHUNK_SIZE) {
+                chunk.samples.resize(CHUNK_SIZE);
+                chunk.min1.resize(CHUNK_SIZE >> LEVEL1_BITS);
+                chunk.max1.resize(CHUNK_SIZE >> LEVEL1_BITS);
+                chunk.min2.resize(CHUNK_SIZE >> LEVEL2_BITS);
+                chunk.max2.resize(CHUNK_SIZE >> LEVEL2_BITS);
+            }
+            if (m_chunks.isEmpty())
+                m_firstChunk = m_end >> CHUNK_BITS;
+            m_chunks.append(chunk);
+        }
+        const int run = int(qMin<qsizetype>(count, CHUNK_SIZE - offset));
+        appendToChunk(m_chunks.last(), offset, samples, run);
+        samples += run;
+        count -= run;
+        m_end += quint64(run);
+        trim();
+    }
+}
+
+/**
+ * @brief Drops whole chunks from the front while the rest still holds the depth.
+ */
+void SampleStore::trim()
+{
+    while (m_chunks.size() > 1 && m_end - ((m_firstChunk + 1) << CHUNK_BITS) >= m_depth) {
+        m_spare = m_chunks.takeFirst();
+        ++m_firstChunk;
+    }
+}
+
+/**
+ * @brief Copies samples into a chunk and updates the pyramid entries they touch.
+ *
+ * An entry that already held samples before @p offset is merged with the
+ * new ones; entries starting at or after @p offset are overwritten.
+ */
+void SampleStore::appendToChunk(Chunk &chunk, int offset, const float *samples, int count)
+{
+    std::memcpy(chunk.samples.data() + offset, samples, size_t(count) * sizeof(float));
+    const int end = offset + count;
+
+    const float *data = chunk.samples.constData();
+    float *min1 = chunk.min1.data();
+    float *max1 = chunk.max1.data();
+    const int first1 = offset >> LEVEL1_BITS;
+    const int last1 = (end - 1) >> LEVEL1_BITS;
+    for (int b = first1; b <= last1; ++b) {
+        const int from = qMax(b << LEVEL1_BITS, offset);
+        const int to = qMin((b + 1) << LEVEL1_BITS, end);
+        float lo = data[from], hi = lo;
+        scan(data, from + 1, to, lo, hi);
+        if (from > b << LEVEL1_BITS) {
+            lo = std::min(lo, min1[b]);
+            hi = std::max(hi, max1[b]);
+        }
+        min1[b] = lo;
+        max1[b] = hi;
+    }
+
+    // Level 2 from the level 1 entries [first1, last1] just written
+    const int perLevel2 = 1 << (LEVEL2_BITS - LEVEL1_BITS);
+    float *min2 = chunk.min2.data();
+    float *max2 = chunk.max2.data();
+    const int first2 = offset >> LEVEL2_BITS;
+    const int last2 = (end - 1) >> LEVEL2_BITS;
+    for (int b = first2; b <= last2; ++b) {
+        const int from = qMax(b * perLevel2, first1);
+        const int to = qMin((b + 1) * perLevel2, last1 + 1);
+        float lo = min1[from], hi = max1[from];
+        scan(min1, max1, from + 1, to, lo, hi);
+        if (from > b * perLevel2) {
+            lo = std::min(lo, min2[b]);
+            hi = std::max(hi, max2[b]);
+        }
+        min2[b] = lo;
+        max2[b] = hi;
+    }
+
+    float lo = min2[first2], hi = max2[first2];
+    scan(min2, max2, first2 + 1, last2 + 1, lo, hi);
+    if (offset > 0) {
+        lo = std::min(lo, chunk.min);
+        hi = std::max(hi, chunk.max);
+    }
+    chunk.min = lo;
+    chunk.max = hi;
+}
+
+/**
+ * @brief Extremes of chunk offsets [first, last): raw samples up to the next
+ *        64 boundary, level 1 up to the next 4096 boundary, level 2 between.
+ */
+void SampleStore::chunkMinMax(const Chunk &chunk, int first, int last, float &lo, float &hi)
+{
+    const float *data = chunk.samples.constData();
+    const int a = ((first + (1 << LEVEL1_BITS) - 1) >> LEVEL1_BITS) << LEVEL1_BITS;
+    const int b = (last >> LEVEL1_BITS) << LEVEL1_BITS;
+    if (a >= b) {
+        scan(data, first, last, lo, hi);
+        return;
+    }
+    scan(data, first, a, lo, hi);
+    scan(data, b, last, lo, hi);
+
+    const int perLevel2 = 1 << (LEVEL2_BITS - LEVEL1_BITS);
+    const int a1 = a >> LEVEL1_BITS;
+    const int b1 = b >> LEVEL1_BITS;
+    const int a2 = (a1 + perLevel2 - 1) / perLevel2;
+    const int b2 = b1 / perLevel2;
+    if (a2 >= b2) {
+        scan(chunk.min1.constData(), chunk.max1.constData(), a1, b1, lo, hi);
+        return;
+    }
+    scan(chunk.min1.constData(), chunk.max1.constData(), a1, a2 * perLevel2, lo, hi);
+    scan(chunk.min1.constData(), chunk.max1.constData(), b2 * perLevel2, b1, lo, hi);
+    scan(chunk.min2.constData(), chunk.max2.constData(), a2, b2, lo, hi);
+}
+
+bool SampleStore::minMax(quint64 first, quint64 last, float *min, float *max) const
+{
+    first = qMax(first, begin());
+    last = qMin(last, m_end);
+    if (first >= last)
+        return false;
+
+    float lo = at(first);
+    float hi = lo;
+    while (first < last) {
+        const Chunk &chunk = m_chunks.at(qsizetype((first >> CHUNK_BITS) - m_firstChunk));
+        const int from = int(first & CHUNK_MASK);
+        const int to = int(qMin<quint64>(last - first, quint64(CHUNK_SIZE - from))) + from;
+        // A fully covered chunk is complete, so its summary is final
+        if (from == 0 && to == CHUNK_SIZE) {
+            lo = std::min(lo, chunk.min);
+            hi = std::max(hi, chunk.max);
+        } else {
+            chunkMinMax(chunk, from, to, lo, hi);
+        }
+        first += quint64(to - from);
+    }
+    *min = lo;
+    *max = hi;
+    return true;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file SampleStore.h
+ * @brief Deep sample memory for one oscilloscope channel.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * Samples are kept in chunks of 64 Ki, allocated as data arrives, so the
+ * depth can be tens of millions of samples without reserving it up front;
+ * once the depth is exceeded the oldest chunk is dropped (and its memory
+ * reused for the next one). As in SampleRing, samples are addressed by
+ * their absolute index since the last clear().
+ *
+ * Every chunk carries a min/max pyramid: the extremes of each run of 64
+ * samples, of each run of 4096 and of the whole chunk. append() updates
+ * only the entries its samples fall into. minMax() answers from the
+ * coarsest entries that fit the range and reads at most a few hundred
+ * values at its ragged ends, so a pixel column costs about the same
+ * whether it covers ten samples or ten million.
+ */
+
+#ifndef SAMPLESTORE_H
+#define SAMPLESTORE_H
+
+#include <QList>
+#include <QVector>
+#include <QtGlobal>
+
+class SampleStore
+{
+public:
+    static const int CHUNK_BITS = 16;
+    static const qsizetype CHUNK_SIZE = qsizetype(1) << CHUNK_BITS;
+
+    /**
+     * @brief Creates an empty store.
+     * @param depth Samples kept at least; rounded up to whole chunks
+     */
+    explicit SampleStore(quint64 depth = quint64(1) << 22);
+
+    quint64 depth() const { return m_depth; }
+    /// Changes the depth; drops the oldest chunks if the store is now too deep
+    void setDepth(quint64 depth);
+
+    qsizetype size() const { return qsizetype(m_end - begin()); }
+    bool isEmpty() const { return m_end == begin(); }
+
+    /// Absolute index of the oldest sample still held
+    quint64 begin() const { return m_firstChunk << CHUNK_BITS; }
+    /// Absolute index one past the newest sample, i.e. samples appended so far
+    quint64 end() const { return m_end; }
+
+    /// Sample at absolute index @p index, which must lie in [begin(), end())
+    float at(quint64 index) const
+    {
+        return m_chunks.at(qsizetype((index >> CHUNK_BITS) - m_firstChunk))
+            .samples.at(qsizetype(index & CHUNK_MASK));
+    }
+
+    void clear();
+
+    /// Appends @p count samples, dropping the oldest chunks beyond the depth
+    void append(const float *samples, qsizetype count);
+
+    /**
+     * @brief Smallest and largest sample in the absolute range [first, last).
+     *
+     * The range is clipped to what the store still holds.
+     * @return false if nothing of the range is left
+     */
+    bool minMax(quint64 first, quint64 last, float *min, float *max) const;
+
+private:
+    static const int LEVEL1_BITS = 6;   ///< 64 samples per level 1 entry
+    static const int LEVEL2_BITS = 12;  ///< 4096 samples per level 2 entry
+    static const quint64 CHUNK_MASK = quint64(CHUNK_SIZE) - 1;
+
+    struct Chunk {
+        QVector<float> samples;
+        QVector<float> min1, max1;
+        QVector<float> min2, max2;
+        float min = 0.0f;
+        float max = 0.0f;
+    };
+
+    QList<Chunk> m_chunks;
+    quint64 m_firstChunk = 0;       ///< Absolute number of m_chunks.first()
+    quint64 m_end = 0;
+    quint64 m_depth = 0;
+    Chunk m_spare;                  ///< Last dropped chunk, recycled by the next one
+
+    void appendToChunk(Chunk &chunk, int offset, const float *samples, int count);
+    static void chunkMinMax(const Chunk &chunk, int first, int last, float &lo, float &hi);
+    void trim();
+};
+
+#endif // SAMPLESTORE_H
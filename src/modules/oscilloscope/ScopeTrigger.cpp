@@ -0,0 +1,230 @@
+/**
+ * @file ScopeTrigger.cpp
+ * @brief Implementation of the oscilloscope trigger.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "ScopeTrigger.h"
+
+#include <algorithm>
+
+bool ScopeTrigger::configure(const Settings &settings, int channelCount, bool aligned,
+                             QString *errorMessage)
+{
+    m_settings = settings;
+    m_settings.preTrigger = qMax(0, settings.preTrigger);
+    m_settings.postTrigger = qMax(1, settings.postTrigger);
+    m_aligned = aligned;
+    m_channelCount = channelCount;
+    m_end = 0;
+    m_hits.clear();
+    m_capture = Capture();
+    m_state = Idle;
+
+    m_history.clear();
+    if (m_settings.mode == Off || m_settings.channel < 0 || m_settings.channel >= channelCount)
+        return true;
+
+    if (m_settings.type == BytePattern) {
+        if (!m_matcher.setPatterns({m_settings.pattern}, errorMessage))
+            return false;
+        if (m_matcher.isEmpty()) {
+            if (errorMessage)
+                *errorMessage = "The byte pattern is empty";
+            return false;
+        }
+    }
+
+    for (int c = 0; c < channelCount; ++c)
+        m_history.append(SampleRing(isCaptured(c) ? m_settings.preTrigger : 0));
+    m_sinceCapture.start();
+    rearm();
+    return true;
+}
+
+void ScopeTrigger::rearm()
+{
+    m_state = Armed;
+    m_ready = false;
+    m_inPulse = false;
+}
+
+void ScopeTrigger::scanBytes(const QByteArray &data, quint64 sampleIndex, bool bytesAreSamples)
+{
+    m_matchIds.clear();
+    m_matchEnds.clear();
+    if (m_matcher.feed(data.constData(), data.size(), m_matchIds, &m_matchEnds) == 0)
+        return;
+    for (qint64 end : qAsConst(m_matchEnds))
+        m_hits.append(bytesAreSamples ? sampleIndex + quint64(end - 1) : sampleIndex);
+}
+
+/**
+ * @brief Index in @p x of the next sample that fires the trigger, or -1.
+ * @param base Absolute index of x[0]
+ */
+int ScopeTrigger::findTrigger(const QVector<float> &x, quint64 base, int from)
+{
+    const int n = int(x.size());
+    const float level = float(m_settings.level);
+    const float low = float(m_settings.level - m_settings.hysteresis);
+    const float high = float(m_settings.level + m_settings.hysteresis);
+    const float *v = x.constData();
+
+    switch (m_settings.type) {
+    case RisingEdge:
+        for (int i = from; i < n; ++i) {
+            if (v[i] < low) {
+                m_ready = true;
+            } else if (m_ready && v[i] >= level) {
+                m_ready = false;
+                return i;
+            }
+        }
+        break;
+    case FallingEdge:
+        for (int i = from; i < n; ++i) {
+            if (v[i] > high) {
+                m_ready = true;
+            } else if (m_ready && v[i] <= level) {
+                m_ready = false;
+                return i;
+            }
+        }
+        break;
+    case AboveLevel:
+        for (int i = from; i < n; ++i) {
+            if (v[i] >= level)
+                return i;
+        }
+        break;
+    case BelowLevel:
+        for (int i = from; i < n; ++i) {
+            if (v[i] <= level)
+                return i;
+        }
+        break;
+    case PositivePulse:
+    case NegativePulse: {
+        // A negative pulse is a positive one of the mirrored signal
+        const bool positive = m_settings.type == PositivePulse;
+        for (int i = from; i < n; ++i) {
+            const bool inside = positive ? v[i] >= level : v[i] <= level;
+            const bool outside = positive ? v[i] < low : v[i] > high;
+            if (!m_inPulse) {
+                if (outside) {
+                    m_ready = true;
+                } else if (m_ready && inside) {
+                    m_inPulse = true;
+                    m_pulseStart = base + quint64(i);
+                }
+            } else if (outside) {
+                m_inPulse = false;
+                const quint64 width = base + quint64(i) - m_pulseStart;
+                if (width >= quint64(m_settings.minWidth) && width <= quint64(m_settings.maxWidth))
+                    return i;
+            }
+        }
+        break;
+    }
+    case BytePattern:
+        // Matches found while not armed are stale
+        while (!m_hits.isEmpty() && m_hits.first() < base + quint64(from))
+            m_hits.removeFirst();
+        if (!m_hits.isEmpty() && m_hits.first() < base + quint64(n))
+            return int(m_hits.takeFirst() - base);
+        break;
+    }
+    return -1;
+}
+
+void ScopeTrigger::startCapture(const QVector<QVector<float>> &channels, quint64 base, int at,
+                                bool forced)
+{
+    const int pre = m_settings.preTrigger;
+    m_capture = Capture();
+    m_capture.channels.resize(channels.size());
+    m_capture.triggerIndex = base + quint64(at);
+    m_capture.forced = forced;
+
+    for (int c = 0; c < channels.size(); ++c) {
+        if (!isCaptured(c) || channels.at(c).size() < at)
+            continue;
+        QVector<float> &out = m_capture.channels[c];
+        out.reserve(pre + m_settings.postTrigger);
+
+        // Pre-trigger samples: the older ones from the history, the rest from this batch
+        const int fromBatch = qMin(at, pre);
+        const SampleRing &history = m_history.at(c);
+        const quint64 fromHistory = qMin<quint64>(quint64(pre - fromBatch), quint64(history.size()));
+        for (quint64 i = history.end() - fromHistory; i < history.end(); ++i)
+            out.append(history.at(i));
+        const float *src = channels.at(c).constData() + (at - fromBatch);
+        out.append(QVector<float>(src, src + fromBatch));
+
+        if (c == m_settings.channel)
+            m_capture.triggerOffset = int(out.size());
+    }
+
+    m_remaining = m_settings.postTrigger;
+    m_state = Capturing;
+}
+
+void ScopeTrigger::process(const QVector<QVector<float>> &channels, QList<Capture> &captures)
+{
+    if (m_state == Idle || m_settings.channel >= channels.size())
+        return;
+
+    const QVector<float> &x = channels.at(m_settings.channel);
+    const int n = int(x.size());
+    const quint64 base = m_end;
+
+    int j = 0;
+    while (j < n) {
+        if (m_state == Capturing) {
+            const int take = qMin(m_remaining, n - j);
+            for (int c = 0; c < channels.size(); ++c) {
+                if (isCaptured(c) && channels.at(c).size() >= j + take) {
+                    const float *src = channels.at(c).constData() + j;
+                    m_capture.channels[c].append(QVector<float>(src, src + take));
+                }
+            }
+            j += take;
+            m_remaining -= take;
+            if (m_remaining == 0) {
+                captures.append(m_capture);
+                m_capture = Capture();
+                m_sinceCapture.start();
+                if (m_settings.mode == Single)
+                    m_state = Stopped;
+                else
+                    rearm();
+            }
+            continue;
+        }
+        if (m_state != Armed)
+            break;
+
+        int at = findTrigger(x, base, j);
+        bool forced = false;
+        if (at < 0) {
+            if (m_settings.mode != Auto || m_sinceCapture.elapsed() < m_settings.autoTimeoutMs)
+                break;
+            // Nothing fired for a while: show the newest samples anyway
+            at = qMax(j, n - m_settings.postTrigger);
+            forced = true;
+        }
+        startCapture(channels, base, at, forced);
+        j = at;
+    }
+
+    for (int c = 0; c < channels.size() && c < m_history.size(); ++c) {
+        if (isCaptured(c))
+            m_history[c].append(channels.at(c).constData(), channels.at(c).size());
+    }
+    m_end += quint64(n);
+}
@@ -0,0 +1,144 @@
+/**
+ * @file ScopeTrigger.h
+ * @brief Triggered acquisition for the oscilloscope.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * Runs on the TelemetryDecoder thread and sees every decoded sample, so no
+ * event is missed between repaints. The newest preTrigger samples of each
+ * channel are kept in a ring; when the condition fires, a capture takes
+ * them plus the next postTrigger samples (the trigger sample first).
+ *
+ * Conditions are evaluated on one channel: rising / falling edge through
+ * the level (re-armed once the signal is back beyond the hysteresis),
+ * above / below the level, or a positive / negative pulse through the
+ * level whose width in samples lies in [minWidth, maxWidth], reported at
+ * the end of the pulse. A byte pattern (TriggerMatcher syntax) is matched
+ * on the raw stream instead: in raw mode it fires at the byte that
+ * completes the match, with a layout at the first sample decoded after it.
+ *
+ * Modes: Normal captures every trigger and re-arms; Single stops after
+ * one capture until configure() re-arms it; Auto behaves like Normal but
+ * forces a capture of the newest samples when nothing fired for
+ * autoTimeoutMs. Off captures nothing (free-running roll display).
+ *
+ * Layout channels share sample indices, so every channel is captured
+ * around the trigger. The raw RX and TX streams do not; there only the
+ * trigger channel is captured.
+ */
+
+#ifndef SCOPETRIGGER_H
+#define SCOPETRIGGER_H
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QList>
+#include <QString>
+#include <QVector>
+
+#include "SampleRing.h"
+#include "TriggerMatcher.h"
+
+class ScopeTrigger
+{
+public:
+    enum Mode { Off, Auto, Normal, Single };
+
+    enum Type { RisingEdge, FallingEdge, AboveLevel, BelowLevel, PositivePulse, NegativePulse, BytePattern };
+
+    enum State {
+        Idle,       ///< Mode Off
+        Armed,      ///< Waiting for the condition
+        Capturing,  ///< Triggered, collecting post-trigger samples
+        Stopped     ///< Single capture done
+    };
+
+    struct Settings {
+        Mode mode = Off;
+        Type type = RisingEdge;
+        int channel = 0;
+        double level = 128.0;
+        double hysteresis = 0.0;
+        int minWidth = 1;               ///< Pulse width range in samples
+        int maxWidth = 1000;
+        QString pattern;                ///< For BytePattern
+        int preTrigger = 200;
+        int postTrigger = 800;
+        int autoTimeoutMs = 200;
+    };
+
+    struct Capture {
+        QVector<QVector<float>> channels;   ///< preTrigger + postTrigger samples; empty if not captured
+        int triggerOffset = 0;              ///< Index of the trigger sample in the channels
+        quint64 triggerIndex = 0;           ///< Absolute index of the trigger sample
+        bool forced = false;                ///< Auto mode timed out without a trigger
+    };
+
+    ScopeTrigger() = default;
+
+    /**
+     * @brief Applies settings, clears the history and arms the trigger.
+     * @param channelCount Channels of the current layout
+     * @param aligned true if all channels share sample indices (layouts)
+     * @return false if the pattern does not compile; the trigger is then idle
+     */
+    bool configure(const Settings &settings, int channelCount, bool aligned,
+                   QString *errorMessage = nullptr);
+
+    const Settings &settings() const { return m_settings; }
+    State state() const { return m_state; }
+
+    /// True if scanBytes() has to see the trigger channel's raw stream
+    bool wantsBytes() const { return m_state != Idle && m_settings.type == BytePattern; }
+
+    /// Samples of the trigger channel passed to process() so far
+    quint64 sampleCount() const { return m_end; }
+
+    /**
+     * @brief Looks for the byte pattern in raw data of the trigger stream.
+     * @param sampleIndex Absolute index of the next sample of the trigger channel
+     * @param bytesAreSamples Raw mode: byte i of @p data is sample sampleIndex + i
+     */
+    void scanBytes(const QByteArray &data, quint64 sampleIndex, bool bytesAreSamples);
+
+    /**
+     * @brief Evaluates the next samples of every channel.
+     * @param channels New samples per channel, as decoded in one batch
+     * @param captures Receives the captures completed by these samples
+     */
+    void process(const QVector<QVector<float>> &channels, QList<Capture> &captures);
+
+private:
+    Settings m_settings;
+    State m_state = Idle;
+    bool m_aligned = false;
+    int m_channelCount = 0;
+
+    QVector<SampleRing> m_history;  ///< Newest preTrigger samples per captured channel
+    quint64 m_end = 0;              ///< Trigger channel samples seen
+
+    // Condition state
+    bool m_ready = false;           ///< Edge / pulse: signal was on the far side of the level
+    bool m_inPulse = false;
+    quint64 m_pulseStart = 0;
+    TriggerMatcher m_matcher;
+    QVector<int> m_matchIds;
+    QVector<qint64> m_matchEnds;
+    QList<quint64> m_hits;          ///< Pattern matches as sample indices, ascending
+
+    // Capture in progress
+    Capture m_capture;
+    int m_remaining = 0;
+    QElapsedTimer m_sinceCapture;
+
+    bool isCaptured(int channel) const { return m_aligned || channel == m_settings.channel; }
+    int findTrigger(const QVector<float> &x, quint64 base, int from);
+    void startCapture(const QVector<QVector<float>> &channels, quint64 base, int at, bool forced);
+    void rearm();
+};
+
+#endif // SCOPETRIGGER_H
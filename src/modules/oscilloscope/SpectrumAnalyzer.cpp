@@ -0,0 +1,286 @@
+/**
+ * @file SpectrumAnalyzer.cpp
+ * @brief Implementation of the oscilloscope spectrum analyzer thread.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "SpectrumAnalyzer.h"
+
+#include <QMutexLocker>
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+const int MAX_IDLE_WAIT_MS = 100;
+const float FLOOR_DB = -200.0f;
+
+/**
+ * @brief Periodic window: the next window would start with w[size].
+ */
+QVector<float> makeWindow(SpectrumAnalyzer::Window window, int size)
+{
+    const double pi = 3.14159265358979323846;
+    QVector<float> w(size);
+    for (int i = 0; i < size; ++i) {
+        const double x = 2.0 * pi * i / size;
+        switch (window) {
+        case SpectrumAnalyzer::Rectangular:
+            w[i] = 1.0f;
+            break;
+        case SpectrumAnalyzer::Hann:
+            w[i] = float(0.5 - 0.5 * std::cos(x));
+            break;
+        case SpectrumAnalyzer::Blackman:
+            w[i] = float(0.42 - 0.5 * std::cos(x) + 0.08 * std::cos(2.0 * x));
+            break;
+        }
+    }
+    return w;
+}
+
+/// Bins on either side of a peak that belong to its main lobe
+int mainLobeBins(SpectrumAnalyzer::Window window)
+{
+    switch (window) {
+    case SpectrumAnalyzer::Rectangular: return 1;
+    case SpectrumAnalyzer::Hann: return 2;
+    case SpectrumAnalyzer::Blackman: return 3;
+    }
+    return 2;
+}
+
+} // namespace
+
+SpectrumAnalyzer::SpectrumAnalyzer(QObject *parent) : QThread(parent)
+{
+    setSettings(Settings());
+    start(QThread::LowPriority);
+}
+
+SpectrumAnalyzer::~SpectrumAnalyzer()
+{
+    m_stop.store(true);
+    m_wakeup.release();
+    wait();
+}
+
+int SpectrumAnalyzer::setSettings(const Settings &settings)
+{
+    QMutexLocker lock(&m_mutex);
+    m_nextSettings = settings;
+    const int generation = m_generation.fetch_add(1) + 1;
+    m_wakeup.release();
+    return generation;
+}
+
+int SpectrumAnalyzer::reset()
+{
+    QMutexLocker lock(&m_mutex);
+    m_epoch.fetch_add(1);
+    m_hasResult = false;
+    const int generation = m_generation.fetch_add(1) + 1;
+    m_wakeup.release();
+    return generation;
+}
+
+bool SpectrumAnalyzer::push(const QVector<float> &samples)
+{
+    if (samples.isEmpty())
+        return true;
+    Batch batch;
+    batch.samples = samples;
+    batch.epoch = m_epoch.load();
+    if (!m_input.push(std::move(batch)))
+        return false;
+    if (m_sleeping.exchange(false))
+        m_wakeup.release();
+    return true;
+}
+
+bool SpectrumAnalyzer::takeSpectrum(Spectrum &spectrum)
+{
+    QMutexLocker lock(&m_mutex);
+    // Re-arm the signal; the next publish() emits again
+    m_notified.store(false);
+    if (!m_hasResult)
+        return false;
+    std::swap(spectrum, m_result);
+    m_hasResult = false;
+    return true;
+}
+
+// --- Analyzer thread ---
+
+void SpectrumAnalyzer::run()
+{
+    Batch batch;
+    while (!m_stop.load()) {
+        if (m_generation.load() != m_appliedGeneration)
+            applySettings();
+
+        int batches = 0;
+        while (batches < MAX_BATCHES && m_input.pop(batch)) {
+            ++batches;
+            // Pushed after a reset() this loop has not applied yet
+            if (batch.epoch - m_appliedEpoch > 0)
+                applySettings();
+            // Pushed before a reset(): another channel, or cleared
+            if (batch.epoch == m_appliedEpoch)
+                m_samples.append(batch.samples);
+            batch = Batch();
+        }
+
+        const int size = m_settings.size;
+        const qsizetype hop = qMax(1, size * (100 - m_settings.overlap) / 100);
+
+        // Behind the stream: skip to the windows of the newest average
+        const qsizetype keep = size + hop * (m_settings.averages - 1);
+        if (m_samples.size() - m_pos > keep + hop)
+            m_pos = m_samples.size() - keep;
+
+        bool analysed = false;
+        while (m_samples.size() - m_pos >= size) {
+            analyse(m_samples.constData() + m_pos);
+            m_pos += hop;
+            analysed = true;
+        }
+        if (m_pos > 0) {
+            const qsizetype consumed = qMin(m_pos, m_samples.size());
+            m_samples.remove(0, consumed);
+            m_pos -= consumed;
+        }
+        if (analysed)
+            publish();
+
+        if (batches > 0)
+            continue;
+        m_sleeping.store(true);
+        if (m_input.isEmpty() && !m_stop.load() && m_generation.load() == m_appliedGeneration)
+            m_wakeup.tryAcquire(1, MAX_IDLE_WAIT_MS);
+        m_sleeping.store(false);
+    }
+}
+
+void SpectrumAnalyzer::applySettings()
+{
+    int epoch;
+    {
+        QMutexLocker lock(&m_mutex);
+        m_settings = m_nextSettings;
+        m_appliedGeneration = m_generation.load();
+        epoch = m_epoch.load();
+    }
+    Settings &s = m_settings;
+    if (!Fft::isValidSize(s.size))
+        s.size = 4096;
+    s.size = qBound(int(MIN_SIZE), s.size, int(MAX_SIZE));
+    s.overlap = qBound(0, s.overlap, 95);
+    s.averages = qBound(1, s.averages, 256);
+
+    if (epoch != m_appliedEpoch) {
+        m_appliedEpoch = epoch;
+        m_samples.clear();
+        m_pos = 0;
+    }
+
+    if (m_fft.size() != s.size)
+        m_fft = Fft(s.size);
+    m_window = makeWindow(s.window, s.size);
+    double sum = 0.0;
+    for (float w : qAsConst(m_window))
+        sum += w;
+    // A sine of amplitude A peaks at |X| = A * sum / 2 in bins 1..size/2-1
+    m_windowScale = 4.0 / (sum * sum);
+
+    const int bins = s.size / 2 + 1;
+    m_frame.resize(s.size);
+    m_power.resize(bins);
+    m_history = QVector<QVector<float>>(s.averages, QVector<float>(bins, 0.0f));
+    m_sum = QVector<double>(bins, 0.0);
+    m_historyNext = 0;
+    m_historyCount = 0;
+}
+
+void SpectrumAnalyzer::analyse(const float *samples)
+{
+    const int size = m_settings.size;
+    const float *w = m_window.constData();
+    float *frame = m_frame.data();
+    for (int i = 0; i < size; ++i)
+        frame[i] = samples[i] * w[i];
+    m_fft.powerSpectrum(frame, m_power.data());
+
+    // Moving average: replace the oldest spectrum in the running sum
+    QVector<float> &oldest = m_history[m_historyNext];
+    double *sum = m_sum.data();
+    const float *power = m_power.constData();
+    for (int k = 0; k < m_power.size(); ++k)
+        sum[k] += double(power[k]) - double(oldest[k]);
+    std::swap(oldest, m_power);
+    m_historyNext = (m_historyNext + 1) % m_history.size();
+    m_historyCount = qMin(m_historyCount + 1, int(m_history.size()));
+}
+
+void SpectrumAnalyzer::publish()
+{
+    const int bins = int(m_sum.size());
+    Spectrum &out = m_spectrum;
+    out.generation = m_appliedGeneration;
+    out.size = m_settings.size;
+    out.averaged = m_historyCount;
+    out.db.resize(bins);
+
+    const double scale = m_windowScale / m_historyCount;
+    for (int k = 0; k < bins; ++k) {
+        // DC and Nyquist have no mirror image in the negative frequencies
+        const double edge = (k == 0 || k == bins - 1) ? 0.25 : 1.0;
+        const double amp2 = qMax(0.0, m_sum.at(k)) * scale * edge;
+        out.db[k] = amp2 > 0.0 ? qMax(FLOOR_DB, float(10.0 * std::log10(amp2))) : FLOOR_DB;
+    }
+
+    // Peaks: local maxima, strongest first, each outside the main lobe of a stronger one
+    const float *db = out.db.constData();
+    QVector<int> candidates;
+    for (int k = 1; k < bins - 1; ++k) {
+        if (db[k] > db[k - 1] && db[k] >= db[k + 1] && db[k] > FLOOR_DB)
+            candidates.append(k);
+    }
+    std::sort(candidates.begin(), candidates.end(), [db](int a, int b) { return db[a] > db[b]; });
+
+    const int lobe = mainLobeBins(m_settings.window);
+    out.peaks.clear();
+    for (int k : qAsConst(candidates)) {
+        if (out.peaks.size() >= MAX_PEAKS)
+            break;
+        bool separate = true;
+        for (const Peak &peak : qAsConst(out.peaks))
+            separate &= std::abs(peak.bin - k) > 2 * lobe;
+        if (!separate)
+            continue;
+        // Parabola through the three bins around the maximum
+        const double a = db[k - 1], b = db[k], c = db[k + 1];
+        const double denominator = a - 2.0 * b + c;
+        const double offset = denominator < 0.0 ? 0.5 * (a - c) / denominator : 0.0;
+        Peak peak;
+        peak.bin = k + offset;
+        peak.db = float(b - 0.25 * (a - c) * offset);
+        out.peaks.append(peak);
+    }
+
+    {
+        QMutexLocker lock(&m_mutex);
+        // Settings changed while this was computed: it would be dropped anyway
+        if (m_generation.load() != m_appliedGeneration)
+            return;
+        std::swap(m_result, m_spectrum);
+        m_hasResult = true;
+    }
+    if (!m_notified.exchange(true))
+        emit spectrumReady();
+}
@@ -0,0 +1,148 @@
+/**
+ * @file SpectrumAnalyzer.h
+ * @brief Background thread computing the averaged spectrum of one channel.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * The GUI thread pushes the decoded samples of the selected channel (the
+ * vectors are implicitly shared, so this is no copy). The analyzer slides
+ * a window of size samples over the stream, advancing by size * (100 -
+ * overlap) / 100, and for every position computes the windowed power
+ * spectrum with Fft. The mean of the last `averages` spectra is converted
+ * to dB, its strongest peaks are located, and the result replaces the
+ * previous one; spectrumReady() is emitted only once the GUI has taken the
+ * last result, so slow painting never queues stale spectra.
+ *
+ * Levels are amplitudes in dB relative to 1 channel unit: a sine of
+ * amplitude A in the middle of a bin reads 20·log10(A) whatever the window,
+ * which is corrected for its coherent gain. When the stream runs ahead of
+ * the analyzer, old positions are skipped so the display stays current.
+ */
+
+#ifndef SPECTRUMANALYZER_H
+#define SPECTRUMANALYZER_H
+
+#include <QThread>
+#include <QList>
+#include <QMutex>
+#include <QSemaphore>
+#include <QVector>
+
+#include <atomic>
+
+#include "Fft.h"
+#include "SpscQueue.h"
+
+class SpectrumAnalyzer : public QThread
+{
+    Q_OBJECT
+
+public:
+    enum Window { Rectangular, Hann, Blackman };
+
+    struct Settings {
+        int size = 4096;            ///< FFT length; power of two, 256-65536
+        Window window = Hann;
+        int overlap = 75;           ///< Percent of a window shared with the next
+        int averages = 4;           ///< Spectra in the moving average
+    };
+
+    struct Peak {
+        double bin = 0.0;           ///< Interpolated between bins
+        float db = 0.0f;
+    };
+
+    struct Spectrum {
+        int generation = 0;
+        int size = 0;               ///< FFT length; bin k is k / size cycles per sample
+        QVector<float> db;          ///< size / 2 + 1 levels, DC first
+        QList<Peak> peaks;          ///< Strongest first
+        int averaged = 0;           ///< Spectra in this average so far
+    };
+
+    static const int MIN_SIZE = 256;
+    static const int MAX_SIZE = 65536;
+    static const int MAX_PEAKS = 5;
+
+    explicit SpectrumAnalyzer(QObject *parent = nullptr);
+    ~SpectrumAnalyzer() override;
+
+    /**
+     * @brief Applies new settings; the average starts over.
+     * @return Generation of the spectra computed with @p settings
+     */
+    int setSettings(const Settings &settings);
+
+    /**
+     * @brief Drops the buffered samples, including batches still queued, and the average.
+     * @return Generation of the spectra computed from now on
+     */
+    int reset();
+
+    /**
+     * @brief Queues samples of the analysed channel. GUI thread only.
+     * @return false if the queue was full and the samples were dropped
+     */
+    bool push(const QVector<float> &samples);
+
+    /**
+     * @brief Takes the newest spectrum. GUI thread only.
+     *
+     * spectrumReady() is emitted again once a newer one is available.
+     */
+    bool takeSpectrum(Spectrum &spectrum);
+
+signals:
+    void spectrumReady();
+
+protected:
+    void run() override;
+
+private:
+    // Shared between threads
+    static const int MAX_BATCHES = 64;
+
+    struct Batch {
+        QVector<float> samples;
+        int epoch = 0;              ///< m_epoch when pushed
+    };
+
+    SpscQueue<Batch> m_input{1024};
+    QSemaphore m_wakeup;
+    std::atomic<bool> m_sleeping{false};
+    std::atomic<bool> m_stop{false};
+    std::atomic<bool> m_notified{false};
+    std::atomic<int> m_generation{0};
+    std::atomic<int> m_epoch{0};    ///< Bumped by reset(); older batches are stale
+    QMutex m_mutex;                 ///< Guards m_nextSettings, m_result and m_hasResult
+    Settings m_nextSettings;
+    Spectrum m_result;
+    bool m_hasResult = false;
+
+    // Analyzer thread only
+    Settings m_settings;
+    int m_appliedGeneration = -1;
+    int m_appliedEpoch = 0;         ///< Epoch of the samples in m_samples
+    Fft m_fft;
+    QVector<float> m_samples;       ///< Unanalysed stream; the next window starts at m_pos
+    qsizetype m_pos = 0;
+    QVector<float> m_window;
+    double m_windowScale = 1.0;     ///< Turns |X|² into amplitude² for bins 1..size/2-1
+    QVector<float> m_frame;
+    QVector<float> m_power;
+    QVector<QVector<float>> m_history;  ///< Last `averages` power spectra
+    QVector<double> m_sum;
+    int m_historyNext = 0;
+    int m_historyCount = 0;
+    Spectrum m_spectrum;            ///< Built here, then swapped into m_result
+
+    void applySettings();
+    void analyse(const float *samples);
+    void publish();
+};
+
+#endif // SPECTRUMANALYZER_H
@@ -0,0 +1,205 @@
+/**
+ * @file SpectrumView.cpp
+ * @brief Implementation of the oscilloscope spectrum panel.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "SpectrumView.h"
+
+#include <QPainter>
+#include <QPointF>
+#include <QVector>
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+const int LEFT_MARGIN = 48;
+const int BOTTOM_MARGIN = 18;
+const double DB_SPAN = 120.0;
+const double DB_STEP = 20.0;
+
+} // namespace
+
+SpectrumView::SpectrumView(QWidget *parent) : QWidget(parent)
+{
+    setMinimumHeight(150);
+    m_frameTimer.setSingleShot(true);
+    connect(&m_frameTimer, &QTimer::timeout, this, QOverload<>::of(&QWidget::update));
+}
+
+void SpectrumView::setSpectrum(const SpectrumAnalyzer::Spectrum &spectrum)
+{
+    m_spectrum = spectrum;
+    updateRange();
+    scheduleRepaint();
+}
+
+void SpectrumView::setSampleRate(double hz)
+{
+    m_sampleRate = qMax(0.0, hz);
+    update();
+}
+
+void SpectrumView::setColor(const QColor &color)
+{
+    m_color = color;
+    update();
+}
+
+void SpectrumView::setMaxFps(int fps)
+{
+    m_frameIntervalMs = 1000 / qBound(1, fps, 1000);
+}
+
+void SpectrumView::clear()
+{
+    m_spectrum = SpectrumAnalyzer::Spectrum();
+    m_topDb = 0.0;
+    update();
+}
+
+void SpectrumView::scheduleRepaint()
+{
+    if (m_frameTimer.isActive())
+        return;
+    const qint64 since = m_sinceFrame.isValid() ? m_sinceFrame.elapsed() : m_frameIntervalMs;
+    m_frameTimer.start(int(qMax<qint64>(0, m_frameIntervalMs - since)));
+}
+
+/**
+ * @brief Moves the top of the scale up at once, but down only after a large drop.
+ */
+void SpectrumView::updateRange()
+{
+    if (m_spectrum.db.isEmpty())
+        return;
+    const float peak = *std::max_element(m_spectrum.db.constBegin(), m_spectrum.db.constEnd());
+    const double top = std::ceil(peak / 10.0) * 10.0 + 10.0;
+    if (top > m_topDb || top < m_topDb - 30.0)
+        m_topDb = top;
+}
+
+QString SpectrumView::frequencyText(double bin) const
+{
+    const int size = qMax(1, m_spectrum.size);
+    if (m_sampleRate <= 0.0)
+        return QString("%1 c/S").arg(bin / size, 0, 'g', 4);
+    const double hz = bin * m_sampleRate / size;
+    if (hz >= 1e6)
+        return QString("%1 MHz").arg(hz / 1e6, 0, 'g', 5);
+    if (hz >= 1e3)
+        return QString("%1 kHz").arg(hz / 1e3, 0, 'g', 5);
+    return QString("%1 Hz").arg(hz, 0, 'g', 5);
+}
+
+void SpectrumView::paintEvent(QPaintEvent *)
+{
+    m_sinceFrame.start();
+
+    QPainter p(this);
+    p.fillRect(rect(), QColor(10, 10, 20));
+
+    const QRect plot(LEFT_MARGIN, 0, width() - LEFT_MARGIN, height() - BOTTOM_MARGIN);
+    if (plot.width() < 10 || plot.height() < 10)
+        return;
+    auto mapY = [&](double db) -> double {
+        return plot.top() + (m_topDb - db) * plot.height() / DB_SPAN;
+    };
+
+    // dB grid and labels
+    for (double db = m_topDb; db >= m_topDb - DB_SPAN; db -= DB_STEP) {
+        const int y = qRound(mapY(db));
+        p.setPen(QPen(QColor(30, 40, 50), 1, Qt::DotLine));
+        p.drawLine(plot.left(), y, plot.right(), y);
+        p.setPen(QColor(136, 136, 136));
+        p.drawText(QRect(0, y - 8, LEFT_MARGIN - 4, 16), Qt::AlignRight | Qt::AlignVCenter,
+                   QString("%1 dB").arg(db));
+    }
+
+    const SpectrumAnalyzer::Spectrum &s = m_spectrum;
+    const int bins = int(s.db.size());
+    if (bins < 2) {
+        p.setPen(QColor(136, 136, 136));
+        p.drawText(plot, Qt::AlignCenter, "Waiting for samples...");
+        return;
+    }
+    const double binsPerPixel = double(bins - 1) / plot.width();
+    auto mapX = [&](double bin) -> double {
+        return plot.left() + bin / binsPerPixel;
+    };
+
+    // Frequency grid: ten divisions from DC to Nyquist
+    for (int i = 0; i <= 10; ++i) {
+        const double bin = (bins - 1) * i / 10.0;
+        const int x = qRound(mapX(bin));
+        p.setPen(QPen(QColor(30, 40, 50), 1, Qt::DotLine));
+        p.drawLine(x, plot.top(), x, plot.bottom());
+        if (i % 2 == 0) {
+            p.setPen(QColor(136, 136, 136));
+            QRect box(x - 60, plot.bottom() + 2, 120, BOTTOM_MARGIN - 2);
+            int align = Qt::AlignHCenter;
+            if (i == 0) {
+                box.moveLeft(x);
+                align = Qt::AlignLeft;
+            } else if (i == 10) {
+                box.moveRight(x);
+                align = Qt::AlignRight;
+            }
+            p.drawText(box, align | Qt::AlignVCenter, frequencyText(bin));
+        }
+    }
+
+    // Trace: one vertex per bin, or per pixel column holding the strongest of its bins
+    QVector<QPointF> points;
+    const float *db = s.db.constData();
+    if (binsPerPixel <= 1.0) {
+        points.reserve(bins);
+        for (int k = 0; k < bins; ++k)
+            points.append(QPointF(mapX(k), mapY(db[k])));
+    } else {
+        points.reserve(plot.width() + 1);
+        int k = 0;
+        for (int column = 0; column <= plot.width() && k < bins; ++column) {
+            const int end = qMin(bins, int(std::ceil((column + 1) * binsPerPixel)));
+            float top = db[k];
+            for (++k; k < end; ++k)
+                top = std::max(top, db[k]);
+            points.append(QPointF(plot.left() + column + 0.5, mapY(top)));
+        }
+    }
+    p.save();
+    p.setClipRect(plot);
+    p.setRenderHint(QPainter::Antialiasing, true);
+    p.setPen(QPen(m_color, 1.5));
+    p.drawPolyline(points.constData(), int(points.size()));
+    p.restore();
+
+    // Peak markers, numbered strongest first, and their readout
+    const QColor markerColor(255, 152, 0);
+    p.setRenderHint(QPainter::Antialiasing, true);
+    int legendY = 15;
+    for (int i = 0; i < s.peaks.size(); ++i) {
+        const SpectrumAnalyzer::Peak &peak = s.peaks.at(i);
+        const QPointF tip(mapX(peak.bin), mapY(peak.db));
+        const QPointF marker[3] = {tip, tip + QPointF(-4, -7), tip + QPointF(4, -7)};
+        p.setPen(markerColor);
+        p.setBrush(markerColor);
+        p.drawPolygon(marker, 3);
+        p.drawText(tip + QPointF(-3, -10), QString::number(i + 1));
+
+        const QString text = QString("%1: %2  %3 dB").arg(i + 1).arg(frequencyText(peak.bin))
+                                 .arg(double(peak.db), 0, 'f', 1);
+        p.drawText(width() - 10 - p.fontMetrics().horizontalAdvance(text), legendY, text);
+        legendY += 15;
+    }
+    p.setBrush(Qt::NoBrush);
+
+    p.setPen(QColor(136, 136, 136));
+    p.drawText(plot.left() + 5, 15, QString("FFT %1, avg %2").arg(s.size).arg(s.averaged));
+}
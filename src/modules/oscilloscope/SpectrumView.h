@@ -0,0 +1,65 @@
+/**
+ * @file SpectrumView.h
+ * @brief Spectrum panel of the oscilloscope.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * Draws the latest SpectrumAnalyzer result as dB over frequency, in Hz
+ * when the sample rate is known and in cycles per sample otherwise. With
+ * more bins than pixel columns each column shows the strongest of its bins,
+ * so narrow tones never vanish. The peaks found by the analyzer are marked
+ * and labelled. Repaints are capped like the PlotArea's.
+ */
+
+#ifndef SPECTRUMVIEW_H
+#define SPECTRUMVIEW_H
+
+#include <QWidget>
+#include <QColor>
+#include <QElapsedTimer>
+#include <QTimer>
+
+#include "SpectrumAnalyzer.h"
+
+class SpectrumView : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit SpectrumView(QWidget *parent = nullptr);
+
+    void setSpectrum(const SpectrumAnalyzer::Spectrum &spectrum);
+
+    /**
+     * @brief Labels the frequency axis.
+     * @param hz Samples per second of the channel; 0 for cycles per sample
+     */
+    void setSampleRate(double hz);
+
+    void setColor(const QColor &color);
+    void setMaxFps(int fps);
+    void clear();
+
+protected:
+    void paintEvent(QPaintEvent *) override;
+
+private:
+    SpectrumAnalyzer::Spectrum m_spectrum;
+    double m_sampleRate = 0.0;
+    QColor m_color = QColor(76, 175, 80);
+    double m_topDb = 0.0;           ///< dB at the top edge; follows the peaks in 10 dB steps
+
+    QTimer m_frameTimer;
+    QElapsedTimer m_sinceFrame;
+    int m_frameIntervalMs = 33;
+
+    void scheduleRepaint();
+    void updateRange();
+    QString frequencyText(double bin) const;
+};
+
+#endif // SPECTRUMVIEW_H
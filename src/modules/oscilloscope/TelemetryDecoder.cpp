@@ -0,0 +1,341 @@
+/**
+ * @file TelemetryDecoder.cpp
+ * @brief Implementation of the oscilloscope telemetry decoder thread.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "TelemetryDecoder.h"
+
+#include <QMutexLocker>
+#include <QtEndian>
+
+#include <cstring>
+
+namespace {
+
+const int MAX_IDLE_WAIT_MS = 100;
+
+/**
+ * @brief Decodes one field of every frame: out[i] = field(frame i) * scale + bias.
+ */
+template <typename T, bool BigEndian>
+void decodeField(const uchar *base, const int *starts, int count, int offset,
+                 double scale, double bias, float *out)
+{
+    for (int i = 0; i < count; ++i) {
+        const uchar *src = base + starts[i] + offset;
+        const T raw = BigEndian ? qFromBigEndian<T>(src) : qFromLittleEndian<T>(src);
+        out[i] = float(double(raw) * scale + bias);
+    }
+}
+
+template <typename T>
+void decodeField(bool bigEndian, const uchar *base, const int *starts, int count, int offset,
+                 double scale, double bias, float *out)
+{
+    if (bigEndian)
+        decodeField<T, true>(base, starts, count, offset, scale, bias, out);
+    else
+        decodeField<T, false>(base, starts, count, offset, scale, bias, out);
+}
+
+} // namespace
+
+TelemetryDecoder::TelemetryDecoder(QObject *parent) : QThread(parent)
+{
+    setLayout(ChannelLayout::rawBytes());
+    start(QThread::HighPriority);
+}
+
+TelemetryDecoder::~TelemetryDecoder()
+{
+    m_stop.store(true);
+    m_wakeup.release();
+    wait();
+}
+
+int TelemetryDecoder::setLayout(const ChannelLayout &layout)
+{
+    QMutexLocker lock(&m_layoutMutex);
+    m_nextLayout = layout;
+    if (layout.format == ChannelLayout::RawBytes)
+        m_source.store(AnySource);
+    else
+        m_source.store(layout.fromTx ? TxSource : RxSource);
+    resetStats();
+    const int generation = m_generation.fetch_add(1) + 1;
+    m_wakeup.release();
+    return generation;
+}
+
+int TelemetryDecoder::reset()
+{
+    QMutexLocker lock(&m_layoutMutex);
+    resetStats();
+    const int generation = m_generation.fetch_add(1) + 1;
+    m_wakeup.release();
+    return generation;
+}
+
+void TelemetryDecoder::setTrigger(const ScopeTrigger::Settings &settings)
+{
+    QMutexLocker lock(&m_layoutMutex);
+    m_nextTrigger = settings;
+    m_triggerGeneration.fetch_add(1);
+    m_wakeup.release();
+}
+
+bool TelemetryDecoder::push(bool isTx, const QByteArray &data)
+{
+    const int source = m_source.load(std::memory_order_relaxed);
+    if (data.isEmpty() || (source == RxSource && isTx) || (source == TxSource && !isTx))
+        return true;
+
+    Chunk chunk;
+    chunk.data = data;
+    chunk.isTx = isTx;
+    if (!m_input.push(std::move(chunk))) {
+        m_droppedChunks.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    if (m_sleeping.exchange(false))
+        m_wakeup.release();
+    return true;
+}
+
+bool TelemetryDecoder::takeBlock(Block &block)
+{
+    if (m_output.pop(block))
+        return true;
+
+    // Re-arm the signal, then look once more: a block published just before
+    // the flag was cleared did not emit and would otherwise wait
+    m_notified.store(false);
+    if (!m_output.pop(block))
+        return false;
+    m_notified.store(true);
+    return true;
+}
+
+void TelemetryDecoder::resetStats()
+{
+    m_frames.store(0);
+    m_skippedBytes.store(0);
+    m_badLines.store(0);
+    m_droppedChunks.store(0);
+}
+
+TelemetryDecoder::Stats TelemetryDecoder::stats() const
+{
+    Stats s;
+    s.frames = m_frames.load(std::memory_order_relaxed);
+    s.skippedBytes = m_skippedBytes.load(std::memory_order_relaxed);
+    s.badLines = m_badLines.load(std::memory_order_relaxed);
+    s.droppedChunks = m_droppedChunks.load(std::memory_order_relaxed);
+    return s;
+}
+
+// --- Decoder thread ---
+
+void TelemetryDecoder::run()
+{
+    Chunk chunk;
+    while (!m_stop.load()) {
+        if (m_generation.load() != m_appliedGeneration)
+            applyLayout();
+        if (m_triggerGeneration.load() != m_appliedTrigger)
+            applyTrigger();
+
+        Block block;
+        block.generation = m_appliedGeneration;
+        block.channels.resize(m_layout.channels.size());
+
+        const bool raw = m_layout.format == ChannelLayout::RawBytes;
+        const int triggerChannel = m_trigger.settings().channel;
+        int chunks = 0;
+        while (chunks < MAX_BATCH_CHUNKS && m_input.pop(chunk)) {
+            ++chunks;
+            // Raw channel 0 is RX, 1 is TX; a layout decodes one direction only
+            const bool decodes = raw || chunk.isTx == m_layout.fromTx;
+            if (decodes && m_trigger.wantsBytes() && (!raw || chunk.isTx == (triggerChannel == 1))) {
+                const quint64 next = m_trigger.sampleCount() + quint64(block.channels.at(triggerChannel).size());
+                m_trigger.scanBytes(chunk.data, next, raw);
+            }
+            if (raw)
+                decodeRaw(chunk, block);
+            else if (decodes)
+                m_layout.format == ChannelLayout::Binary ? decodeBinary(chunk.data, block)
+                                                         : decodeCsv(chunk.data, block);
+            chunk.data = QByteArray();
+        }
+
+        m_trigger.process(block.channels, block.captures);
+        m_triggerState.store(m_trigger.state(), std::memory_order_relaxed);
+
+        bool decoded = !block.captures.isEmpty();
+        for (const QVector<float> &samples : qAsConst(block.channels))
+            decoded |= !samples.isEmpty();
+        // A full output queue means the GUI is far behind; drop rather than stall
+        if (decoded && m_output.push(std::move(block)) && !m_notified.exchange(true))
+            emit samplesReady();
+
+        if (chunks > 0)
+            continue;
+        m_sleeping.store(true);
+        if (m_input.isEmpty() && !m_stop.load() && m_generation.load() == m_appliedGeneration
+            && m_triggerGeneration.load() == m_appliedTrigger)
+            m_wakeup.tryAcquire(1, MAX_IDLE_WAIT_MS);
+        m_sleeping.store(false);
+    }
+}
+
+void TelemetryDecoder::applyLayout()
+{
+    QMutexLocker lock(&m_layoutMutex);
+    m_layout = m_nextLayout;
+    m_appliedGeneration = m_generation.load();
+    m_pending.clear();
+    m_appliedTrigger = -1;          // The trigger's channels changed as well
+}
+
+void TelemetryDecoder::applyTrigger()
+{
+    QMutexLocker lock(&m_layoutMutex);
+    m_appliedTrigger = m_triggerGeneration.load();
+    m_trigger.configure(m_nextTrigger, int(m_layout.channels.size()),
+                        m_layout.format != ChannelLayout::RawBytes);
+    m_triggerState.store(m_trigger.state(), std::memory_order_relaxed);
+}
+
+void TelemetryDecoder::decodeRaw(const Chunk &chunk, Block &block)
+{
+    QVector<float> &out = block.channels[chunk.isTx ? 1 : 0];
+    const qsizetype first = out.size();
+    out.resize(first + chunk.data.size());
+    const uchar *src = reinterpret_cast<const uchar *>(chunk.data.constData());
+    float *dst = out.data() + first;
+    for (qsizetype i = 0; i < chunk.data.size(); ++i)
+        dst[i] = float(src[i]);
+}
+
+void TelemetryDecoder::decodeBinary(const QByteArray &data, Block &block)
+{
+    m_pending.append(data);
+    const uchar *base = reinterpret_cast<const uchar *>(m_pending.constData());
+    const int size = int(m_pending.size());
+    const int length = m_layout.frameLength;
+    const QByteArray &sync = m_layout.sync;
+
+    // Pass 1: locate the frames
+    m_starts.clear();
+    int pos = 0;
+    quint64 skipped = 0;
+    while (pos + length <= size) {
+        if (sync.isEmpty() || std::memcmp(base + pos, sync.constData(), size_t(sync.size())) == 0) {
+            m_starts.append(pos);
+            pos += length;
+            continue;
+        }
+        // Lost sync: skip to the next candidate; one may start in the last sync.size() - 1 bytes
+        int next = int(m_pending.indexOf(sync, pos + 1));
+        if (next < 0)
+            next = size - int(sync.size()) + 1;
+        skipped += quint64(next - pos);
+        pos = next;
+    }
+
+    // Pass 2: one type-specialised loop per field over all frames
+    const int count = int(m_starts.size());
+    if (count > 0) {
+        for (int c = 0; c < m_layout.channels.size(); ++c) {
+            const ChannelLayout::Channel &ch = m_layout.channels.at(c);
+            QVector<float> &out = block.channels[c];
+            const qsizetype first = out.size();
+            out.resize(first + count);
+            float *dst = out.data() + first;
+            const int *starts = m_starts.constData();
+            switch (ch.type) {
+            case ChannelLayout::Int8:
+                decodeField<qint8>(ch.bigEndian, base, starts, count, ch.offset, ch.scale, ch.bias, dst);
+                break;
+            case ChannelLayout::UInt8:
+                decodeField<quint8>(ch.bigEndian, base, starts, count, ch.offset, ch.scale, ch.bias, dst);
+                break;
+            case ChannelLayout::Int16:
+                decodeField<qint16>(ch.bigEndian, base, starts, count, ch.offset, ch.scale, ch.bias, dst);
+                break;
+            case ChannelLayout::UInt16:
+                decodeField<quint16>(ch.bigEndian, base, starts, count, ch.offset, ch.scale, ch.bias, dst);
+                break;
+            case ChannelLayout::Int32:
+                decodeField<qint32>(ch.bigEndian, base, starts, count, ch.offset, ch.scale, ch.bias, dst);
+                break;
+            case ChannelLayout::UInt32:
+                decodeField<quint32>(ch.bigEndian, base, starts, count, ch.offset, ch.scale, ch.bias, dst);
+                break;
+            case ChannelLayout::Float32:
+                decodeField<float>(ch.bigEndian, base, starts, count, ch.offset, ch.scale, ch.bias, dst);
+                break;
+            case ChannelLayout::Float64:
+                decodeField<double>(ch.bigEndian, base, starts, count, ch.offset, ch.scale, ch.bias, dst);
+                break;
+            }
+        }
+    }
+
+    m_pending.remove(0, pos);
+    m_frames.fetch_add(quint64(count), std::memory_order_relaxed);
+    if (skipped)
+        m_skippedBytes.fetch_add(skipped, std::memory_order_relaxed);
+}
+
+void TelemetryDecoder::decodeCsv(const QByteArray &data, Block &block)
+{
+    m_pending.append(data);
+
+    quint64 frames = 0;
+    quint64 bad = 0;
+    QVector<double> values(m_layout.channels.size());
+    qsizetype start = 0;
+    for (;;) {
+        const qsizetype end = m_pending.indexOf('\n', start);
+        if (end < 0)
+            break;
+        QByteArray line = m_pending.mid(start, end - start);
+        start = end + 1;
+        if (line.endsWith('\r'))
+            line.chop(1);
+        if (line.trimmed().isEmpty())
+            continue;
+
+        // Only whole lines are plotted so the channels stay aligned
+        const QList<QByteArray> columns = line.split(m_layout.separator);
+        bool ok = true;
+        for (int c = 0; ok && c < m_layout.channels.size(); ++c) {
+            const ChannelLayout::Channel &ch = m_layout.channels.at(c);
+            ok = ch.offset < columns.size();
+            if (ok)
+                values[c] = columns.at(ch.offset).trimmed().toDouble(&ok) * ch.scale + ch.bias;
+        }
+        if (!ok) {
+            ++bad;
+            continue;
+        }
+        for (int c = 0; c < m_layout.channels.size(); ++c)
+            block.channels[c].append(float(values[c]));
+        ++frames;
+    }
+
+    m_pending.remove(0, start);
+    if (m_pending.size() > MAX_PENDING) {
+        m_pending.clear();
+        ++bad;
+    }
+    m_frames.fetch_add(frames, std::memory_order_relaxed);
+    if (bad)
+        m_badLines.fetch_add(bad, std::memory_order_relaxed);
+}
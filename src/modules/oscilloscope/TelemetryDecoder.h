@@ -0,0 +1,163 @@
+/**
+ * @file TelemetryDecoder.h
+ * @brief Background thread that decodes the byte stream into channel samples.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * The GUI thread only pushes received chunks into a lock-free queue. The
+ * decoder thread cuts them into frames according to the ChannelLayout and
+ * decodes one field at a time across all frames of a batch, in a tight loop
+ * specialised for the field's type and byte order, which the compiler can
+ * vectorise. Decoded samples come back through a second queue as one Block
+ * per batch; samplesReady() is emitted only when the GUI has drained the
+ * previous blocks, so a fast stream cannot flood the event loop.
+ *
+ * Every setLayout() or reset() starts a new generation; blocks carry the
+ * generation they were decoded with so the consumer can drop stale ones.
+ *
+ * The ScopeTrigger is evaluated here as well, on every decoded sample, and
+ * its captures travel with the block that completed them.
+ */
+
+#ifndef TELEMETRYDECODER_H
+#define TELEMETRYDECODER_H
+
+#include <QThread>
+#include <QByteArray>
+#include <QMutex>
+#include <QSemaphore>
+#include <QVector>
+
+#include <atomic>
+
+#include "ChannelLayout.h"
+#include "ScopeTrigger.h"
+#include "SpscQueue.h"
+
+class TelemetryDecoder : public QThread
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Samples decoded from one batch of chunks.
+     */
+    struct Block {
+        int generation = 0;
+        QVector<QVector<float>> channels;   ///< New samples per layout channel, oldest first
+        QList<ScopeTrigger::Capture> captures;  ///< Trigger captures completed by this batch
+    };
+
+    struct Stats {
+        quint64 frames = 0;         ///< Binary frames or CSV lines decoded
+        quint64 skippedBytes = 0;   ///< Bytes discarded while looking for the sync
+        quint64 badLines = 0;       ///< CSV lines with a missing or non-numeric column
+        quint64 droppedChunks = 0;  ///< Chunks lost because the input queue was full
+    };
+
+    explicit TelemetryDecoder(QObject *parent = nullptr);
+    ~TelemetryDecoder() override;
+
+    /**
+     * @brief Installs a layout; partial frames of the previous one are dropped.
+     * @return Generation of the blocks decoded with @p layout
+     */
+    int setLayout(const ChannelLayout &layout);
+
+    /**
+     * @brief Drops partial frames and starts a new generation with the same layout.
+     *
+     * Like setLayout(), this also zeroes the statistics.
+     */
+    int reset();
+
+    /**
+     * @brief Queues a chunk for decoding. Producer side; GUI thread only.
+     * @return false if the queue was full and the chunk was dropped
+     */
+    bool push(bool isTx, const QByteArray &data);
+
+    /**
+     * @brief Replaces the trigger settings and re-arms the trigger.
+     *
+     * Also used to re-arm a Single capture. An invalid byte pattern leaves
+     * the trigger idle; check it with TriggerMatcher::validatePattern().
+     */
+    void setTrigger(const ScopeTrigger::Settings &settings);
+
+    ScopeTrigger::State triggerState() const
+    {
+        return ScopeTrigger::State(m_triggerState.load(std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Takes the next decoded block. Consumer side; GUI thread only.
+     *
+     * Call until it returns false; samplesReady() is emitted again once
+     * new blocks arrive after that.
+     */
+    bool takeBlock(Block &block);
+
+    Stats stats() const;
+
+signals:
+    /**
+     * @brief Decoded blocks are waiting in takeBlock().
+     */
+    void samplesReady();
+
+protected:
+    void run() override;
+
+private:
+    struct Chunk {
+        QByteArray data;
+        bool isTx = false;
+    };
+
+    /// Source filter for push(): both directions, RX only or TX only
+    enum Source { AnySource, RxSource, TxSource };
+
+    static const int MAX_BATCH_CHUNKS = 64;
+    static const int MAX_PENDING = 64 * 1024;   ///< Longest unterminated CSV line kept
+
+    void applyLayout();
+    void applyTrigger();
+    void resetStats();
+    void decodeRaw(const Chunk &chunk, Block &block);
+    void decodeBinary(const QByteArray &data, Block &block);
+    void decodeCsv(const QByteArray &data, Block &block);
+
+    // Shared between threads
+    SpscQueue<Chunk> m_input{4096};
+    SpscQueue<Block> m_output{1024};
+    QSemaphore m_wakeup;
+    std::atomic<bool> m_sleeping{false};
+    std::atomic<bool> m_stop{false};
+    std::atomic<bool> m_notified{false};
+    std::atomic<int> m_generation{0};
+    std::atomic<int> m_source{AnySource};
+    std::atomic<quint64> m_frames{0};
+    std::atomic<quint64> m_skippedBytes{0};
+    std::atomic<quint64> m_badLines{0};
+    std::atomic<quint64> m_droppedChunks{0};
+    std::atomic<int> m_triggerGeneration{0};
+    std::atomic<int> m_triggerState{ScopeTrigger::Idle};
+    QMutex m_layoutMutex;           ///< Guards m_nextLayout and m_nextTrigger
+    ChannelLayout m_nextLayout;
+    ScopeTrigger::Settings m_nextTrigger;
+
+    // Decoder thread only
+    ChannelLayout m_layout;
+    int m_appliedGeneration = -1;
+    int m_appliedTrigger = -1;
+    ScopeTrigger m_trigger;
+    QByteArray m_pending;           ///< Bytes of an incomplete frame or line
+    QVector<int> m_starts;          ///< Frame offsets in m_pending of the current batch
+};
+
+#endif // TELEMETRYDECODER_H
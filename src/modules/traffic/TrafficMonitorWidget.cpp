@@ -1,13 +1,18 @@
 #include "TrafficMonitorWidget.h"
 #include "ui_TrafficMonitorWidget.h"
+#include "LogWriter.h"
+#include "Paths.h"
 #include <QFileDialog>
+#include <QFileInfo>
 #include <QTextStream>
 #include <QMessageBox>
 #include <QDateTime>
+#include <QPushButton>
 
 TrafficMonitorWidget::TrafficMonitorWidget(QWidget *parent) :
     QWidget(parent),
-    ui(new Ui::TrafficMonitorWidget)
+    ui(new Ui::TrafficMonitorWidget),
+    m_recorder(new LogWriter(this))
 {
     ui->setupUi(this);
     
@@ -15,18 +20,53 @@ TrafficMonitorWidget::TrafficMonitorWidget(QWidget *parent) :
     ui->tableLog->setColumnWidth(1, 50);
     ui->tableLog->setColumnWidth(2, 300);
     ui->tableLog->horizontalHeader()->setStretchLastSection(true);
+
+    m_btnRecord = new QPushButton("Record pcapng", this);
+    m_btnRecord->setCheckable(true);
+    m_btnRecord->setToolTip("Stream all traffic to a pcapng file in the Logs folder "
+                            "(one interface per tab, readable in Wireshark while recording)");
+    ui->horizontalLayout->addWidget(m_btnRecord);
+    connect(m_btnRecord, &QPushButton::toggled, this, &TrafficMonitorWidget::onRecordToggled);
+
+    connect(m_recorder, &LogWriter::statsChanged, this, &TrafficMonitorWidget::updateRecordStatus);
+    connect(m_recorder, &LogWriter::fileRotated, this, &TrafficMonitorWidget::updateRecordStatus);
+    connect(m_recorder, &LogWriter::writeFailed, this, [this](const QString &message) {
+        QMessageBox::warning(this, "Recording Error", message);
+    });
 }
 
 TrafficMonitorWidget::~TrafficMonitorWidget()
 {
+    m_recorder->close();
     delete ui;
 }
 
-void TrafficMonitorWidget::appendData(bool isTx, const QByteArray &data)
+void TrafficMonitorWidget::appendData(bool isTx, const QByteArray &data, qint64 timestampNs)
 {
+    if (timestampNs == 0)
+        timestampNs = LogWriter::currentTimestampNs();
+
+    // Recording is independent of the on-screen capture and never touches m_logs
+    if (m_recorder->isOpen()) {
+        const QObject *source = sender();
+        auto it = m_interfaceIds.constFind(source);
+        if (it == m_interfaceIds.constEnd()) {
+            QString name = (source && !source->objectName().isEmpty())
+                               ? source->objectName()
+                               : QString("Interface %1").arg(m_interfaceIds.size() + 1);
+            it = m_interfaceIds.insert(source, m_recorder->addInterface(name));
+            // A tab allocated later at the same address must get its own interface
+            if (source) {
+                connect(source, &QObject::destroyed, this,
+                        [this, source]() { m_interfaceIds.remove(source); });
+            }
+        }
+        m_recorder->append(isTx, data, timestampNs, it.value());
+    }
+
     if (!ui->chkCapture->isChecked()) return;
 
-    QString timeStr = QTime::currentTime().toString("HH:mm:ss.zzz");
+    QString timeStr = QDateTime::fromMSecsSinceEpoch(timestampNs / 1000000).toString("HH:mm:ss.zzz");
     QString dirStr = isTx ? "TX" : "RX";
     QString hexStr = data.toHex(' ').toUpper();
     QString asciiStr = QString::fromLatin1(data);
@@ -45,7 +85,7 @@ void TrafficMonitorWidget::appendData(bool isTx, const QByteArray &data)
     ui->tableLog->scrollToBottom();
     
     // Store for export
-    m_logs.append({timeStr, isTx, data});
+    m_logs.append({timeStr, isTx, data, timestampNs});
 }
 
 void TrafficMonitorWidget::on_btnClear_clicked()
@@ -113,9 +153,8 @@ void TrafficMonitorWidget::on_btnExportPcap_clicked()
         pcapPayload.append(log.isTx ? (char)0x01 : (char)0x00);
         pcapPayload.append(payload);
         
-        // qint64 ms = QTime::currentTime().msecsSinceStartOfDay(); // Approximate relative time
-        // Better: use current time
-        qint64 epoch = QDateTime::currentMSecsSinceEpoch();
+        // Original capture time of the packet
+        qint64 epochUs = log.timestampNs / 1000;
         
         struct pcaprec_hdr_t {
             quint32 ts_sec;
@@ -124,8 +163,8 @@ void TrafficMonitorWidget::on_btnExportPcap_clicked()
             quint32 orig_len;
         } pkt_hdr;
         
-        pkt_hdr.ts_sec = epoch / 1000;
-        pkt_hdr.ts_usec = (epoch % 1000) * 1000;
+        pkt_hdr.ts_sec = epochUs / 1000000;
+        pkt_hdr.ts_usec = epochUs % 1000000;
         pkt_hdr.incl_len = pcapPayload.size();
         pkt_hdr.orig_len = pcapPayload.size();
         
@@ -133,3 +172,33 @@ void TrafficMonitorWidget::on_btnExportPcap_clicked()
         file.write(pcapPayload);
     }
 }
+
+void TrafficMonitorWidget::onRecordToggled(bool checked)
+{
+    if (!checked) {
+        m_recorder->close();
+        m_btnRecord->setText("Record pcapng");
+        return;
+    }
+
+    m_interfaceIds.clear();
+    if (!m_recorder->open(LOG_FOLDER_PATH, LogWriter::Pcapng, LogWriter::Settings::load(),
+                          "Capture")) {
+        m_btnRecord->setChecked(false);
+        return;
+    }
+    updateRecordStatus();
+}
+
+void TrafficMonitorWidget::updateRecordStatus()
+{
+    if (!m_recorder->isOpen())
+        return;
+
+    QString name = QFileInfo(m_recorder->currentFileName()).fileName();
+    m_btnRecord->setText(QString("Recording %1").arg(name));
+    m_btnRecord->setToolTip(QString("%1\n%2 packets written, %3 dropped")
+                                .arg(m_recorder->currentFileName())
+                                .arg(m_recorder->writtenCount())
+                                .arg(m_recorder->droppedCount()));
+}
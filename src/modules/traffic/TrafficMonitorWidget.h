@@ -13,6 +13,10 @@
 
 #include <QWidget>
 #include <QTime>
+#include <QHash>
+
+class QPushButton;
+class LogWriter;
 
 namespace Ui {
 class TrafficMonitorWidget;
@@ -27,13 +31,25 @@ public:
     ~TrafficMonitorWidget();
 
 public slots:
-    void appendData(bool isTx, const QByteArray &data);
+    /**
+     * @brief Adds a packet to the table and, while recording, to the pcapng file.
+     * @param timestampNs Original capture time (ns since epoch); 0 = now.
+     *
+     * The sending object (one per tab) becomes its own pcapng interface.
+     */
+    void appendData(bool isTx, const QByteArray &data, qint64 timestampNs = 0);
 
 private slots:
     void on_btnClear_clicked();
     void on_btnExportTxt_clicked();
     void on_btnExportPcap_clicked();
 
+    /**
+     * @brief Starts/stops streaming every packet to a pcapng file on disk.
+     */
+    void onRecordToggled(bool checked);
+    void updateRecordStatus();
+
 private:
     Ui::TrafficMonitorWidget *ui;
     
@@ -42,8 +58,14 @@ private:
         QString time;
         bool isTx;
         QByteArray data;
+        qint64 timestampNs;
     };
     QList<LogEntry> m_logs;
+
+    // --- Live pcapng recording ---
+    QPushButton *m_btnRecord;
+    LogWriter *m_recorder;
+    QHash<const QObject *, int> m_interfaceIds;  ///< Live sender (tab) -> pcapng interface id
 };
 
 #endif // TRAFFICMONITORWIDGET_H
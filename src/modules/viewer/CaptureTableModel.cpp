@@ -0,0 +1,193 @@
+/**
+ * @file CaptureTableModel.cpp
+ * @brief Implementation of the lazily decoded capture table model.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "CaptureTableModel.h"
+#include "CaptureIndexer.h"
+#include "DataFormat.h"
+
+#include <QDateTime>
+#include <QTime>
+
+#include <climits>
+
+static const int PREVIEW_BYTES = 32;
+static const int CACHED_BLOCKS = 64;   // 16384 decoded rows
+
+CaptureTableModel::CaptureTableModel(QObject *parent)
+    : QAbstractTableModel(parent), m_blocks(CACHED_BLOCKS)
+{
+}
+
+void CaptureTableModel::setFile(const CaptureFile *file)
+{
+    beginResetModel();
+    m_file = file;
+    m_checkpoints.clear();
+    m_frameCount = 0;
+    m_interfaceNames.clear();
+    m_blocks.clear();
+    endResetModel();
+}
+
+void CaptureTableModel::appendCheckpoints(const QVector<qint64> &offsets, qint64 frameCount)
+{
+    m_checkpoints += offsets;
+    if (m_file)
+        m_interfaceNames = m_file->interfaceNames();
+
+    // QAbstractItemModel rows are int; beyond that the tail is simply not shown
+    const qint64 oldRows = qMin<qint64>(m_frameCount, INT_MAX);
+    const qint64 newRows = qMin<qint64>(frameCount, INT_MAX);
+    m_frameCount = frameCount;
+
+    if (newRows > oldRows) {
+        // The last cached block may have been decoded before it was complete
+        m_blocks.remove(int(oldRows / CaptureIndexer::STRIDE));
+        beginInsertRows(QModelIndex(), int(oldRows), int(newRows - 1));
+        endInsertRows();
+    }
+}
+
+bool CaptureTableModel::seekToRow(int row, qint64 &offset) const
+{
+    const int checkpoint = row / CaptureIndexer::STRIDE;
+    if (!m_file || checkpoint >= m_checkpoints.size())
+        return false;
+
+    offset = m_checkpoints.at(checkpoint);
+    CaptureFile::Frame skipped;
+    for (int i = checkpoint * CaptureIndexer::STRIDE; i < row; ++i) {
+        if (!m_file->readFrame(offset, skipped, false))
+            return false;
+    }
+    return true;
+}
+
+bool CaptureTableModel::frameAt(int row, CaptureFile::Frame &frame) const
+{
+    qint64 offset = 0;
+    return seekToRow(row, offset) && m_file->readFrame(offset, frame, true);
+}
+
+const QVector<CaptureTableModel::Row> *CaptureTableModel::block(int blockIndex) const
+{
+    if (QVector<Row> *cached = m_blocks.object(blockIndex))
+        return cached;
+
+    if (!m_file || blockIndex >= m_checkpoints.size())
+        return nullptr;
+
+    QVector<Row> *rows = new QVector<Row>();
+    rows->reserve(CaptureIndexer::STRIDE);
+
+    qint64 offset = m_checkpoints.at(blockIndex);
+    CaptureFile::Frame frame;
+    for (int i = 0; i < CaptureIndexer::STRIDE; ++i) {
+        if (!m_file->readFrame(offset, frame, true))
+            break;
+        Row row;
+        row.offset = frame.offset;
+        row.timestampNs = frame.timestampNs;
+        row.length = frame.data.size();
+        row.interfaceId = frame.interfaceId;
+        row.isTx = frame.isTx;
+        row.hasDirection = frame.hasDirection;
+        row.preview = frame.data.left(PREVIEW_BYTES);
+        rows->append(row);
+    }
+
+    m_blocks.insert(blockIndex, rows);
+    return rows;
+}
+
+QString CaptureTableModel::formatTime(qint64 timestampNs) const
+{
+    const qint64 ms = timestampNs / 1000000;
+    const QString micros = QString("%1").arg((timestampNs / 1000) % 1000, 3, 10, QChar('0'));
+
+    // Native text logs only store the time of day
+    if (m_file && m_file->format() == CaptureFile::NativeText)
+        return QTime::fromMSecsSinceStartOfDay(int(ms % 86400000)).toString("HH:mm:ss.zzz");
+
+    return QDateTime::fromMSecsSinceEpoch(ms).toString("yyyy-MM-dd HH:mm:ss.zzz") + micros;
+}
+
+int CaptureTableModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid())
+        return 0;
+    return int(qMin<qint64>(m_frameCount, INT_MAX));
+}
+
+int CaptureTableModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QVariant CaptureTableModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid())
+        return QVariant();
+
+    if (role == Qt::TextAlignmentRole) {
+        if (index.column() == ColNumber || index.column() == ColLength)
+            return int(Qt::AlignRight | Qt::AlignVCenter);
+        return QVariant();
+    }
+    if (role != Qt::DisplayRole)
+        return QVariant();
+
+    if (index.column() == ColNumber)
+        return index.row() + 1;
+
+    const QVector<Row> *rows = block(index.row() / CaptureIndexer::STRIDE);
+    const int inBlock = index.row() % CaptureIndexer::STRIDE;
+    if (!rows || inBlock >= rows->size())
+        return QVariant();
+    const Row &row = rows->at(inBlock);
+
+    switch (index.column()) {
+    case ColTime:
+        return formatTime(row.timestampNs);
+    case ColInterface:
+        return row.interfaceId < m_interfaceNames.size() ? m_interfaceNames.at(row.interfaceId)
+                                                         : QString::number(row.interfaceId);
+    case ColDirection:
+        return row.hasDirection ? QString(row.isTx ? "TX" : "RX") : QString("-");
+    case ColLength:
+        return row.length;
+    case ColData: {
+        QByteArray hex;
+        hex.reserve(PREVIEW_BYTES * 3 + 4);
+        DataFormat::appendHex(hex, row.preview);
+        if (row.length > row.preview.size())
+            hex.append(" ...");
+        return QString::fromLatin1(hex);
+    }
+    default:
+        return QVariant();
+    }
+}
+
+QVariant CaptureTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+        return QAbstractTableModel::headerData(section, orientation, role);
+
+    switch (section) {
+    case ColNumber:    return "No.";
+    case ColTime:      return "Time";
+    case ColInterface: return "Interface";
+    case ColDirection: return "Dir";
+    case ColLength:    return "Length";
+    case ColData:      return "Data (HEX)";
+    default:           return QVariant();
+    }
+}
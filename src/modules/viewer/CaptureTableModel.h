@@ -0,0 +1,87 @@
+/**
+ * @file CaptureTableModel.h
+ * @brief Lazily decoded table model over a memory-mapped capture.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * Rows are never materialised up front. The model holds only the sparse
+ * checkpoint list from CaptureIndexer; when the view asks for a row, the
+ * block of CaptureIndexer::STRIDE frames containing it is decoded from the
+ * mapping and kept in a small LRU cache. Scrolling and jumping therefore
+ * touch only the pages of the file that are on screen.
+ */
+
+#ifndef CAPTURETABLEMODEL_H
+#define CAPTURETABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QCache>
+#include <QStringList>
+#include <QVector>
+
+#include "CaptureFile.h"
+
+class CaptureTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Column {
+        ColNumber,
+        ColTime,
+        ColInterface,
+        ColDirection,
+        ColLength,
+        ColData,
+        ColumnCount
+    };
+
+    explicit CaptureTableModel(QObject *parent = nullptr);
+
+    /**
+     * @brief Attaches a newly opened file (nullptr to detach) and removes all rows.
+     */
+    void setFile(const CaptureFile *file);
+
+    /**
+     * @brief Adds rows for frames found by the indexer.
+     */
+    void appendCheckpoints(const QVector<qint64> &offsets, qint64 frameCount);
+
+    /**
+     * @brief Decodes frame @p row with its complete payload.
+     */
+    bool frameAt(int row, CaptureFile::Frame &frame) const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+private:
+    struct Row {
+        qint64 offset = 0;
+        qint64 timestampNs = 0;
+        int length = 0;
+        int interfaceId = 0;
+        bool isTx = false;
+        bool hasDirection = false;
+        QByteArray preview;     ///< First bytes of the payload only
+    };
+
+    const QVector<Row> *block(int blockIndex) const;
+    bool seekToRow(int row, qint64 &offset) const;
+    QString formatTime(qint64 timestampNs) const;
+
+    const CaptureFile *m_file = nullptr;
+    QVector<qint64> m_checkpoints;
+    qint64 m_frameCount = 0;
+    QStringList m_interfaceNames;
+    mutable QCache<int, QVector<Row>> m_blocks;
+};
+
+#endif // CAPTURETABLEMODEL_H
@@ -0,0 +1,168 @@
+/**
+ * @file CaptureViewerWidget.cpp
+ * @brief Implementation of the offline capture viewer.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "CaptureViewerWidget.h"
+#include "ui_CaptureViewerWidget.h"
+#include "CaptureIndexer.h"
+#include "CaptureTableModel.h"
+#include "HexViewWidget.h"
+#include "Paths.h"
+
+#include <QCoreApplication>
+#include <QFileDialog>
+#include <QFileInfo>
+#include <QHeaderView>
+#include <QItemSelectionModel>
+#include <QLocale>
+#include <QMessageBox>
+
+CaptureViewerWidget::CaptureViewerWidget(QWidget *parent) :
+    QWidget(parent),
+    ui(new Ui::CaptureViewerWidget),
+    m_indexer(new CaptureIndexer(this)),
+    m_model(new CaptureTableModel(this)),
+    m_hexView(new HexViewWidget(this))
+{
+    ui->setupUi(this);
+
+    ui->tableFrames->setModel(m_model);
+    // Fixed row heights keep the header O(1) for millions of rows
+    ui->tableFrames->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    ui->tableFrames->verticalHeader()->setDefaultSectionSize(ui->tableFrames->fontMetrics().height() + 6);
+    ui->tableFrames->verticalHeader()->hide();
+    ui->tableFrames->horizontalHeader()->setStretchLastSection(true);
+    ui->tableFrames->setColumnWidth(CaptureTableModel::ColNumber, 90);
+    ui->tableFrames->setColumnWidth(CaptureTableModel::ColTime, 200);
+    ui->tableFrames->setColumnWidth(CaptureTableModel::ColInterface, 110);
+    ui->tableFrames->setColumnWidth(CaptureTableModel::ColDirection, 40);
+    ui->tableFrames->setColumnWidth(CaptureTableModel::ColLength, 70);
+
+    ui->splitter->addWidget(m_hexView);
+    ui->splitter->setStretchFactor(0, 3);
+    ui->splitter->setStretchFactor(1, 1);
+
+    ui->spinFrame->setEnabled(false);
+    ui->btnGoto->setEnabled(false);
+
+    connect(m_indexer, &CaptureIndexer::checkpointsFound, this, &CaptureViewerWidget::onCheckpointsFound);
+    connect(m_indexer, &CaptureIndexer::indexingFinished, this, &CaptureViewerWidget::onIndexingFinished);
+    connect(ui->tableFrames->selectionModel(), &QItemSelectionModel::currentRowChanged,
+            this, &CaptureViewerWidget::onCurrentRowChanged);
+    connect(ui->spinFrame, &QSpinBox::editingFinished, this, &CaptureViewerWidget::on_btnGoto_clicked);
+}
+
+CaptureViewerWidget::~CaptureViewerWidget()
+{
+    closeFile();
+    delete ui;
+}
+
+bool CaptureViewerWidget::openFile(const QString &path)
+{
+    closeFile();
+
+    if (!m_file.open(path)) {
+        QMessageBox::warning(this, "Capture Viewer", m_file.errorString());
+        return false;
+    }
+
+    ui->lblFile->setText(QFileInfo(path).fileName());
+    ui->lblFile->setToolTip(path);
+    m_model->setFile(&m_file);
+    m_frameCount = 0;
+    m_indexTimer.start();
+    updateStatus(0, true);
+    m_indexer->startIndexing(&m_file);
+    return true;
+}
+
+void CaptureViewerWidget::closeFile()
+{
+    // The indexer and the model both read the mapping; detach them first.
+    // Batches from the cancelled scan may still be queued: drop them.
+    m_indexer->stop();
+    QCoreApplication::removePostedEvents(this, QEvent::MetaCall);
+    m_model->setFile(nullptr);
+    m_hexView->setData(QByteArray());
+    m_file.close();
+    m_frameCount = 0;
+    ui->spinFrame->setEnabled(false);
+    ui->btnGoto->setEnabled(false);
+}
+
+void CaptureViewerWidget::on_btnOpen_clicked()
+{
+    QString fileName = QFileDialog::getOpenFileName(this, "Open Capture", LOG_FOLDER_PATH,
+                                                    "Captures (*.pcapng *.pcap *.txt *.html);;All Files (*)");
+    if (!fileName.isEmpty())
+        openFile(fileName);
+}
+
+void CaptureViewerWidget::on_btnGoto_clicked()
+{
+    const int row = ui->spinFrame->value() - 1;
+    if (row < 0 || row >= m_model->rowCount())
+        return;
+
+    const QModelIndex index = m_model->index(row, 0);
+    ui->tableFrames->scrollTo(index, QAbstractItemView::PositionAtCenter);
+    ui->tableFrames->selectionModel()->setCurrentIndex(
+        index, QItemSelectionModel::ClearAndSelect | QItemSelectionModel::Rows);
+}
+
+void CaptureViewerWidget::onCheckpointsFound(const QVector<qint64> &offsets, qint64 frameCount, qint64 bytesScanned)
+{
+    m_model->appendCheckpoints(offsets, frameCount);
+    m_frameCount = frameCount;
+
+    if (m_model->rowCount() > 0) {
+        ui->spinFrame->setMaximum(m_model->rowCount());
+        ui->spinFrame->setEnabled(true);
+        ui->btnGoto->setEnabled(true);
+    }
+    updateStatus(bytesScanned, true);
+}
+
+void CaptureViewerWidget::onIndexingFinished(bool completed)
+{
+    updateStatus(completed ? m_file.size() : -1, false);
+}
+
+void CaptureViewerWidget::onCurrentRowChanged()
+{
+    const QModelIndex current = ui->tableFrames->selectionModel()->currentIndex();
+    CaptureFile::Frame frame;
+    if (current.isValid() && m_model->frameAt(current.row(), frame))
+        m_hexView->setData(frame.data);
+    else
+        m_hexView->setData(QByteArray());
+}
+
+void CaptureViewerWidget::updateStatus(qint64 bytesScanned, bool indexing)
+{
+    QLocale locale;
+    QString text = QString("%1 frames, %2")
+                       .arg(locale.toString(m_frameCount))
+                       .arg(locale.formattedDataSize(m_file.size()));
+
+    if (indexing) {
+        const int percent = m_file.size() > 0 ? int(bytesScanned * 100 / m_file.size()) : 0;
+        text += QString(" - indexing %1%").arg(percent);
+    } else if (bytesScanned < 0) {
+        text += " - indexing stopped";
+    } else {
+        text += QString(" - indexed in %1 ms").arg(m_indexTimer.elapsed());
+    }
+
+    if (m_frameCount > m_model->rowCount())
+        text += QString(" (first %1 shown)").arg(locale.toString(m_model->rowCount()));
+
+    ui->lblStatus->setText(text);
+}
@@ -0,0 +1,69 @@
+/**
+ * @file CaptureViewerWidget.h
+ * @brief Offline viewer for pcap, pcapng and PacketForge log files.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * The capture is memory-mapped and indexed on a background thread while
+ * the table is already usable; rows are decoded only when they scroll into
+ * view. Selecting a row shows its full payload in a hex view.
+ */
+
+#ifndef CAPTUREVIEWERWIDGET_H
+#define CAPTUREVIEWERWIDGET_H
+
+#include <QWidget>
+#include <QElapsedTimer>
+
+#include "CaptureFile.h"
+
+class CaptureIndexer;
+class CaptureTableModel;
+class HexViewWidget;
+
+namespace Ui {
+class CaptureViewerWidget;
+}
+
+class CaptureViewerWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit CaptureViewerWidget(QWidget *parent = nullptr);
+    ~CaptureViewerWidget();
+
+    /**
+     * @brief Maps @p path and starts indexing it.
+     * @return false if the file could not be opened (a message is shown).
+     */
+    bool openFile(const QString &path);
+
+private slots:
+    void on_btnOpen_clicked();
+    void on_btnGoto_clicked();
+
+    void onCheckpointsFound(const QVector<qint64> &offsets, qint64 frameCount, qint64 bytesScanned);
+    void onIndexingFinished(bool completed);
+    void onCurrentRowChanged();
+
+private:
+    void closeFile();
+    void updateStatus(qint64 bytesScanned, bool indexing);
+
+    Ui::CaptureViewerWidget *ui;
+
+    CaptureFile m_file;
+    CaptureIndexer *m_indexer;
+    CaptureTableModel *m_model;
+    HexViewWidget *m_hexView;
+
+    qint64 m_frameCount = 0;
+    QElapsedTimer m_indexTimer;
+};
+
+#endif // CAPTUREVIEWERWIDGET_H
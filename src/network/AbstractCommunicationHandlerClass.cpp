@@ -1,16 +1,23 @@
 #include "AbstractCommunicationHandlerClass.h"
+#include "RxResponder.h"
+#include "FrameValidator.h"
 
 #include "SerialQTClass.h"
 #include "TcpServer_SingleClientClass.h"
 #include "TcpClientClass.h"
 #include "UdpClass.h"
 
+#include <QTimer>
+
 AbstractCommunicationHandler::AbstractCommunicationHandler(QObject *parent)
     :QObject(parent),
     connection(false),
     receivingQueue(nullptr),
     dataReceivingRule(nullptr),
-    dataSendingRule(nullptr)
+    dataSendingRule(nullptr),
+    responder(nullptr),
+    frameValidator(nullptr),
+    frameGapTimer(nullptr)
 {}
 
 //AbstractCommunicationHandler::~AbstractCommunicationHandler(){}
@@ -19,6 +26,93 @@ void AbstractCommunicationHandler::setReceivingQueue(QQueue<QByteArray> *receivi
 void AbstractCommunicationHandler::setDataReceivingRule(DRR f){dataReceivingRule = f;}
 void AbstractCommunicationHandler::setDataSendingRule(DSR f){dataSendingRule = f;}
 bool AbstractCommunicationHandler::isConnected(){return connection;}
+void AbstractCommunicationHandler::setResponder(RxResponder *rxResponder){responder = rxResponder;}
+void AbstractCommunicationHandler::setFrameValidator(FrameValidator *validator){frameValidator = validator;}
+
+void AbstractCommunicationHandler::runResponder(const QByteArray &data, qint64 rxTimestampNs)
+{
+    if (!responder || !responder->isActive())
+        return;
+
+    responder->process(data, rxTimestampNs, this, [this](const QByteArray &response) {
+        if (!writeResponse(response))
+            return false;
+        emit autoResponseSent(response);
+        return true;
+    });
+}
+
+int AbstractCommunicationHandler::checkFrame(const QByteArray &frame)
+{
+    if (!frameValidator)
+        return FrameValidator::NotChecked;
+    return frameValidator->check(frame);
+}
+
+void AbstractCommunicationHandler::deliverReceived(const QByteArray &data, qint64 rxTimestampNs)
+{
+    if (dataReceivingRule != nullptr) {
+        for (int i = 0; i < data.length(); i++) {
+            if (dataReceivingRule(buffer, data[i])) {
+                emitFrame(buffer, checkFrame(buffer));
+                buffer.clear();
+            }
+        }
+    } else if (frameValidator && frameValidator->isActive()) {
+        QVector<FrameValidator::Frame> frames;
+        frameValidator->feed(data, rxTimestampNs, frames);
+        for (const FrameValidator::Frame &frame : frames)
+            emitFrame(frame.data, frame.result);
+        scheduleFrameGap();
+    } else {
+        emitFrame(data, FrameValidator::NotChecked);
+    }
+}
+
+void AbstractCommunicationHandler::emitFrame(const QByteArray &frame, int frameCheck)
+{
+    emit receivedData(frame, frameCheck);
+    if (receivingQueue != nullptr) {
+        receivingQueue->enqueue(frame);
+    }
+}
+
+/**
+ * @brief Arms the gap timer while a gap-framed frame is waiting for silence.
+ */
+void AbstractCommunicationHandler::scheduleFrameGap()
+{
+    const int delayMs = frameValidator ? frameValidator->idleDelayMs(RxResponder::nowNs()) : -1;
+    if (delayMs < 0)
+        return;
+    if (!frameGapTimer) {
+        frameGapTimer = new QTimer(this);
+        frameGapTimer->setSingleShot(true);
+        frameGapTimer->setTimerType(Qt::PreciseTimer);
+        connect(frameGapTimer, &QTimer::timeout, this, &AbstractCommunicationHandler::flushFrameGap);
+    }
+    frameGapTimer->start(delayMs);
+}
+
+void AbstractCommunicationHandler::flushFrameGap()
+{
+    if (!frameValidator)
+        return;
+    QVector<FrameValidator::Frame> frames;
+    if (frameValidator->flushIdle(RxResponder::nowNs(), frames)) {
+        for (const FrameValidator::Frame &frame : frames)
+            emitFrame(frame.data, frame.result);
+    }
+    scheduleFrameGap();
+}
+
+bool AbstractCommunicationHandler::writeResponse(const QByteArray &data)
+{
+    if (!isConnected())
+        return false;
+    send(data);
+    return true;
+}
 
 AbstractCommunicationHandler::Type AbstractCommunicationHandler::getCommHandlerType(QString chType)
 {
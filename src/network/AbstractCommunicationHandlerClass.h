@@ -23,6 +23,9 @@
 
 struct DeviceCommParams;
 struct DeviceInterfaceDetail;
+class RxResponder;
+class FrameValidator;
+class QTimer;
 
 /**
  * @brief Data Receiving Rule Callback
@@ -69,9 +72,10 @@ public:
 
     /**
      * @brief Sets the rule for parsing incoming data streams.
-     * @param rule Function pointer to the parsing logic.
+     * @param rule Function pointer to the parsing logic. Frames it cuts are
+     *        checked as they are, without the frame validator's framing.
      */
-    void setDataReceivingRule(DRR rule);
+    virtual void setDataReceivingRule(DRR rule);
 
     /**
      * @brief Sets the rule for formatting outgoing data.
@@ -79,6 +83,20 @@ public:
      */
     void setDataSendingRule(DSR rule);
 
+    /**
+     * @brief Lets the handler answer received data itself, in its I/O thread.
+     * @param rxResponder Auto-answer rules or device simulator applied to every
+     *        received chunk (not owned, must outlive the handler); nullptr to disable.
+     */
+    virtual void setResponder(RxResponder *rxResponder);
+
+    /**
+     * @brief Checks the CRC of every received frame in the I/O thread.
+     * @param validator Not owned, must outlive the handler; nullptr to disable.
+     *        The verdict is passed with receivedData().
+     */
+    virtual void setFrameValidator(FrameValidator *validator);
+
     /**
      * @brief Checks if the handler is currently connected.
      * @return true if connected, false otherwise.
@@ -109,6 +127,41 @@ protected:
     DRR dataReceivingRule;              ///< Callback for data parsing
     DSR dataSendingRule;                ///< Callback for data formatting
     Type commHandlerType;               ///< Type of this handler instance
+    RxResponder *responder;             ///< Auto-answer rules or simulator, run before receivedData()
+    FrameValidator *frameValidator;     ///< Per-frame CRC check, run before receivedData()
+    QTimer *frameGapTimer;              ///< Ends a gap-framed frame when no more data follows
+
+    /**
+     * @brief Runs the responder on a chunk just read from the device.
+     * @param rxTimestampNs RxResponder::nowNs() taken before the read
+     */
+    void runResponder(const QByteArray &data, qint64 rxTimestampNs);
+
+    /**
+     * @brief Writes a response immediately. Default: send().
+     * @return false if not connected.
+     */
+    virtual bool writeResponse(const QByteArray &data);
+
+    /**
+     * @brief Runs the frame validator on a complete frame.
+     * @return A FrameValidator::Result (NotChecked without a validator)
+     */
+    int checkFrame(const QByteArray &frame);
+
+    /**
+     * @brief Emits a chunk just read from the device as frames.
+     *
+     * Cut by the receiving rule if there is one, else by the frame
+     * validator's framing, else passed on as it is.
+     * @param rxTimestampNs RxResponder::nowNs() taken before the read
+     */
+    void deliverReceived(const QByteArray &data, qint64 rxTimestampNs);
+
+private:
+    void emitFrame(const QByteArray &frame, int frameCheck);
+    void flushFrameGap();
+    void scheduleFrameGap();
 
 public slots:
     /**
@@ -128,10 +181,11 @@ public slots:
     virtual int getPinStatus() { return 0; }
 
 signals:
-    void receivedData(QByteArray data); ///< Emitted when new data is received
+    void receivedData(QByteArray data, int frameCheck); ///< New data and its FrameValidator::Result
     void connected(void);               ///< Emitted on successful connection
     void disconnected(void);            ///< Emitted on disconnection
     void bytesWritten(qint64 bytes);    ///< Emitted when bytes are written to the interface
+    void autoResponseSent(QByteArray data); ///< Emitted after the auto-responder replied
     void error(int code);               ///< Emitted when an error occurs
 };
 
@@ -29,6 +29,7 @@ SerialQT::SerialQT(QObject *parent) : AbstractCommunicationHandler(parent)
     connect(worker, &SerialWorker::dataReceived, this, &SerialQT::onWorkerDataReceived);
     connect(worker, &SerialWorker::bytesWritten, this, &SerialQT::onWorkerBytesWritten);
     connect(worker, &SerialWorker::pinStatusChanged, this, &SerialQT::onWorkerPinStatusChanged);
+    connect(worker, &SerialWorker::autoResponseSent, this, &SerialQT::autoResponseSent);
 
     workerThread->start();
 }
@@ -70,6 +71,50 @@ bool SerialQT::initialize(QString portName, int baudRate, int dataBits, int pari
     return true;
 }
 
+/**
+ * @brief Passes the responder to the worker thread.
+ * @param rxResponder Auto-answer rules or simulator, or nullptr
+ */
+void SerialQT::setResponder(RxResponder *rxResponder)
+{
+    AbstractCommunicationHandler::setResponder(rxResponder);
+    SerialWorker *w = worker;
+    QMetaObject::invokeMethod(worker, [w, rxResponder]() { w->setResponder(rxResponder); },
+                              Qt::QueuedConnection);
+}
+
+/**
+ * @brief Passes the frame validator to the worker thread.
+ * @param validator CRC check settings, or nullptr
+ */
+void SerialQT::setFrameValidator(FrameValidator *validator)
+{
+    AbstractCommunicationHandler::setFrameValidator(validator);
+    updateWorkerValidator();
+}
+
+/**
+ * @brief Sets the receiving rule and re-decides where frames are checked.
+ * @param rule Frame assembly rule, or nullptr
+ */
+void SerialQT::setDataReceivingRule(DRR rule)
+{
+    AbstractCommunicationHandler::setDataReceivingRule(rule);
+    updateWorkerValidator();
+}
+
+/**
+ * @brief Gives the worker the validator unless frames are assembled here.
+ */
+void SerialQT::updateWorkerValidator()
+{
+    // With a receiving rule the frames are only assembled here, so the worker's chunks are not checked
+    SerialWorker *w = worker;
+    FrameValidator *workerValidator = dataReceivingRule ? nullptr : frameValidator;
+    QMetaObject::invokeMethod(worker, [w, workerValidator]() { w->setFrameValidator(workerValidator); },
+                              Qt::QueuedConnection);
+}
+
 /**
  * @brief Closes the serial port.
  */
@@ -129,13 +174,15 @@ void SerialQT::onWorkerBytesWritten(qint64 bytes)
 /**
  * @brief Processes received data from the worker thread.
  * @param d Received data
+ * @param frameCheck Verdict of the worker's frame validator for @p d
  */
-void SerialQT::onWorkerDataReceived(QByteArray d)
+void SerialQT::onWorkerDataReceived(QByteArray d, int frameCheck)
 {
     if (dataReceivingRule != nullptr) {
         for (int i = 0; i < d.length(); i++) {
             if (dataReceivingRule(buffer, d[i])) {
-                emit receivedData(buffer);
+                // Re-framed here, so the chunk verdict does not apply
+                emit receivedData(buffer, checkFrame(buffer));
                 if (receivingQueue != nullptr) {
                     receivingQueue->enqueue(buffer);
                 }
@@ -143,7 +190,7 @@ void SerialQT::onWorkerDataReceived(QByteArray d)
             }
         }
     } else {
-        emit receivedData(d);
+        emit receivedData(d, frameCheck);
         if (receivingQueue != nullptr) {
             receivingQueue->enqueue(d);
         }
@@ -12,6 +12,8 @@
 #define DTOSERIAL_H
 
 #include "AbstractCommunicationHandlerClass.h"
+#include "RxResponder.h"
+#include "FrameValidator.h"
 #include "Debugger.h"
 
 #include <QSerialPort>
@@ -41,6 +43,19 @@ public slots:
     void setDtr(bool set) { if(p) p->setDataTerminalReady(set); }
     void setRts(bool set) { if(p) p->setRequestToSend(set); }
 
+    /**
+     * @brief Auto-answer rules or simulator to apply in this thread, before data leaves it.
+     */
+    void setResponder(RxResponder *responder) { m_responder = responder; }
+
+    /**
+     * @brief Cuts and CRC-checks frames in this thread; nullptr passes chunks on as read.
+     */
+    void setFrameValidator(FrameValidator *validator) {
+        m_frameValidator = validator;
+        if(gapTimer) gapTimer->stop();
+    }
+
     /**
      * @brief Initializes and opens the serial port.
      */
@@ -99,7 +114,61 @@ public slots:
 
 private slots:
     void onReadyRead() {
-        if(p) emit dataReceived(p->readAll());
+        if(!p) return;
+        const qint64 rxTimestampNs = RxResponder::nowNs();
+        QByteArray d = p->readAll();
+
+        // Answer from here; the GUI only hears about it afterwards
+        if(m_responder && m_responder->isActive()) {
+            m_responder->process(d, rxTimestampNs, this, [this](const QByteArray &reply) {
+                return writeResponse(reply);
+            });
+        }
+        if(m_frameValidator && m_frameValidator->isActive()) {
+            // A read can hold several frames or part of one
+            QVector<FrameValidator::Frame> frames;
+            m_frameValidator->feed(d, rxTimestampNs, frames);
+            for(const FrameValidator::Frame &frame : frames)
+                emit dataReceived(frame.data, frame.result);
+            scheduleFrameGap();
+        } else {
+            emit dataReceived(d, FrameValidator::NotChecked);
+        }
+    }
+
+    /**
+     * @brief Ends a gap-framed frame once the line has stayed quiet.
+     */
+    void onFrameGap() {
+        if(!m_frameValidator) return;
+        QVector<FrameValidator::Frame> frames;
+        if(m_frameValidator->flushIdle(RxResponder::nowNs(), frames)) {
+            for(const FrameValidator::Frame &frame : frames)
+                emit dataReceived(frame.data, frame.result);
+        }
+        scheduleFrameGap();
+    }
+
+    void scheduleFrameGap() {
+        const int delayMs = m_frameValidator->idleDelayMs(RxResponder::nowNs());
+        if(delayMs < 0) return;
+        if(!gapTimer) {
+            gapTimer = new QTimer(this);
+            gapTimer->setSingleShot(true);
+            gapTimer->setTimerType(Qt::PreciseTimer);
+            connect(gapTimer, &QTimer::timeout, this, &SerialWorker::onFrameGap);
+        }
+        gapTimer->start(delayMs);
+    }
+
+    bool writeResponse(const QByteArray &reply) {
+        if(!p || !p->isOpen()) return false;
+        qint64 bytes = p->write(reply);
+        if(bytes <= 0) return false;
+        p->flush(); // hand it to the driver now, not on the next event loop pass
+        emit bytesWritten(bytes);
+        emit autoResponseSent(reply);
+        return true;
     }
     
     void monitorPins() {
@@ -112,13 +181,17 @@ signals:
     void connected();
     void disconnected();
     void error(int);
-    void dataReceived(QByteArray);
+    void dataReceived(QByteArray, int);
     void bytesWritten(qint64);
     void pinStatusChanged(int);
+    void autoResponseSent(QByteArray);
 
 private:
     QSerialPort *p;
     QTimer *monitorTimer = nullptr;
+    QTimer *gapTimer = nullptr;
+    RxResponder *m_responder = nullptr;
+    FrameValidator *m_frameValidator = nullptr;
 };
 
 
@@ -151,6 +224,21 @@ public:
      */
     void close() override;
 
+    /**
+     * @brief Hands the responder to the worker so data is answered in the serial thread.
+     */
+    void setResponder(RxResponder *rxResponder) override;
+
+    /**
+     * @brief Hands the validator to the worker so frames are cut and checked in the serial thread.
+     */
+    void setFrameValidator(FrameValidator *validator) override;
+
+    /**
+     * @brief Sets the receiving rule and moves the frame check to whichever side frames the data.
+     */
+    void setDataReceivingRule(DRR rule) override;
+
 public slots:
     /**
      * @brief Sends data to the serial port asynchronously.
@@ -175,12 +263,14 @@ private slots:
     void onWorkerConnected();
     void onWorkerDisconnected();
     void onWorkerError(int);
-    void onWorkerDataReceived(QByteArray);
+    void onWorkerDataReceived(QByteArray, int);
     void onWorkerBytesWritten(qint64);
     void onWorkerPinStatusChanged(int status) { m_cachedPinStatus = status; }
     
 private:
     int m_cachedPinStatus = 0;
+
+    void updateWorkerValidator();
 };
 
 #endif // DTOSERIAL_H
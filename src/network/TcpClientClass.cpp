@@ -7,6 +7,7 @@
  */
 
 #include "TcpClientClass.h"
+#include "RxResponder.h"
 
 /**
  * @brief Constructs a TcpClient object.
@@ -108,23 +109,10 @@ void TcpClient::close()
  */
 void TcpClient::receive()
 {
+    const qint64 rxTimestampNs = RxResponder::nowNs();
     QByteArray d = socket->readAll();
-    if (dataReceivingRule != nullptr) {
-        for (int i = 0; i < d.length(); i++) {
-            if (dataReceivingRule(buffer, d[i])) {
-                emit receivedData(buffer);
-                if (receivingQueue != nullptr) {
-                    receivingQueue->enqueue(buffer);
-                }
-                buffer.clear();
-            }
-        }
-    } else {
-        emit receivedData(d);
-        if (receivingQueue != nullptr) {
-            receivingQueue->enqueue(d);
-        }
-    }
+    runResponder(d, rxTimestampNs);
+    deliverReceived(d, rxTimestampNs);
 }
 
 /**
@@ -139,3 +127,18 @@ void TcpClient::send(QByteArray d)
         socket->write(d);
     }
 }
+
+/**
+ * @brief Writes an auto-response and pushes it to the OS right away
+ *        instead of waiting for the next event loop iteration.
+ * @param d Data to send
+ * @return false if the socket is not connected
+ */
+bool TcpClient::writeResponse(const QByteArray &d)
+{
+    if (!socket || !socket->isOpen() || !isConnected())
+        return false;
+    send(d);
+    socket->flush();
+    return true;
+}
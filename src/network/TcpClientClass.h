@@ -49,6 +49,9 @@ public:
      */
     void close() override;
 
+protected:
+    bool writeResponse(const QByteArray &data) override;
+
 private slots:
     void receive();
 public slots:
@@ -7,6 +7,7 @@
  */
 
 #include "TcpServer_SingleClientClass.h"
+#include "RxResponder.h"
 #include <QTimer>
 
 /**
@@ -95,6 +96,10 @@ void TcpServer_SingleClient::acceptClient()
     socket = server->nextPendingConnection();
     connection = true;
     server->pauseAccepting();
+
+    // A new peer starts with fresh trigger/simulator state
+    if (responder)
+        responder->reset();
     
     connect(socket, &QTcpSocket::disconnected, this, [this]() {
         connection = false;
@@ -117,24 +122,10 @@ void TcpServer_SingleClient::acceptClient()
 void TcpServer_SingleClient::receive()
 {
     if (!socket) return;
+    const qint64 rxTimestampNs = RxResponder::nowNs();
     QByteArray d = socket->readAll();
-    
-    if (dataReceivingRule != nullptr) {
-        for (int i = 0; i < d.length(); i++) {
-            if (dataReceivingRule(buffer, d[i])) {
-                emit receivedData(buffer);
-                if (receivingQueue != nullptr) {
-                    receivingQueue->enqueue(buffer);
-                }
-                buffer.clear();
-            }
-        }
-    } else {
-        emit receivedData(d);
-        if (receivingQueue != nullptr) {
-            receivingQueue->enqueue(d);
-        }
-    }
+    runResponder(d, rxTimestampNs);
+    deliverReceived(d, rxTimestampNs);
 }
 
 /**
@@ -149,3 +140,17 @@ void TcpServer_SingleClient::send(QByteArray d)
         socket->write(d);
     }
 }
+
+/**
+ * @brief Writes an auto-response and pushes it to the OS right away.
+ * @param d Data to send
+ * @return false if no client is connected
+ */
+bool TcpServer_SingleClient::writeResponse(const QByteArray &d)
+{
+    if (!socket || !socket->isOpen())
+        return false;
+    send(d);
+    socket->flush();
+    return true;
+}
@@ -37,6 +37,9 @@ public:
      */
     void close() override;
 
+protected:
+    bool writeResponse(const QByteArray &data) override;
+
 private slots:
     void acceptClient();
     void receive();
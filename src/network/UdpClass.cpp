@@ -7,6 +7,7 @@
  */
 
 #include "UdpClass.h"
+#include "RxResponder.h"
 #include <QTimer>
 
 Udp::Udp(QObject *parent) : AbstractCommunicationHandler(parent)
@@ -65,26 +66,12 @@ void Udp::close()
 void Udp::receive()
 {
     while (socket.hasPendingDatagrams()) {
+        const qint64 rxTimestampNs = RxResponder::nowNs();
         QByteArray datagram;
         datagram.resize(static_cast<int>(socket.pendingDatagramSize()));
         socket.readDatagram(datagram.data(), datagram.size());
-
-        if (dataReceivingRule != nullptr) {
-            for (int i = 0; i < datagram.length(); i++) {
-                if (dataReceivingRule(buffer, datagram[i])) {
-                    emit receivedData(buffer);
-                    if (receivingQueue != nullptr) {
-                        receivingQueue->enqueue(buffer);
-                    }
-                    buffer.clear();
-                }
-            }
-        } else {
-            emit receivedData(datagram);
-            if (receivingQueue != nullptr) {
-                receivingQueue->enqueue(buffer);
-            }
-        }
+        runResponder(datagram, rxTimestampNs);
+        deliverReceived(datagram, rxTimestampNs);
     }
 }
 
@@ -22,13 +22,18 @@
 #include <QButtonGroup>
 #include <QDialog>
 #include <QDialogButtonBox>
+#include <QDoubleSpinBox>
 #include <QFileDialog>
 #include <QGroupBox>
+#include <QHeaderView>
 #include <QMessageBox>
+#include <QProgressBar>
 #include <QScrollBar>
 #include <QShortcut>
+#include <QSpinBox>
 
 // Qt Layouts
+#include <QFormLayout>
 #include <QGridLayout>
 #include <QHBoxLayout>
 #include <QScrollArea>
@@ -39,7 +44,12 @@
 #include <QCloseEvent>
 
 // Project - Network
+#include "Checksum.h"
+#include "CrcModel.h"
+#include "DataFormat.h"
 #include "Debugger.h"
+#include "HexViewWidget.h"
+#include "SerialPortRegistry.h"
 #include "SerialQTClass.h"
 #include "TcpClientClass.h"
 #include "TcpServer_SingleClientClass.h"
@@ -50,7 +60,9 @@
 ConnectionTab::ConnectionTab(QWidget *parent)
     : QWidget(parent), ui(new Ui::ConnectionTab), m_handler(nullptr),
       m_autoSendTimer(new QTimer(this)), isConnected(false),
-      m_isDarkTheme(true), m_uiRefreshTimer(new QTimer(this)) {
+      m_isDarkTheme(true), m_logWriter(new LogWriter(this)),
+      m_replayer(new CaptureReplayer(this)),
+      m_uiRefreshTimer(new QTimer(this)) {
   m_autoSendTimer->setTimerType(Qt::PreciseTimer);
 
   m_uiRefreshTimer->setInterval(100);
@@ -156,10 +168,8 @@ ConnectionTab::ConnectionTab(QWidget *parent)
   });
   pinPollingTimer->start(200);
 
-  QTimer *portPollingTimer = new QTimer(this);
-  connect(portPollingTimer, &QTimer::timeout, this,
-          &ConnectionTab::refreshSerialPorts);
-  portPollingTimer->start(1000);
+  connect(SerialPortRegistry::instance(), &SerialPortRegistry::portsChanged,
+          this, &ConnectionTab::refreshSerialPorts);
 
   for (int i = 1; i <= 12; ++i) {
     QString sendName = QString("btnM%1").arg(i);
@@ -227,6 +237,62 @@ ConnectionTab::ConnectionTab(QWidget *parent)
 
   connect(ui->btnAutoTriggers, &QPushButton::clicked, this,
           &ConnectionTab::openTriggerConfigDialog);
+
+  // Simulator mode answers from a device definition instead of the triggers
+  m_btnSimulator = new QPushButton("Simulator", this);
+  m_btnSimulator->setCheckable(true);
+  m_btnSimulator->setToolTip("Emulate devices from a JSON state table");
+  ui->horizontalLayout_TxTools->insertWidget(
+      ui->horizontalLayout_TxTools->indexOf(ui->btnAutoTriggers) + 1,
+      m_btnSimulator);
+  m_simulatorTimer = new QTimer(this);
+  m_simulatorTimer->setInterval(500);
+  connect(m_simulatorTimer, &QTimer::timeout, this,
+          &ConnectionTab::updateSimulatorStatus);
+  connect(m_btnSimulator, &QPushButton::clicked, this,
+          &ConnectionTab::setSimulatorEnabled);
+
+  // Received frames are CRC-checked by the handler before they reach us
+  m_btnFrameCheck = new QPushButton("Frame CRC", this);
+  m_btnFrameCheck->setToolTip("Check a CRC on every received frame");
+  ui->horizontalLayout_Logs->insertWidget(
+      ui->horizontalLayout_Logs->indexOf(ui->btnClearRx), m_btnFrameCheck);
+  connect(m_btnFrameCheck, &QPushButton::clicked, this,
+          &ConnectionTab::openFrameCheckDialog);
+  m_lblFrameCheck = new QLabel(this);
+  ui->horizontalLayout_Status->insertWidget(
+      ui->horizontalLayout_Status->indexOf(ui->lblTxCount) + 1,
+      m_lblFrameCheck);
+  m_frameCheckTimer = new QTimer(this);
+  m_frameCheckTimer->setInterval(500);
+  connect(m_frameCheckTimer, &QTimer::timeout, this,
+          &ConnectionTab::updateFrameCheckStatus);
+
+  // File logging runs on its own thread; it reports back via signals
+  QPushButton *btnLogSettings = new QPushButton("...", this);
+  btnLogSettings->setToolTip("Log file settings (flush policy, rotation)");
+  btnLogSettings->setFixedWidth(30);
+  ui->horizontalLayout_Logs->insertWidget(
+      ui->horizontalLayout_Logs->indexOf(ui->chkHtmlLog) + 1, btnLogSettings);
+  connect(btnLogSettings, &QPushButton::clicked, this,
+          &ConnectionTab::openLogSettingsDialog);
+  connect(m_logWriter, &LogWriter::statsChanged, this,
+          &ConnectionTab::updateLogStatus);
+  connect(m_logWriter, &LogWriter::fileRotated, this,
+          &ConnectionTab::updateLogStatus);
+  connect(m_logWriter, &LogWriter::writeFailed, this,
+          [this](const QString &message) {
+            showCustomMessage("Logging Error", message, true);
+          });
+
+  QPushButton *btnReplay = new QPushButton("Replay", this);
+  btnReplay->setToolTip("Re-transmit a saved capture (pcap, pcapng or log file)");
+  ui->horizontalLayout_TxTools->insertWidget(
+      ui->horizontalLayout_TxTools->indexOf(ui->btnSendFile) + 1, btnReplay);
+  connect(btnReplay, &QPushButton::clicked, this,
+          &ConnectionTab::openReplayDialog);
+  connect(m_replayer, &CaptureReplayer::frameDue, this,
+          &ConnectionTab::onReplayFrame);
   connect(ui->btnChecksum, &QPushButton::clicked, this,
           &ConnectionTab::openChecksumCalculator);
 
@@ -252,6 +318,8 @@ ConnectionTab::ConnectionTab(QWidget *parent)
 }
 
 ConnectionTab::~ConnectionTab() {
+  m_replayer->stopReplay();
+  m_logWriter->close();
   if (m_handler)
     delete m_handler;
   delete ui;
@@ -279,7 +347,11 @@ void ConnectionTab::setupUiDefaults() {
   ui->tablePackets->setColumnWidth(0, 100);
   ui->tablePackets->setColumnWidth(1, 50);
   ui->tablePackets->setColumnWidth(2, 400);
-  ui->tablePackets->horizontalHeader()->setStretchLastSection(true);
+  ui->tablePackets->horizontalHeader()->setStretchLastSection(false);
+  ui->tablePackets->horizontalHeader()->setSectionResizeMode(
+      4, QHeaderView::Stretch);
+  ui->tablePackets->setColumnWidth(5, 60);
+  ui->tablePackets->setColumnHidden(5, true); // Shown while Frame CRC is on
   ui->tablePackets->setEditTriggers(QAbstractItemView::NoEditTriggers);
   ui->tablePackets->setSelectionMode(QAbstractItemView::SingleSelection);
   ui->tablePackets->setSelectionBehavior(QAbstractItemView::SelectRows);
@@ -320,7 +392,7 @@ void ConnectionTab::setupUiDefaults() {
 }
 
 void ConnectionTab::refreshSerialPorts() {
-  const auto infos = QSerialPortInfo::availablePorts();
+  const auto infos = SerialPortRegistry::instance()->ports();
 
   // UI Toggling Logic
   bool hasPorts = !infos.isEmpty();
@@ -420,6 +492,10 @@ void ConnectionTab::on_btnConnect_clicked() {
           &ConnectionTab::onError);
   connect(m_handler, &AbstractCommunicationHandler::receivedData, this,
           &ConnectionTab::onDataReceived);
+  connect(m_handler, &AbstractCommunicationHandler::autoResponseSent, this,
+          &ConnectionTab::onAutoResponseSent);
+  m_handler->setResponder(activeResponder());
+  m_handler->setFrameValidator(&m_frameValidator);
 
   if (pIndex == 0) {
     // Serial Init
@@ -777,21 +853,23 @@ void ConnectionTab::convertInputFormat(int toFormat) {
 /**
  * @brief Handles incoming data from the communication handler.
  * @param data Received data bytes
+ * @param frameCheck FrameValidator::Result computed in the I/O thread
  */
-void ConnectionTab::onDataReceived(QByteArray data) {
+void ConnectionTab::onDataReceived(QByteArray data, int frameCheck) {
   writeLog(false, data);
   rxCount += data.size();
   updateCounters(rxCount, txCount);
-  addPacketToTable(false, data);
-  processAutoTriggers(data);
+  addPacketToTable(false, data, frameCheck);
 }
 
 /**
  * @brief Adds a packet to the traffic log table with all format views.
  * @param isTx true for transmitted packets, false for received
  * @param data Packet data
+ * @param frameCheck FrameValidator::Result for received frames
  */
-void ConnectionTab::addPacketToTable(bool isTx, const QByteArray &data) {
+void ConnectionTab::addPacketToTable(bool isTx, const QByteArray &data,
+                                     int frameCheck) {
   int row = ui->tablePackets->rowCount();
   ui->tablePackets->insertRow(row);
 
@@ -819,6 +897,28 @@ void ConnectionTab::addPacketToTable(bool isTx, const QByteArray &data) {
   QString ascii = formatAsciiWithMnemonics(data);
   ui->tablePackets->setItem(row, 4, new QTableWidgetItem(ascii));
 
+  if (frameCheck != FrameValidator::NotChecked) {
+    const bool ok = frameCheck == FrameValidator::Passed;
+    QString verdict = "SHORT";
+    if (ok)
+      verdict = "OK";
+    else if (frameCheck == FrameValidator::Failed)
+      verdict = "BAD";
+    else if (frameCheck == FrameValidator::Unframed)
+      verdict = "SYNC";
+    QTableWidgetItem *itemCrc = new QTableWidgetItem(verdict);
+    itemCrc->setForeground(ok ? QBrush(QColor("#4CAF50"))
+                              : QBrush(QColor("#F44336")));
+    ui->tablePackets->setItem(row, 5, itemCrc);
+    if (!ok) {
+      // Make corrupted frames stand out in a long capture
+      for (int col = 0; col < ui->tablePackets->columnCount(); ++col) {
+        if (QTableWidgetItem *item = ui->tablePackets->item(row, col))
+          item->setBackground(QColor(244, 67, 54, 40));
+      }
+    }
+  }
+
   ui->tablePackets->scrollToBottom();
 }
 
@@ -843,6 +943,156 @@ void ConnectionTab::on_btnSendFile_clicked() {
   }
 }
 
+void ConnectionTab::openReplayDialog() {
+  if (m_replayDialog) {
+    m_replayDialog->raise();
+    m_replayDialog->activateWindow();
+    return;
+  }
+
+  QDialog *dlg = new QDialog(this);
+  dlg->setAttribute(Qt::WA_DeleteOnClose);
+  dlg->setWindowTitle("Replay Capture");
+  dlg->resize(520, 0);
+  m_replayDialog = dlg;
+
+  QFormLayout *form = new QFormLayout(dlg);
+
+  QHBoxLayout *fileRow = new QHBoxLayout();
+  QLineEdit *txtFile = new QLineEdit(dlg);
+  QPushButton *btnBrowse = new QPushButton("Browse...", dlg);
+  fileRow->addWidget(txtFile);
+  fileRow->addWidget(btnBrowse);
+  form->addRow("Capture:", fileRow);
+
+  QComboBox *cmbFrames = new QComboBox(dlg);
+  cmbFrames->addItem("TX frames (what was sent)", CaptureReplayer::ReplayTx);
+  cmbFrames->addItem("RX frames (act as the device)", CaptureReplayer::ReplayRx);
+  cmbFrames->addItem("All frames", CaptureReplayer::ReplayAll);
+  form->addRow("Replay:", cmbFrames);
+
+  QHBoxLayout *timingRow = new QHBoxLayout();
+  QComboBox *cmbTiming = new QComboBox(dlg);
+  cmbTiming->addItem("Original timing", CaptureReplayer::OriginalTiming);
+  cmbTiming->addItem("Scaled", CaptureReplayer::ScaledTiming);
+  cmbTiming->addItem("Max speed", CaptureReplayer::MaxSpeed);
+  QDoubleSpinBox *spinSpeed = new QDoubleSpinBox(dlg);
+  spinSpeed->setRange(0.1, 100.0);
+  spinSpeed->setDecimals(1);
+  spinSpeed->setSingleStep(0.5);
+  spinSpeed->setSuffix(" x");
+  spinSpeed->setValue(1.0);
+  spinSpeed->setEnabled(false);
+  timingRow->addWidget(cmbTiming, 1);
+  timingRow->addWidget(spinSpeed);
+  form->addRow("Timing:", timingRow);
+
+  QProgressBar *progressBar = new QProgressBar(dlg);
+  progressBar->setRange(0, 1000);
+  progressBar->setValue(0);
+  form->addRow(progressBar);
+
+  QLabel *lblStatus = new QLabel("Idle", dlg);
+  form->addRow(lblStatus);
+
+  QDialogButtonBox *buttons = new QDialogButtonBox(QDialogButtonBox::Close, dlg);
+  QPushButton *btnStart =
+      buttons->addButton("Start", QDialogButtonBox::ActionRole);
+  QPushButton *btnStop = buttons->addButton("Stop", QDialogButtonBox::ActionRole);
+  btnStop->setEnabled(false);
+  form->addRow(buttons);
+
+  connect(buttons, &QDialogButtonBox::rejected, dlg, &QDialog::close);
+  connect(cmbTiming, QOverload<int>::of(&QComboBox::currentIndexChanged), dlg,
+          [cmbTiming, spinSpeed]() {
+            spinSpeed->setEnabled(cmbTiming->currentData().toInt() ==
+                                  CaptureReplayer::ScaledTiming);
+          });
+  connect(btnBrowse, &QPushButton::clicked, dlg, [dlg, txtFile]() {
+    QString fileName = QFileDialog::getOpenFileName(
+        dlg, "Open Capture", LOG_FOLDER_PATH,
+        "Captures (*.pcapng *.pcap *.txt *.html);;All Files (*)");
+    if (!fileName.isEmpty())
+      txtFile->setText(fileName);
+  });
+
+  connect(btnStart, &QPushButton::clicked, dlg, [=]() {
+    if (!isConnected) {
+      showCustomMessage("Not Connected", "Please connect before replaying.",
+                        true);
+      return;
+    }
+
+    CaptureReplayer::Options options;
+    options.direction = static_cast<CaptureReplayer::DirectionFilter>(
+        cmbFrames->currentData().toInt());
+    options.timing =
+        static_cast<CaptureReplayer::Timing>(cmbTiming->currentData().toInt());
+    options.speed = spinSpeed->value();
+
+    if (!m_replayer->startReplay(txtFile->text(), options)) {
+      showCustomMessage("Replay Error", m_replayer->errorString(), true);
+      return;
+    }
+
+    m_uiRefreshTimer->start(); // replayed frames use the batched table path
+    progressBar->setValue(0);
+    lblStatus->setText("Replaying...");
+    btnStart->setEnabled(false);
+    btnStop->setEnabled(true);
+  });
+  connect(btnStop, &QPushButton::clicked, dlg,
+          [this]() { m_replayer->stopReplay(); });
+
+  connect(m_replayer, &CaptureReplayer::progress, dlg,
+          [this, progressBar, lblStatus](qint64 frames, qint64 bytesRead,
+                                         qint64 totalBytes, double meanDriftUs,
+                                         double maxDriftUs) {
+            if (totalBytes > 0)
+              progressBar->setValue(
+                  static_cast<int>(bytesRead * 1000 / totalBytes));
+            lblStatus->setText(
+                QString("%1 frames sent | timing drift: mean %2 us, max %3 us")
+                    .arg(frames)
+                    .arg(meanDriftUs, 0, 'f', 1)
+                    .arg(maxDriftUs, 0, 'f', 1));
+            updateCounters(rxCount, txCount);
+          });
+  connect(m_replayer, &CaptureReplayer::replayFinished, dlg,
+          [this, btnStart, btnStop, lblStatus](bool completed) {
+            if (!(m_isHighPerformanceMode && m_autoSendTimer->isActive()))
+              m_uiRefreshTimer->stop();
+            flushPacketBufferToTable();
+            btnStart->setEnabled(true);
+            btnStop->setEnabled(false);
+            lblStatus->setText(lblStatus->text() +
+                               (completed ? " (done)" : " (stopped)"));
+          });
+
+  // Closing the window ends the replay
+  connect(dlg, &QObject::destroyed, m_replayer, &CaptureReplayer::stopReplay);
+
+  dlg->show();
+}
+
+void ConnectionTab::onReplayFrame(const QByteArray &data, int generation,
+                                  qint64 targetNs) {
+  // Queued before Stop (or before the next Start): drop it
+  if (!m_replayer->isCurrent(generation))
+    return;
+  if (isConnected && m_handler) {
+    m_handler->send(data);
+    txCount += data.size();
+    {
+      QMutexLocker lock(&m_bufferMutex);
+      m_packetBuffer.append(
+          {true, data, QDateTime::currentDateTime().toString("HH:mm:ss.zzz")});
+    }
+    writeLog(true, data);
+  }
+  m_replayer->frameSent(targetNs);
+}
+
 void ConnectionTab::updateCounters(int rx, int tx) {
   ui->lblRxCount->setText(QString("Rx: %1").arg(rx));
   ui->lblTxCount->setText(QString("Tx: %1").arg(tx));
@@ -853,6 +1103,8 @@ void ConnectionTab::on_btnClearRx_clicked() {
   rxCount = 0;
   txCount = 0;
   updateCounters(rxCount, txCount);
+  m_frameValidator.resetStats();
+  updateFrameCheckStatus();
 }
 
 void ConnectionTab::onAutoSendTimerTimeout() {
@@ -968,6 +1220,10 @@ void ConnectionTab::onDisconnected() {
     m_autoSendTimer->stop();
     ui->chkAutoSend->setChecked(false);
   }
+
+  m_replayer->stopReplay();
+  m_autoResponder.reset();
+  m_simulator.reset();
 }
 
 void ConnectionTab::closeEvent(QCloseEvent *event) {
@@ -987,10 +1243,8 @@ void ConnectionTab::closeEvent(QCloseEvent *event) {
     settings.endGroup();
   }
 
-  // Close Log if Open
-  if (m_logFile.isOpen()) {
-    m_logFile.close();
-  }
+  // Close Log if Open (drains the queue and writes the footer)
+  m_logWriter->close();
 
   QWidget::closeEvent(event);
 }
@@ -1105,99 +1359,294 @@ void ConnectionTab::onMacroClicked(int index) {
 
 void ConnectionTab::on_chkLogToFile_toggled(bool checked) {
   if (checked) {
-    QString logsPath = LOG_FOLDER_PATH;
-    QDir dir(logsPath);
-    if (!dir.exists()) {
-      dir.mkpath(".");
-    }
-
-    QString timestamp =
-        QDateTime::currentDateTime().toString("yyyyMMdd_HHmmss");
-    bool htmlMode = ui->chkHtmlLog->isChecked();
-    QString ext = htmlMode ? ".html" : ".txt";
-    QString fileName =
-        QString("%1/PacketLog_%2%3").arg(logsPath, timestamp, ext);
-
-    m_logFile.setFileName(fileName);
-    if (m_logFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
-      m_logStream.setDevice(&m_logFile);
-
-      // Write HTML header if in HTML mode
-      if (htmlMode) {
-        m_logStream << R"(<!DOCTYPE html>
-<html>
-<head>
-<meta charset="UTF-8">
-<title>PacketForge Log</title>
-<style>
-body { font-family: 'Consolas', monospace; background-color: #1e1e1e; color: #f0f0f0; padding: 20px; }
-.tx { color: #2196F3; }
-.rx { color: #F44336; }
-.time { color: #9E9E9E; }
-.hex { color: #4CAF50; }
-pre { margin: 2px 0; }
-</style>
-</head>
-<body>
-<h2>PacketForge Traffic Log</h2>
-<p>Started: )" << QDateTime::currentDateTime().toString("yyyy-MM-dd HH:mm:ss")
-                    << R"(</p>
-<hr>
-)";
-      }
+    LogWriter::Format format =
+        ui->chkHtmlLog->isChecked() ? LogWriter::Html : LogWriter::PlainText;
 
-      ui->chkLogToFile->setText(
-          tr("Logging to %1").arg(QFileInfo(fileName).fileName()));
+    // Failures are reported through LogWriter::writeFailed
+    if (m_logWriter->open(LOG_FOLDER_PATH, format,
+                          LogWriter::Settings::load())) {
+      updateLogStatus();
     } else {
-      showCustomMessage("Logging Error", "Could not create log file.", true);
       ui->chkLogToFile->setChecked(false); // Revert
     }
   } else {
-    if (m_logFile.isOpen()) {
-      // Write HTML footer if in HTML mode
-      if (ui->chkHtmlLog->isChecked()) {
-        m_logStream << R"(
-<hr>
-<p>Ended: )" << QDateTime::currentDateTime().toString("yyyy-MM-dd HH:mm:ss")
-                    << R"(</p>
-</body>
-</html>)";
-      }
-      m_logFile.close();
-      ui->chkLogToFile->setText("Log to File");
-    }
+    m_logWriter->close();
+    ui->chkLogToFile->setText("Log to File");
+    ui->chkLogToFile->setToolTip(QString());
   }
 }
 
-void ConnectionTab::writeLog(bool isTx, const QByteArray &data) {
-  emit logData(isTx, data);
+void ConnectionTab::updateLogStatus() {
+  if (!m_logWriter->isOpen())
+    return;
+
+  QString name = QFileInfo(m_logWriter->currentFileName()).fileName();
+  quint64 dropped = m_logWriter->droppedCount();
+
+  ui->chkLogToFile->setText(
+      dropped ? tr("Logging to %1 (%2 dropped)").arg(name).arg(dropped)
+              : tr("Logging to %1").arg(name));
+  ui->chkLogToFile->setToolTip(tr("%1 packets written, %2 dropped")
+                                   .arg(m_logWriter->writtenCount())
+                                   .arg(dropped));
+}
 
-  if (!m_logFile.isOpen())
+void ConnectionTab::openLogSettingsDialog() {
+  LogWriter::Settings s = LogWriter::Settings::load();
+
+  QDialog dlg(this);
+  dlg.setWindowTitle("Log File Settings");
+  QFormLayout *form = new QFormLayout(&dlg);
+
+  QSpinBox *spinInterval = new QSpinBox(&dlg);
+  spinInterval->setRange(10, 60000);
+  spinInterval->setSuffix(" ms");
+  spinInterval->setValue(s.flushIntervalMs);
+  form->addRow("Flush every:", spinInterval);
+
+  QSpinBox *spinFlushKb = new QSpinBox(&dlg);
+  spinFlushKb->setRange(4, 65536);
+  spinFlushKb->setSuffix(" KB");
+  spinFlushKb->setValue(s.flushBytes / 1024);
+  form->addRow("Or when buffered:", spinFlushKb);
+
+  QCheckBox *chkFsync = new QCheckBox("Force data to disk on every flush", &dlg);
+  chkFsync->setChecked(s.fsyncOnFlush);
+  form->addRow("fsync:", chkFsync);
+
+  QSpinBox *spinRotateMb = new QSpinBox(&dlg);
+  spinRotateMb->setRange(0, 102400);
+  spinRotateMb->setSuffix(" MB");
+  spinRotateMb->setSpecialValueText("Off");
+  spinRotateMb->setValue(static_cast<int>(s.rotateBytes / (1024 * 1024)));
+  form->addRow("Rotate at size:", spinRotateMb);
+
+  QSpinBox *spinRotateMin = new QSpinBox(&dlg);
+  spinRotateMin->setRange(0, 10080);
+  spinRotateMin->setSuffix(" min");
+  spinRotateMin->setSpecialValueText("Off");
+  spinRotateMin->setValue(s.rotateMinutes);
+  form->addRow("Rotate after:", spinRotateMin);
+
+  QSpinBox *spinMaxFiles = new QSpinBox(&dlg);
+  spinMaxFiles->setRange(0, 10000);
+  spinMaxFiles->setSpecialValueText("Keep all");
+  spinMaxFiles->setValue(s.maxFiles);
+  form->addRow("Keep newest files:", spinMaxFiles);
+
+  QSpinBox *spinCompression = new QSpinBox(&dlg);
+  spinCompression->setRange(0, 9);
+  spinCompression->setSpecialValueText("Off");
+  spinCompression->setToolTip("gzip level: 1 = fastest, 9 = smallest");
+  spinCompression->setValue(s.compressionLevel);
+  form->addRow("Compression (.gz):", spinCompression);
+
+  QSpinBox *spinQueue = new QSpinBox(&dlg);
+  spinQueue->setRange(1024, 1 << 22);
+  spinQueue->setSingleStep(1024);
+  spinQueue->setValue(s.queueCapacity);
+  form->addRow("Queue (packets):", spinQueue);
+
+  QLabel *lblNote =
+      new QLabel("Changes apply the next time logging is started.", &dlg);
+  lblNote->setStyleSheet("color: #9E9E9E;");
+  form->addRow(lblNote);
+
+  QDialogButtonBox *buttons = new QDialogButtonBox(
+      QDialogButtonBox::Ok | QDialogButtonBox::Cancel, &dlg);
+  connect(buttons, &QDialogButtonBox::accepted, &dlg, &QDialog::accept);
+  connect(buttons, &QDialogButtonBox::rejected, &dlg, &QDialog::reject);
+  form->addRow(buttons);
+
+  if (dlg.exec() != QDialog::Accepted)
     return;
 
-  QString timestamp = QDateTime::currentDateTime().toString("HH:mm:ss.zzz");
-  QString direction = isTx ? "TX" : "RX";
+  s.flushIntervalMs = spinInterval->value();
+  s.flushBytes = spinFlushKb->value() * 1024;
+  s.fsyncOnFlush = chkFsync->isChecked();
+  s.rotateBytes = qint64(spinRotateMb->value()) * 1024 * 1024;
+  s.rotateMinutes = spinRotateMin->value();
+  s.maxFiles = spinMaxFiles->value();
+  s.queueCapacity = spinQueue->value();
+  s.compressionLevel = spinCompression->value();
+  s.save();
+}
 
-  // Format: Timestamp [TX] HEX_DATA (ASCII)
-  QString hex = data.toHex(' ').toUpper();
+void ConnectionTab::openFrameCheckDialog() {
+  FrameValidator::Settings s = m_frameValidator.settings();
+
+  QDialog dlg(this);
+  dlg.setWindowTitle("Frame CRC Check");
+  QFormLayout *form = new QFormLayout(&dlg);
+
+  QCheckBox *chkEnabled = new QCheckBox("Check every received frame", &dlg);
+  chkEnabled->setChecked(s.enabled);
+  form->addRow("Enabled:", chkEnabled);
+
+  QComboBox *comboModel = new QComboBox(&dlg);
+  comboModel->addItems(Crc::modelNames());
+  if (const Crc::Model *model = Crc::findModel(s.model))
+    comboModel->setCurrentText(model->name);
+  form->addRow("CRC model:", comboModel);
+
+  QSpinBox *spinFrom = new QSpinBox(&dlg);
+  spinFrom->setRange(-65536, 65535);
+  spinFrom->setValue(s.from);
+  spinFrom->setToolTip("First byte covered by the CRC. Negative values count "
+                       "back from the CRC field.");
+  form->addRow("Covered from byte:", spinFrom);
+
+  QSpinBox *spinTo = new QSpinBox(&dlg);
+  spinTo->setRange(-65536, 65535);
+  spinTo->setValue(s.to);
+  spinTo->setToolTip("Last byte covered by the CRC. -1 is the byte just "
+                     "before the CRC field.");
+  form->addRow("Covered to byte:", spinTo);
+
+  QComboBox *comboOrder = new QComboBox(&dlg);
+  comboOrder->addItem("Model default", FrameValidator::ModelOrder);
+  comboOrder->addItem("Big-endian", FrameValidator::BigEndian);
+  comboOrder->addItem("Little-endian", FrameValidator::LittleEndian);
+  comboOrder->setCurrentIndex(comboOrder->findData(s.byteOrder));
+  form->addRow("CRC byte order:", comboOrder);
+
+  // Framing: a read can hold several frames or part of one
+  QComboBox *comboFraming = new QComboBox(&dlg);
+  comboFraming->addItem("Per read", FrameValidator::PerRead);
+  comboFraming->addItem("Terminator", FrameValidator::Terminator);
+  comboFraming->addItem("Fixed length", FrameValidator::FixedLength);
+  comboFraming->addItem("Length field", FrameValidator::LengthField);
+  comboFraming->addItem("Inter-byte gap", FrameValidator::Gap);
+  comboFraming->setCurrentIndex(comboFraming->findData(s.framing));
+  comboFraming->setToolTip(
+      "How received data is cut into frames before the check. \"Per read\" "
+      "only suits links where every read is exactly one frame.");
+  form->addRow("Framing:", comboFraming);
+
+  QLineEdit *txtTerminator =
+      new QLineEdit(QString(s.terminator.toHex(' ').toUpper()), &dlg);
+  txtTerminator->setToolTip("Hex bytes ending each frame; the CRC precedes them.");
+  form->addRow("Terminator (hex):", txtTerminator);
+
+  QSpinBox *spinFixed = new QSpinBox(&dlg);
+  spinFixed->setRange(1, 65535);
+  spinFixed->setValue(s.fixedLength);
+  form->addRow("Frame length:", spinFixed);
+
+  QSpinBox *spinLengthOffset = new QSpinBox(&dlg);
+  spinLengthOffset->setRange(0, 65535);
+  spinLengthOffset->setValue(s.lengthOffset);
+  QComboBox *comboLengthSize = new QComboBox(&dlg);
+  comboLengthSize->addItem("1 byte", 1);
+  comboLengthSize->addItem("2 bytes BE", 2);
+  comboLengthSize->addItem("2 bytes LE", -2);
+  comboLengthSize->addItem("4 bytes BE", 4);
+  comboLengthSize->addItem("4 bytes LE", -4);
+  comboLengthSize->setCurrentIndex(comboLengthSize->findData(
+      s.lengthSize > 1 && !s.lengthBigEndian ? -s.lengthSize : s.lengthSize));
+  QSpinBox *spinLengthAdjust = new QSpinBox(&dlg);
+  spinLengthAdjust->setRange(-65536, 65535);
+  spinLengthAdjust->setValue(s.lengthAdjust);
+  spinLengthAdjust->setToolTip("Frame length = field value + adjust.");
+  QHBoxLayout *lengthRow = new QHBoxLayout();
+  lengthRow->addWidget(new QLabel("at byte", &dlg));
+  lengthRow->addWidget(spinLengthOffset);
+  lengthRow->addWidget(comboLengthSize);
+  lengthRow->addWidget(new QLabel("+", &dlg));
+  lengthRow->addWidget(spinLengthAdjust);
+  form->addRow("Length field:", lengthRow);
+
+  QSpinBox *spinGap = new QSpinBox(&dlg);
+  spinGap->setRange(1, 10000000);
+  spinGap->setSuffix(" us");
+  spinGap->setValue(s.gapUs);
+  spinGap->setToolTip("Silence that ends a frame, e.g. 3.5 characters for "
+                      "Modbus RTU. Must exceed the driver's read latency.");
+  form->addRow("Inter-frame gap:", spinGap);
+
+  QSpinBox *spinMaxFrame = new QSpinBox(&dlg);
+  spinMaxFrame->setRange(1, 1048576);
+  spinMaxFrame->setValue(s.maxFrame);
+  spinMaxFrame->setToolTip("Longer runs are shown as SYNC while the framing "
+                           "resynchronises.");
+  form->addRow("Max frame length:", spinMaxFrame);
+
+  auto updateFramingWidgets = [=]() {
+    const int framing = comboFraming->currentData().toInt();
+    txtTerminator->setEnabled(framing == FrameValidator::Terminator);
+    spinFixed->setEnabled(framing == FrameValidator::FixedLength);
+    spinLengthOffset->setEnabled(framing == FrameValidator::LengthField);
+    comboLengthSize->setEnabled(framing == FrameValidator::LengthField);
+    spinLengthAdjust->setEnabled(framing == FrameValidator::LengthField);
+    spinGap->setEnabled(framing == FrameValidator::Gap);
+    spinMaxFrame->setEnabled(framing != FrameValidator::PerRead);
+  };
+  connect(comboFraming, QOverload<int>::of(&QComboBox::currentIndexChanged),
+          &dlg, updateFramingWidgets);
+  updateFramingWidgets();
+
+  QLabel *lblNote = new QLabel(
+      "The CRC is taken from the last bytes of each frame.", &dlg);
+  lblNote->setStyleSheet("color: #9E9E9E;");
+  form->addRow(lblNote);
+
+  QDialogButtonBox *buttons = new QDialogButtonBox(
+      QDialogButtonBox::Ok | QDialogButtonBox::Cancel, &dlg);
+  connect(buttons, &QDialogButtonBox::accepted, &dlg, &QDialog::accept);
+  connect(buttons, &QDialogButtonBox::rejected, &dlg, &QDialog::reject);
+  form->addRow(buttons);
+
+  if (dlg.exec() != QDialog::Accepted)
+    return;
 
-  // Create a safe ASCII representation with mnemonics
-  QString ascii = formatAsciiWithMnemonics(data);
+  s.enabled = chkEnabled->isChecked();
+  s.model = comboModel->currentText();
+  s.from = spinFrom->value();
+  s.to = spinTo->value();
+  s.byteOrder =
+      static_cast<FrameValidator::ByteOrder>(comboOrder->currentData().toInt());
+  s.framing =
+      static_cast<FrameValidator::Framing>(comboFraming->currentData().toInt());
+  QString terminatorHex = txtTerminator->text();
+  terminatorHex.remove(' ');
+  s.terminator = QByteArray::fromHex(terminatorHex.toLatin1());
+  s.fixedLength = spinFixed->value();
+  s.lengthOffset = spinLengthOffset->value();
+  s.lengthSize = qAbs(comboLengthSize->currentData().toInt());
+  s.lengthBigEndian = comboLengthSize->currentData().toInt() > 0;
+  s.lengthAdjust = spinLengthAdjust->value();
+  s.gapUs = spinGap->value();
+  s.maxFrame = spinMaxFrame->value();
+
+  QString error;
+  if (!m_frameValidator.setSettings(s, &error))
+    showCustomMessage("Frame CRC Check", error, true);
+
+  const bool active = m_frameValidator.isActive();
+  ui->tablePackets->setColumnHidden(5, !active);
+  active ? m_frameCheckTimer->start() : m_frameCheckTimer->stop();
+  updateFrameCheckStatus();
+}
 
-  if (ui->chkHtmlLog->isChecked()) {
-    // HTML format with colors
-    QString dirClass = isTx ? "tx" : "rx";
-    m_logStream << QString("<pre><span class=\"time\">[%1]</span> <span "
-                           "class=\"%2\">[%3]</span> <span "
-                           "class=\"hex\">%4</span>  (%5)</pre>\n")
-                       .arg(timestamp, dirClass, direction, hex.toHtmlEscaped(),
-                            ascii.toHtmlEscaped());
-  } else {
-    // Plain text format
-    m_logStream << "[" << timestamp << "] [" << direction << "] " << hex
-                << "  (" << ascii << ")\n";
+void ConnectionTab::updateFrameCheckStatus() {
+  if (!m_frameValidator.isActive()) {
+    m_lblFrameCheck->clear();
+    return;
   }
-  m_logStream.flush();
+  const FrameValidator::Stats stats = m_frameValidator.stats();
+  m_lblFrameCheck->setText(QString("CRC: %1 ok / %2 bad (%3%)")
+                               .arg(stats.passed)
+                               .arg(stats.failed + stats.tooShort + stats.unframed)
+                               .arg(stats.errorRate(), 0, 'f', 2));
+}
+
+void ConnectionTab::writeLog(bool isTx, const QByteArray &data) {
+  // One timestamp shared by every consumer of this packet
+  const qint64 timestampNs = LogWriter::currentTimestampNs();
+  emit logData(isTx, data, timestampNs);
+
+  // Formatted and written on the writer thread
+  m_logWriter->append(isTx, data, timestampNs);
 }
 
 void ConnectionTab::onTableDoubleClicked(int row, int column) {
@@ -1222,37 +1671,101 @@ void ConnectionTab::onTableDoubleClicked(int row, int column) {
 
   QDialog *dlg = new QDialog(this);
   dlg->setWindowTitle("Raw Data Inspector");
-  dlg->resize(600, 450);
+  dlg->resize(760, 500);
 
   QVBoxLayout *layout = new QVBoxLayout(dlg);
 
-  // 1. Hex View
-  QGroupBox *grpHex = new QGroupBox("Raw Hex (Space Separated)", dlg);
-  QVBoxLayout *hexLayout = new QVBoxLayout(grpHex);
-  QTextEdit *txtHex = new QTextEdit(grpHex);
-  txtHex->setReadOnly(true);
-  txtHex->setFont(QFont("Consolas", 10));
-  txtHex->setPlainText(data.toHex(' ').toUpper());
-  hexLayout->addWidget(txtHex);
-  layout->addWidget(grpHex);
-
-  // 2. ASCII View (Original)
-  QGroupBox *grpAscii = new QGroupBox("Original ASCII (Raw)", dlg);
-  QVBoxLayout *asciiLayout = new QVBoxLayout(grpAscii);
-  QTextEdit *txtAscii = new QTextEdit(grpAscii);
-  txtAscii->setReadOnly(true);
-  txtAscii->setFont(QFont("Consolas", 10));
-  // Provide raw latin1 view to preserve 1-byte-per-char visual as much as
-  // possible
-  txtAscii->setPlainText(QString::fromLatin1(data));
-  asciiLayout->addWidget(txtAscii);
-  layout->addWidget(grpAscii);
-
-  // Close
+  // Navigation & Search
+  QHBoxLayout *toolLayout = new QHBoxLayout();
+  QLineEdit *txtOffset = new QLineEdit(dlg);
+  txtOffset->setPlaceholderText("Offset (0x1A2B or 6699)");
+  txtOffset->setMaximumWidth(170);
+  QPushButton *btnGoto = new QPushButton("Go", dlg);
+  QComboBox *cmbFindMode = new QComboBox(dlg);
+  cmbFindMode->addItems({"Hex", "ASCII"});
+  QLineEdit *txtFind = new QLineEdit(dlg);
+  txtFind->setPlaceholderText("Find pattern (e.g. AA 55)");
+  QPushButton *btnPrev = new QPushButton("Prev", dlg);
+  QPushButton *btnNext = new QPushButton("Next", dlg);
+  toolLayout->addWidget(new QLabel("Offset:", dlg));
+  toolLayout->addWidget(txtOffset);
+  toolLayout->addWidget(btnGoto);
+  toolLayout->addSpacing(15);
+  toolLayout->addWidget(new QLabel("Find:", dlg));
+  toolLayout->addWidget(cmbFindMode);
+  toolLayout->addWidget(txtFind, 1);
+  toolLayout->addWidget(btnPrev);
+  toolLayout->addWidget(btnNext);
+  layout->addLayout(toolLayout);
+
+  // Hex / ASCII view (renders only the visible lines)
+  HexViewWidget *hexView = new HexViewWidget(dlg);
+  hexView->setData(data);
+  layout->addWidget(hexView, 1);
+
+  QLabel *lblStatus = new QLabel(dlg);
+  layout->addWidget(lblStatus);
+
+  auto showStatus = [lblStatus, data](qint64 start, qint64 length) {
+    QString text = QString("Size: %1 bytes").arg(data.size());
+    if (length > 0)
+      text += QString("   |   Selection: 0x%1 (%2), %3 bytes")
+                  .arg(QString::number(start, 16).toUpper())
+                  .arg(start)
+                  .arg(length);
+    lblStatus->setText(text);
+  };
+  showStatus(0, 0);
+  connect(hexView, &HexViewWidget::selectionChanged, dlg, showStatus);
+
+  auto gotoOffset = [txtOffset, hexView, lblStatus]() {
+    QString text = txtOffset->text().trimmed();
+    bool ok = false;
+    qint64 offset = text.startsWith("0x", Qt::CaseInsensitive)
+                        ? text.mid(2).toLongLong(&ok, 16)
+                        : text.toLongLong(&ok, 10);
+    if (!ok || !hexView->gotoOffset(offset))
+      lblStatus->setText("Offset out of range");
+    hexView->setFocus();
+  };
+  connect(btnGoto, &QPushButton::clicked, dlg, gotoOffset);
+  connect(txtOffset, &QLineEdit::returnPressed, dlg, gotoOffset);
+
+  auto findPattern = [txtFind, cmbFindMode, hexView, lblStatus](bool forward) {
+    QByteArray pattern;
+    if (cmbFindMode->currentIndex() == 0) {
+      QString hex = txtFind->text();
+      hex.remove(' ').remove("0x", Qt::CaseInsensitive);
+      if (!isHexString(hex) || hex.size() % 2 != 0) {
+        lblStatus->setText("Invalid hex pattern");
+        return;
+      }
+      pattern = QByteArray::fromHex(hex.toLatin1());
+    } else {
+      pattern = txtFind->text().toUtf8();
+    }
+    if (pattern.isEmpty())
+      return;
+    if (hexView->find(pattern, forward) < 0)
+      lblStatus->setText("Pattern not found");
+  };
+  connect(btnNext, &QPushButton::clicked, dlg,
+          [findPattern]() { findPattern(true); });
+  connect(btnPrev, &QPushButton::clicked, dlg,
+          [findPattern]() { findPattern(false); });
+  connect(txtFind, &QLineEdit::returnPressed, dlg,
+          [findPattern]() { findPattern(true); });
+
+  // Copy & Close
   QDialogButtonBox *btnBox = new QDialogButtonBox(QDialogButtonBox::Close, dlg);
+  QPushButton *btnCopy =
+      btnBox->addButton("Copy Selection", QDialogButtonBox::ActionRole);
+  connect(btnCopy, &QPushButton::clicked, hexView,
+          &HexViewWidget::copySelection);
   connect(btnBox, &QDialogButtonBox::rejected, dlg, &QDialog::reject);
   layout->addWidget(btnBox);
 
+  hexView->setFocus();
   dlg->exec();
   delete dlg;
 }
@@ -1260,123 +1773,7 @@ void ConnectionTab::onTableDoubleClicked(int row, int column) {
 // --- High Performance Mode Helpers ---
 
 QString ConnectionTab::formatAsciiWithMnemonics(const QByteArray &data) {
-  QString result;
-  result.reserve(data.size() * 2); // Pre-allocate for efficiency
-
-  for (int i = 0; i < data.size(); ++i) {
-    unsigned char c = static_cast<unsigned char>(data.at(i));
-
-    switch (c) {
-    case 0x00:
-      result += "<NUL>";
-      break;
-    case 0x01:
-      result += "<SOH>";
-      break;
-    case 0x02:
-      result += "<STX>";
-      break;
-    case 0x03:
-      result += "<ETX>";
-      break;
-    case 0x04:
-      result += "<EOT>";
-      break;
-    case 0x05:
-      result += "<ENQ>";
-      break;
-    case 0x06:
-      result += "<ACK>";
-      break;
-    case 0x07:
-      result += "<BEL>";
-      break;
-    case 0x08:
-      result += "<BS>";
-      break;
-    case 0x09:
-      result += "<TAB>";
-      break;
-    case 0x0A:
-      result += "<LF>";
-      break;
-    case 0x0B:
-      result += "<VT>";
-      break;
-    case 0x0C:
-      result += "<FF>";
-      break;
-    case 0x0D:
-      result += "<CR>";
-      break;
-    case 0x0E:
-      result += "<SO>";
-      break;
-    case 0x0F:
-      result += "<SI>";
-      break;
-    case 0x10:
-      result += "<DLE>";
-      break;
-    case 0x11:
-      result += "<DC1>";
-      break;
-    case 0x12:
-      result += "<DC2>";
-      break;
-    case 0x13:
-      result += "<DC3>";
-      break;
-    case 0x14:
-      result += "<DC4>";
-      break;
-    case 0x15:
-      result += "<NAK>";
-      break;
-    case 0x16:
-      result += "<SYN>";
-      break;
-    case 0x17:
-      result += "<ETB>";
-      break;
-    case 0x18:
-      result += "<CAN>";
-      break;
-    case 0x19:
-      result += "<EM>";
-      break;
-    case 0x1A:
-      result += "<SUB>";
-      break;
-    case 0x1B:
-      result += "<ESC>";
-      break;
-    case 0x1C:
-      result += "<FS>";
-      break;
-    case 0x1D:
-      result += "<GS>";
-      break;
-    case 0x1E:
-      result += "<RS>";
-      break;
-    case 0x1F:
-      result += "<US>";
-      break;
-    case 0x7F:
-      result += "<DEL>";
-      break;
-    default:
-      if (c >= 32 && c <= 126) {
-        result += QChar(c);
-      } else {
-        // Non-printable high bytes: show as hex
-        result += QString("<%1>").arg(c, 2, 16, QChar('0')).toUpper();
-      }
-      break;
-    }
-  }
-  return result;
+  return DataFormat::asciiWithMnemonics(data);
 }
 
 void ConnectionTab::flushPacketBufferToTable() {
@@ -1444,44 +1841,73 @@ void ConnectionTab::flushPacketBufferToTable() {
 
 // --- Auto-Answer Triggers Implementation ---
 
-void ConnectionTab::processAutoTriggers(const QByteArray &data) {
-  if (m_autoTriggers.isEmpty())
-    return;
+void ConnectionTab::onAutoResponseSent(const QByteArray &data) {
+  // The handler already sent it; only account for it here
+  qDebug() << "[AutoTrigger] Replied" << data.size() << "bytes";
+  txCount += data.size();
+  updateCounters(rxCount, txCount);
+  addPacketToTable(true, data);
+  writeLog(true, data);
+}
 
-  // Accumulate received data for pattern matching
-  m_rxAccumulator.append(data);
+RxResponder *ConnectionTab::activeResponder() {
+  if (m_simulator.isActive())
+    return &m_simulator;
+  return &m_autoResponder;
+}
 
-  // Limit accumulator size to prevent memory bloat (keep last 4KB)
-  const int MAX_ACCUMULATOR_SIZE = 4096;
-  if (m_rxAccumulator.size() > MAX_ACCUMULATOR_SIZE) {
-    m_rxAccumulator = m_rxAccumulator.right(MAX_ACCUMULATOR_SIZE / 2);
+void ConnectionTab::setSimulatorEnabled(bool enable) {
+  if (enable) {
+    QString fileName = QFileDialog::getOpenFileName(
+        this, "Load Device Simulator", FILES_FOLDER_PATH,
+        "Simulator Definitions (*.json);;All Files (*)");
+    QString error;
+    if (fileName.isEmpty() || !m_simulator.load(fileName, &error)) {
+      if (!error.isEmpty())
+        showCustomMessage("Device Simulator", error, true);
+      m_btnSimulator->setChecked(false);
+      return;
+    }
+    m_simulatorTimer->start();
+  } else {
+    m_simulator.unload();
+    m_simulatorTimer->stop();
   }
 
-  // Check each trigger
-  for (const AutoTrigger &trigger : m_autoTriggers) {
-    if (!trigger.enabled || trigger.pattern.isEmpty())
-      continue;
+  if (m_handler)
+    m_handler->setResponder(activeResponder());
+  ui->btnAutoTriggers->setEnabled(!m_simulator.isActive());
+  updateSimulatorStatus();
+}
 
-    int idx = m_rxAccumulator.indexOf(trigger.pattern);
-    if (idx != -1) {
-      // Pattern matched! Send response
-      qDebug() << "[AutoTrigger] Pattern matched:" << trigger.name;
+void ConnectionTab::updateSimulatorStatus() {
+  if (!m_simulator.isActive()) {
+    m_btnSimulator->setText("Simulator");
+    m_btnSimulator->setToolTip("Emulate devices from a JSON state table");
+    return;
+  }
 
-      // Remove matched portion to prevent re-triggering
-      m_rxAccumulator = m_rxAccumulator.mid(idx + trigger.pattern.size());
+  const DeviceSimulator::Stats stats = m_simulator.stats();
+  m_btnSimulator->setText("Simulator: " + m_simulator.name());
+  m_btnSimulator->setToolTip(
+      QString("%1 frames, %2 replies, %3 unmatched\nClick to stop simulating")
+          .arg(stats.frames)
+          .arg(stats.replies)
+          .arg(stats.unmatched));
+}
 
-      // Send response (with optional delay)
-      if (trigger.delayMs > 0) {
-        QTimer::singleShot(trigger.delayMs, this, [this, trigger]() {
-          if (isConnected && m_handler) {
-            sendPacket(trigger.response);
-          }
-        });
-      } else {
-        sendPacket(trigger.response);
-      }
-    }
+bool ConnectionTab::rebuildTriggerMatcher(const QVector<AutoTrigger> &triggers,
+                                          QString *errorMessage) {
+  QVector<AutoResponder::Rule> rules;
+  rules.reserve(triggers.size());
+  for (const AutoTrigger &trigger : triggers) {
+    AutoResponder::Rule rule;
+    rule.pattern = trigger.enabled ? trigger.pattern : QString();
+    rule.response = trigger.response;
+    rule.delayMs = trigger.delayMs;
+    rules.append(rule);
   }
+  return m_autoResponder.setRules(rules, errorMessage);
 }
 
 void ConnectionTab::openTriggerConfigDialog() {
@@ -1492,22 +1918,27 @@ void ConnectionTab::openTriggerConfigDialog() {
   QVBoxLayout *mainLayout = new QVBoxLayout(dlg);
 
   // Info Label
-  QLabel *lblInfo =
-      new QLabel("Configure patterns to watch for. When a pattern is detected, "
-                 "the response will be sent automatically.",
-                 dlg);
+  QLabel *lblInfo = new QLabel(
+      "Configure patterns to watch for. When a pattern is detected, "
+      "the response will be sent automatically.<br>"
+      "Patterns: hex bytes <b>AA 55</b>, any byte <b>?\?</b>, nibble <b>A?</b>, "
+      "mask <b>40/F0</b>, set <b>[30-39 2E]</b> or <b>[^0D]</b>, text "
+      "<b>\"OK\\r\"</b>, groups <b>(A|B)</b> and repeats <b>* + ? {n,m}</b>.",
+      dlg);
   lblInfo->setWordWrap(true);
   mainLayout->addWidget(lblInfo);
 
   // Trigger List
-  QTableWidget *tblTriggers = new QTableWidget(0, 5, dlg);
-  tblTriggers->setHorizontalHeaderLabels(
-      {"Enabled", "Name", "Pattern (Hex)", "Response (Hex)", "Delay (ms)"});
+  QTableWidget *tblTriggers = new QTableWidget(0, 6, dlg);
+  tblTriggers->setHorizontalHeaderLabels({"Enabled", "Name", "Pattern",
+                                          "Response (Hex)", "Delay (ms)",
+                                          "Replies / Latency"});
   tblTriggers->horizontalHeader()->setStretchLastSection(true);
   tblTriggers->setColumnWidth(0, 60);
   tblTriggers->setColumnWidth(1, 100);
   tblTriggers->setColumnWidth(2, 180);
   tblTriggers->setColumnWidth(3, 180);
+  tblTriggers->setColumnWidth(4, 70);
   mainLayout->addWidget(tblTriggers);
 
   // Populate existing triggers
@@ -1520,14 +1951,46 @@ void ConnectionTab::openTriggerConfigDialog() {
     tblTriggers->setCellWidget(row, 0, chk);
 
     tblTriggers->setItem(row, 1, new QTableWidgetItem(t.name));
-    tblTriggers->setItem(row, 2,
-                         new QTableWidgetItem(t.pattern.toHex(' ').toUpper()));
+    tblTriggers->setItem(row, 2, new QTableWidgetItem(t.pattern));
     tblTriggers->setItem(row, 3,
                          new QTableWidgetItem(t.response.toHex(' ').toUpper()));
     tblTriggers->setItem(row, 4,
                          new QTableWidgetItem(QString::number(t.delayMs)));
+
+    // Remember which rule this row was, for the latency column
+    tblTriggers->item(row, 1)->setData(Qt::UserRole, row);
+    QTableWidgetItem *stats = new QTableWidgetItem();
+    stats->setFlags(stats->flags() & ~Qt::ItemIsEditable);
+    tblTriggers->setItem(row, 5, stats);
   }
 
+  // Time from reading the data to writing the reply, measured in the I/O
+  // thread (configured delay excluded)
+  auto refreshStats = [this, tblTriggers]() {
+    const QVector<AutoResponder::Stats> stats = m_autoResponder.stats();
+    for (int row = 0; row < tblTriggers->rowCount(); ++row) {
+      QTableWidgetItem *name = tblTriggers->item(row, 1);
+      QTableWidgetItem *cell = tblTriggers->item(row, 5);
+      if (!name || !cell || !name->data(Qt::UserRole).isValid())
+        continue;
+      const int rule = name->data(Qt::UserRole).toInt();
+      if (rule >= stats.size() || stats[rule].replies == 0) {
+        cell->setText("-");
+        continue;
+      }
+      const AutoResponder::Stats &s = stats[rule];
+      cell->setText(QString("%1 | last %2 us, mean %3 us, max %4 us")
+                        .arg(s.replies)
+                        .arg(s.lastNs / 1000.0, 0, 'f', 1)
+                        .arg(s.meanNs() / 1000.0, 0, 'f', 1)
+                        .arg(s.maxNs / 1000.0, 0, 'f', 1));
+    }
+  };
+  refreshStats();
+  QTimer *statsTimer = new QTimer(dlg);
+  connect(statsTimer, &QTimer::timeout, dlg, refreshStats);
+  statsTimer->start(500);
+
   // Buttons
   QHBoxLayout *btnLayout = new QHBoxLayout();
   QPushButton *btnAdd = new QPushButton("Add Trigger", dlg);
@@ -1563,7 +2026,7 @@ void ConnectionTab::openTriggerConfigDialog() {
 
   // Save & Close
   connect(btnSave, &QPushButton::clicked, [this, dlg, tblTriggers]() {
-    m_autoTriggers.clear();
+    QVector<AutoTrigger> triggers;
 
     for (int row = 0; row < tblTriggers->rowCount(); ++row) {
       AutoTrigger t;
@@ -1575,10 +2038,18 @@ void ConnectionTab::openTriggerConfigDialog() {
       t.name =
           tblTriggers->item(row, 1) ? tblTriggers->item(row, 1)->text() : "";
 
-      QString patternHex =
-          tblTriggers->item(row, 2) ? tblTriggers->item(row, 2)->text() : "";
-      patternHex.remove(' ');
-      t.pattern = QByteArray::fromHex(patternHex.toLatin1());
+      t.pattern = tblTriggers->item(row, 2)
+                      ? tblTriggers->item(row, 2)->text().trimmed()
+                      : "";
+
+      QString error;
+      if (!t.pattern.isEmpty() &&
+          !TriggerMatcher::validatePattern(t.pattern, &error)) {
+        tblTriggers->setCurrentCell(row, 2);
+        showCustomMessage("Invalid Pattern",
+                          QString("Row %1: %2").arg(row + 1).arg(error), true);
+        return;
+      }
 
       QString responseHex =
           tblTriggers->item(row, 3) ? tblTriggers->item(row, 3)->text() : "";
@@ -1590,10 +2061,17 @@ void ConnectionTab::openTriggerConfigDialog() {
                       : 0;
 
       if (!t.pattern.isEmpty()) {
-        m_autoTriggers.append(t);
+        triggers.append(t);
       }
     }
 
+    // Compile first: a set over the state limit keeps the old triggers
+    QString error;
+    if (!rebuildTriggerMatcher(triggers, &error)) {
+      showCustomMessage("Auto-Answer Triggers", error, true);
+      return;
+    }
+    m_autoTriggers = triggers;
     qDebug() << "[AutoTrigger] Saved" << m_autoTriggers.size() << "triggers";
     dlg->accept();
   });
@@ -1622,7 +2100,7 @@ void ConnectionTab::openChecksumCalculator() {
   QGroupBox *grpAlgo = new QGroupBox("Algorithm", dlg);
   QHBoxLayout *algoLayout = new QHBoxLayout(grpAlgo);
   QComboBox *cmbAlgo = new QComboBox(grpAlgo);
-  cmbAlgo->addItems({"CRC16", "CRC32", "XOR", "LRC", "SUM8"});
+  cmbAlgo->addItems(Checksum::algorithms());
   QPushButton *btnCalc = new QPushButton("Calculate", grpAlgo);
   algoLayout->addWidget(cmbAlgo);
   algoLayout->addWidget(btnCalc);
@@ -1673,71 +2151,5 @@ void ConnectionTab::openChecksumCalculator() {
 
 QByteArray ConnectionTab::calculateChecksum(const QByteArray &data,
                                             const QString &algorithm) {
-
-  if (data.isEmpty())
-    return QByteArray();
-
-  if (algorithm == "XOR") {
-    // Simple XOR of all bytes
-    unsigned char xorResult = 0;
-    for (char c : data) {
-      xorResult ^= static_cast<unsigned char>(c);
-    }
-    return QByteArray(1, xorResult);
-  } else if (algorithm == "SUM8") {
-    // Sum of all bytes (mod 256)
-    unsigned char sum = 0;
-    for (char c : data) {
-      sum += static_cast<unsigned char>(c);
-    }
-    return QByteArray(1, sum);
-  } else if (algorithm == "LRC") {
-    // Longitudinal Redundancy Check (2's complement of sum)
-    unsigned char sum = 0;
-    for (char c : data) {
-      sum += static_cast<unsigned char>(c);
-    }
-    unsigned char lrc = (~sum) + 1;
-    return QByteArray(1, lrc);
-  } else if (algorithm == "CRC16") {
-    // CRC-16/MODBUS (Polynomial 0x8005, Init 0xFFFF)
-    quint16 crc = 0xFFFF;
-    for (char c : data) {
-      crc ^= static_cast<unsigned char>(c);
-      for (int i = 0; i < 8; ++i) {
-        if (crc & 0x0001) {
-          crc = (crc >> 1) ^ 0xA001;
-        } else {
-          crc >>= 1;
-        }
-      }
-    }
-    QByteArray result;
-    result.append(
-        static_cast<char>(crc & 0xFF)); // Low byte first (little-endian)
-    result.append(static_cast<char>((crc >> 8) & 0xFF)); // High byte
-    return result;
-  } else if (algorithm == "CRC32") {
-    // CRC-32 (Standard Ethernet/ZIP polynomial)
-    quint32 crc = 0xFFFFFFFF;
-    for (char c : data) {
-      crc ^= static_cast<unsigned char>(c);
-      for (int i = 0; i < 8; ++i) {
-        if (crc & 1) {
-          crc = (crc >> 1) ^ 0xEDB88320;
-        } else {
-          crc >>= 1;
-        }
-      }
-    }
-    crc ^= 0xFFFFFFFF;
-    QByteArray result;
-    result.append(static_cast<char>(crc & 0xFF));
-    result.append(static_cast<char>((crc >> 8) & 0xFF));
-    result.append(static_cast<char>((crc >> 16) & 0xFF));
-    result.append(static_cast<char>((crc >> 24) & 0xFF));
-    return result;
-  }
-
-  return QByteArray(); // Unknown algorithm
+  return Checksum::calculate(data, algorithm);
 }
@@ -22,6 +22,7 @@
 #include <QMutex>
 #include <QVector>
 #include <QElapsedTimer>
+#include <QPointer>
 
 // Qt Widgets
 #include <QComboBox>
@@ -53,6 +54,11 @@
 #include "UdpClass.h"
 #include "macros.h"
 #include "MacroDialog.h"
+#include "LogWriter.h"
+#include "CaptureReplayer.h"
+#include "AutoResponder.h"
+#include "DeviceSimulator.h"
+#include "FrameValidator.h"
 
 namespace Ui {
 class ConnectionTab;
@@ -90,7 +96,13 @@ signals:
      * @brief Signal to request toggling the start/stop state of the logger.
      */
     void toggleStartStopRequested();
-    void logData(bool isTx, const QByteArray &data);
+
+    /**
+     * @brief Emitted for every packet sent or received.
+     * @param timestampNs Capture time, nanoseconds since the Unix epoch.
+     *        Slots taking only (isTx, data) may still connect.
+     */
+    void logData(bool isTx, const QByteArray &data, qint64 timestampNs);
 
 private slots:
     // --- UI Interaction Slots ---
@@ -199,8 +211,9 @@ private slots:
     /**
      * @brief Handles incoming data from the communication handler.
      * @param data The raw bytes received.
+     * @param frameCheck FrameValidator::Result computed in the I/O thread.
      */
-    void onDataReceived(QByteArray data);
+    void onDataReceived(QByteArray data, int frameCheck);
     
     // --- Status Logic ---
 
@@ -274,8 +287,10 @@ private:
      * @brief Adds a packet to the Traffic Log table.
      * @param isTx True if transmitting, False if receiving.
      * @param data The raw data bytes.
+     * @param frameCheck FrameValidator::Result shown in the CRC column.
      */
-    void addPacketToTable(bool isTx, const QByteArray &data);
+    void addPacketToTable(bool isTx, const QByteArray &data,
+                          int frameCheck = FrameValidator::NotChecked);
     
 private slots:
     void onTableDoubleClicked(int row, int column);
@@ -296,8 +311,22 @@ private:
     QMap<int, QTimer*> m_macroTimers; // Timers for each macro button
 
     // --- Logging ---
-    QFile m_logFile;
-    QTextStream m_logStream;
+    LogWriter *m_logWriter;                  ///< Background writer for "Log to File"
+
+    // --- Capture Replay ---
+    CaptureReplayer *m_replayer;             ///< Schedules frames on its own thread
+    QPointer<QDialog> m_replayDialog;        ///< Non-modal replay window, if open
+
+    // --- Device Simulator ---
+    DeviceSimulator m_simulator;             ///< Replaces the triggers while enabled
+    QPushButton *m_btnSimulator = nullptr;
+    QTimer *m_simulatorTimer = nullptr;      ///< Refreshes the simulator statistics
+
+    // --- Frame CRC Validation ---
+    FrameValidator m_frameValidator;         ///< Checked by the handler for every received frame
+    QPushButton *m_btnFrameCheck = nullptr;
+    QLabel *m_lblFrameCheck = nullptr;       ///< Pass/fail counters and error rate
+    QTimer *m_frameCheckTimer = nullptr;     ///< Refreshes m_lblFrameCheck
 
     // --- Hex/ASCII/Binary Input ---
     QRadioButton *rbInputAscii;
@@ -319,6 +348,26 @@ private:
     QElapsedTimer m_perfTimer;               ///< For measuring send performance
     long long m_perfPacketCount = 0;
 
+    /**
+     * @brief Opens the capture replay window (file, frame filter, timing).
+     */
+    void openReplayDialog();
+
+    /**
+     * @brief Sends one replayed frame and returns its credit to the replayer.
+     */
+    void onReplayFrame(const QByteArray &data, int generation, qint64 targetNs);
+
+    /**
+     * @brief Opens the flush / rotation settings dialog for file logging.
+     */
+    void openLogSettingsDialog();
+
+    /**
+     * @brief Shows the current log file and written/dropped counters.
+     */
+    void updateLogStatus();
+
     /**
      * @brief Converts ASCII to control character mnemonics like <CR>, <LF>, etc.
      * @param data Raw binary data
@@ -340,20 +389,52 @@ private:
     // --- Auto-Answer Triggers  ---
     struct AutoTrigger {
         QString name;           ///< User-friendly name for the trigger
-        QByteArray pattern;     ///< Pattern to match in received data
+        QString pattern;        ///< Byte pattern to match in received data (TriggerMatcher syntax)
         QByteArray response;    ///< Data to send when pattern is matched
         bool enabled = true;    ///< Whether this trigger is active
-        bool matchHex = true;   ///< True if pattern/response are hex, false for ASCII
+        bool matchHex = true;   ///< True if the response is hex, false for ASCII
         int delayMs = 0;        ///< Delay before sending response (ms)
     };
     QVector<AutoTrigger> m_autoTriggers;  ///< List of auto-answer triggers
-    QByteArray m_rxAccumulator;           ///< Accumulates RX data for pattern matching
+    AutoResponder m_autoResponder;        ///< Enabled triggers, run by the handler's I/O thread
+
+    /**
+     * @brief Compiles @p triggers into m_autoResponder.
+     * @return false if they do not compile; the previous triggers stay active.
+     */
+    bool rebuildTriggerMatcher(const QVector<AutoTrigger> &triggers,
+                               QString *errorMessage);
+
+    /**
+     * @brief Logs a reply the handler sent on its own (trigger or simulator).
+     */
+    void onAutoResponseSent(const QByteArray &data);
+
+    /**
+     * @brief Loads a simulator definition and hands it to the handler, or
+     *        unloads it and goes back to the auto-answer triggers.
+     */
+    void setSimulatorEnabled(bool enable);
+
+    /**
+     * @brief Shows the simulator name and counters on its button.
+     */
+    void updateSimulatorStatus();
+
+    /**
+     * @brief The simulator if one is loaded, else the trigger responder.
+     */
+    RxResponder *activeResponder();
+
+    /**
+     * @brief Configures which bytes of each received frame carry which CRC.
+     */
+    void openFrameCheckDialog();
 
     /**
-     * @brief Processes received data against auto-answer triggers.
-     * @param data Newly received data
+     * @brief Shows the frame check counters in the status bar.
      */
-    void processAutoTriggers(const QByteArray &data);
+    void updateFrameCheckStatus();
 
     /**
      * @brief Opens the Auto-Trigger configuration dialog.
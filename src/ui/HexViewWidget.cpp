@@ -0,0 +1,329 @@
+/**
+ * @file HexViewWidget.cpp
+ * @brief Implementation of the virtualised hex/ASCII viewer.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ */
+
+#include "HexViewWidget.h"
+
+#include <QApplication>
+#include <QClipboard>
+#include <QKeyEvent>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QScrollBar>
+
+#include <climits>
+
+static const int MARGIN = 4;
+
+HexViewWidget::HexViewWidget(QWidget *parent) : QAbstractScrollArea(parent)
+{
+    QFont f("Consolas", 10);
+    f.setStyleHint(QFont::Monospace);
+    f.setFixedPitch(true);
+    setFont(f);
+
+    setFocusPolicy(Qt::StrongFocus);
+    viewport()->setCursor(Qt::IBeamCursor);
+
+    updateMetrics();
+    updateScrollBar();
+}
+
+void HexViewWidget::setData(const QByteArray &data)
+{
+    m_data = data;
+    m_anchor = 0;
+    m_cursor = 0;
+    m_hasSelection = false;
+
+    updateMetrics();
+    updateScrollBar();
+    verticalScrollBar()->setValue(0);
+    viewport()->update();
+    emit selectionChanged(0, 0);
+}
+
+qint64 HexViewWidget::selectionLength() const
+{
+    if (!m_hasSelection || m_data.isEmpty())
+        return 0;
+    return qAbs(m_cursor - m_anchor) + 1;
+}
+
+QByteArray HexViewWidget::selectedBytes() const
+{
+    return m_data.mid(selectionStart(), selectionLength());
+}
+
+bool HexViewWidget::gotoOffset(qint64 offset)
+{
+    if (offset < 0 || offset >= m_data.size())
+        return false;
+    setSelection(offset, 1);
+    return true;
+}
+
+void HexViewWidget::setSelection(qint64 start, qint64 length)
+{
+    if (m_data.isEmpty() || length <= 0)
+        return;
+
+    m_anchor = qBound<qint64>(0, start, m_data.size() - 1);
+    m_cursor = qBound<qint64>(0, start + length - 1, m_data.size() - 1);
+    m_hasSelection = true;
+
+    ensureVisible(m_cursor);
+    ensureVisible(m_anchor);
+    viewport()->update();
+    emit selectionChanged(selectionStart(), selectionLength());
+}
+
+qint64 HexViewWidget::find(const QByteArray &pattern, bool forward)
+{
+    if (pattern.isEmpty() || m_data.isEmpty())
+        return -1;
+
+    qint64 idx;
+    if (forward) {
+        qint64 from = m_hasSelection ? selectionStart() + 1 : 0;
+        idx = m_data.indexOf(pattern, from);
+        if (idx < 0 && from > 0)
+            idx = m_data.indexOf(pattern, 0); // wrap around
+    } else {
+        qint64 from = m_hasSelection ? selectionStart() - 1 : m_data.size() - 1;
+        idx = from >= 0 ? m_data.lastIndexOf(pattern, from) : -1;
+        if (idx < 0)
+            idx = m_data.lastIndexOf(pattern); // wrap around
+    }
+
+    if (idx >= 0)
+        setSelection(idx, pattern.size());
+    return idx;
+}
+
+void HexViewWidget::copySelection()
+{
+    if (selectionLength() == 0)
+        return;
+    QApplication::clipboard()->setText(selectedBytes().toHex(' ').toUpper());
+}
+
+// --- Layout ---
+
+qint64 HexViewWidget::lineCount() const
+{
+    return (m_data.size() + BYTES_PER_LINE - 1) / BYTES_PER_LINE;
+}
+
+int HexViewWidget::visibleLines() const
+{
+    return qMax(1, viewport()->height() / m_lineHeight);
+}
+
+void HexViewWidget::updateMetrics()
+{
+    QFontMetrics fm(font());
+    m_charWidth = fm.horizontalAdvance(QLatin1Char('0'));
+    m_lineHeight = fm.height();
+    m_offsetDigits = (m_data.size() > 0xFFFFFFFFLL) ? 12 : 8;
+
+    // "OOOOOOOO  HH HH HH HH HH HH HH HH  HH HH HH HH HH HH HH HH  AAAAAAAAAAAAAAAA"
+    m_hexX = MARGIN + (m_offsetDigits + 2) * m_charWidth;
+    m_asciiX = m_hexX + (BYTES_PER_LINE * 3 + 2) * m_charWidth;
+}
+
+void HexViewWidget::updateScrollBar()
+{
+    int vis = visibleLines();
+    qint64 maxLine = qMax<qint64>(0, lineCount() - vis);
+    verticalScrollBar()->setRange(0, static_cast<int>(qMin<qint64>(maxLine, INT_MAX)));
+    verticalScrollBar()->setPageStep(vis);
+    verticalScrollBar()->setSingleStep(1);
+
+    int totalWidth = m_asciiX + BYTES_PER_LINE * m_charWidth + MARGIN;
+    horizontalScrollBar()->setRange(0, qMax(0, totalWidth - viewport()->width()));
+    horizontalScrollBar()->setPageStep(viewport()->width());
+}
+
+void HexViewWidget::ensureVisible(qint64 offset)
+{
+    qint64 line = offset / BYTES_PER_LINE;
+    qint64 first = verticalScrollBar()->value();
+    int vis = visibleLines();
+
+    if (line < first)
+        verticalScrollBar()->setValue(static_cast<int>(qMin<qint64>(line, INT_MAX)));
+    else if (line >= first + vis)
+        verticalScrollBar()->setValue(static_cast<int>(qMin<qint64>(line - vis + 1, INT_MAX)));
+}
+
+qint64 HexViewWidget::offsetAt(const QPoint &pos) const
+{
+    if (m_data.isEmpty())
+        return 0;
+
+    int x = pos.x() + horizontalScrollBar()->value();
+    qint64 line = verticalScrollBar()->value() + qMax(0, pos.y()) / m_lineHeight;
+
+    int col;
+    if (x >= m_asciiX - m_charWidth) {
+        col = (x - m_asciiX) / m_charWidth;
+    } else {
+        int rel = (x - m_hexX) / m_charWidth;
+        if (rel >= (BYTES_PER_LINE / 2) * 3 + 1)
+            rel -= 1; // skip the gap between the two 8-byte groups
+        col = rel / 3;
+    }
+    col = qBound(0, col, BYTES_PER_LINE - 1);
+
+    return qBound<qint64>(0, line * BYTES_PER_LINE + col, m_data.size() - 1);
+}
+
+// --- Events ---
+
+void HexViewWidget::resizeEvent(QResizeEvent *event)
+{
+    QAbstractScrollArea::resizeEvent(event);
+    updateScrollBar();
+}
+
+void HexViewWidget::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event);
+    static const char hexDigits[] = "0123456789ABCDEF";
+
+    QPainter p(viewport());
+    p.setFont(font());
+    const QPalette &pal = viewport()->palette();
+    p.fillRect(viewport()->rect(), pal.base());
+
+    const int xoff = -horizontalScrollBar()->value();
+    const int ascent = QFontMetrics(font()).ascent();
+    const qint64 firstLine = verticalScrollBar()->value();
+    const qint64 lines = lineCount();
+    const qint64 selStart = selectionStart();
+    const qint64 selEnd = selStart + selectionLength(); // exclusive
+    const uchar *bytes = reinterpret_cast<const uchar *>(m_data.constData());
+
+    // Divider between hex and ASCII columns
+    p.setPen(pal.mid().color());
+    int divX = xoff + m_asciiX - m_charWidth;
+    p.drawLine(divX, 0, divX, viewport()->height());
+
+    QString hexLine(BYTES_PER_LINE * 3 + 1, QLatin1Char(' '));
+    QString asciiLine(BYTES_PER_LINE, QLatin1Char(' '));
+
+    for (int row = 0; row <= visibleLines(); ++row) {
+        qint64 line = firstLine + row;
+        if (line >= lines)
+            break;
+
+        qint64 lineOffset = line * BYTES_PER_LINE;
+        int n = static_cast<int>(qMin<qint64>(BYTES_PER_LINE, m_data.size() - lineOffset));
+        int y = row * m_lineHeight;
+
+        // Selection background for the part of [selStart, selEnd) on this line
+        qint64 a = qMax(selStart, lineOffset);
+        qint64 b = qMin(selEnd, lineOffset + n);
+        if (a < b) {
+            int ca = static_cast<int>(a - lineOffset);
+            int cb = static_cast<int>(b - lineOffset) - 1;
+            int hx0 = m_hexX + (ca * 3 + (ca >= BYTES_PER_LINE / 2 ? 1 : 0)) * m_charWidth;
+            int hx1 = m_hexX + (cb * 3 + (cb >= BYTES_PER_LINE / 2 ? 1 : 0) + 2) * m_charWidth;
+            p.fillRect(xoff + hx0, y, hx1 - hx0, m_lineHeight, pal.highlight());
+            p.fillRect(xoff + m_asciiX + ca * m_charWidth, y,
+                       (cb - ca + 1) * m_charWidth, m_lineHeight, pal.highlight());
+        }
+
+        for (int i = 0; i < BYTES_PER_LINE; ++i) {
+            int hpos = i * 3 + (i >= BYTES_PER_LINE / 2 ? 1 : 0);
+            if (i < n) {
+                uchar c = bytes[lineOffset + i];
+                hexLine[hpos] = QLatin1Char(hexDigits[c >> 4]);
+                hexLine[hpos + 1] = QLatin1Char(hexDigits[c & 0x0F]);
+                asciiLine[i] = (c >= 0x20 && c <= 0x7E) ? QLatin1Char(c) : QLatin1Char('.');
+            } else {
+                hexLine[hpos] = QLatin1Char(' ');
+                hexLine[hpos + 1] = QLatin1Char(' ');
+                asciiLine[i] = QLatin1Char(' ');
+            }
+        }
+
+        p.setPen(QColor("#9E9E9E"));
+        p.drawText(xoff + MARGIN, y + ascent,
+                   QString("%1").arg(lineOffset, m_offsetDigits, 16, QChar('0')).toUpper());
+        p.setPen(pal.text().color());
+        p.drawText(xoff + m_hexX, y + ascent, hexLine);
+        p.setPen(QColor("#4CAF50"));
+        p.drawText(xoff + m_asciiX, y + ascent, asciiLine);
+    }
+}
+
+void HexViewWidget::moveCursor(qint64 offset, bool extendSelection)
+{
+    if (m_data.isEmpty())
+        return;
+
+    m_cursor = qBound<qint64>(0, offset, m_data.size() - 1);
+    if (!extendSelection || !m_hasSelection)
+        m_anchor = m_cursor;
+    m_hasSelection = true;
+
+    ensureVisible(m_cursor);
+    viewport()->update();
+    emit selectionChanged(selectionStart(), selectionLength());
+}
+
+void HexViewWidget::mousePressEvent(QMouseEvent *event)
+{
+    if (event->button() != Qt::LeftButton)
+        return;
+    moveCursor(offsetAt(event->position().toPoint()), event->modifiers() & Qt::ShiftModifier);
+}
+
+void HexViewWidget::mouseMoveEvent(QMouseEvent *event)
+{
+    if (event->buttons() & Qt::LeftButton)
+        moveCursor(offsetAt(event->position().toPoint()), true);
+}
+
+void HexViewWidget::keyPressEvent(QKeyEvent *event)
+{
+    if (event->matches(QKeySequence::Copy)) {
+        copySelection();
+        return;
+    }
+    if (event->matches(QKeySequence::SelectAll)) {
+        setSelection(0, m_data.size());
+        return;
+    }
+
+    bool shift = event->modifiers() & Qt::ShiftModifier;
+    qint64 page = static_cast<qint64>(visibleLines()) * BYTES_PER_LINE;
+
+    switch (event->key()) {
+    case Qt::Key_Left:     moveCursor(m_cursor - 1, shift); break;
+    case Qt::Key_Right:    moveCursor(m_cursor + 1, shift); break;
+    case Qt::Key_Up:       moveCursor(m_cursor - BYTES_PER_LINE, shift); break;
+    case Qt::Key_Down:     moveCursor(m_cursor + BYTES_PER_LINE, shift); break;
+    case Qt::Key_PageUp:   moveCursor(m_cursor - page, shift); break;
+    case Qt::Key_PageDown: moveCursor(m_cursor + page, shift); break;
+    case Qt::Key_Home:
+        moveCursor((event->modifiers() & Qt::ControlModifier)
+                       ? 0 : m_cursor - (m_cursor % BYTES_PER_LINE), shift);
+        break;
+    case Qt::Key_End:
+        moveCursor((event->modifiers() & Qt::ControlModifier)
+                       ? m_data.size() - 1
+                       : m_cursor - (m_cursor % BYTES_PER_LINE) + BYTES_PER_LINE - 1, shift);
+        break;
+    default:
+        QAbstractScrollArea::keyPressEvent(event);
+    }
+}
@@ -0,0 +1,105 @@
+/**
+ * @file HexViewWidget.h
+ * @brief Virtualised hex/ASCII viewer for arbitrarily large byte arrays.
+ *
+ * @project PacketForge
+ * @author Ritesh Pandit (Riteshp2001)
+ * @copyright Copyright (c) 2025 Ritesh Pandit. All rights reserved.
+ * @license MIT License
+ *
+ * @description
+ * Only the lines currently visible in the viewport are formatted and
+ * painted, directly from the raw QByteArray (implicitly shared, never
+ * copied or converted to a string). Opening a multi-megabyte payload is
+ * therefore instant, and memory use does not grow with payload size.
+ */
+
+#ifndef HEXVIEWWIDGET_H
+#define HEXVIEWWIDGET_H
+
+#include <QAbstractScrollArea>
+#include <QByteArray>
+
+/**
+ * @brief Scrollable offset / hex / ASCII view with selection and search.
+ */
+class HexViewWidget : public QAbstractScrollArea
+{
+    Q_OBJECT
+
+public:
+    explicit HexViewWidget(QWidget *parent = nullptr);
+
+    /**
+     * @brief Sets the bytes to display. The array is shared, not copied.
+     */
+    void setData(const QByteArray &data);
+    const QByteArray &data() const { return m_data; }
+
+    /**
+     * @brief Selected range as [start, start + length).
+     */
+    qint64 selectionStart() const { return qMin(m_anchor, m_cursor); }
+    qint64 selectionLength() const;
+    QByteArray selectedBytes() const;
+
+    /**
+     * @brief Moves the cursor to an offset, selects that byte and scrolls to it.
+     * @return false if the offset is outside the data.
+     */
+    bool gotoOffset(qint64 offset);
+
+    /**
+     * @brief Selects [start, start + length) and scrolls it into view.
+     */
+    void setSelection(qint64 start, qint64 length);
+
+    /**
+     * @brief Searches for a byte pattern starting next to the current selection.
+     * @param pattern Bytes to find
+     * @param forward Search direction
+     * @return Offset of the match (now selected), or -1 if not found.
+     */
+    qint64 find(const QByteArray &pattern, bool forward = true);
+
+public slots:
+    /**
+     * @brief Copies the selection to the clipboard as space separated hex.
+     */
+    void copySelection();
+
+signals:
+    void selectionChanged(qint64 start, qint64 length);
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void keyPressEvent(QKeyEvent *event) override;
+
+private:
+    void updateMetrics();
+    void updateScrollBar();
+    void ensureVisible(qint64 offset);
+    void moveCursor(qint64 offset, bool extendSelection);
+    qint64 offsetAt(const QPoint &pos) const;
+    qint64 lineCount() const;
+    int visibleLines() const;
+
+    QByteArray m_data;
+    qint64 m_anchor = 0;            ///< Selection start (where the drag began)
+    qint64 m_cursor = 0;            ///< Selection end / keyboard position
+    bool m_hasSelection = false;
+
+    // Layout (pixels), recomputed when the font changes
+    int m_charWidth = 8;
+    int m_lineHeight = 16;
+    int m_offsetDigits = 8;
+    int m_hexX = 0;
+    int m_asciiX = 0;
+
+    static const int BYTES_PER_LINE = 16;
+};
+
+#endif // HEXVIEWWIDGET_H
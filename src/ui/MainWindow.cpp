@@ -35,6 +35,8 @@
 #include <ModbusClientWidget.h>
 #include <OscilloscopeWidget.h>
 #include <TrafficMonitorWidget.h>
+#include <CaptureViewerWidget.h>
+#include <CrcSolverWidget.h>
 #include "AutoUpdater.h"
 #include <QTimer>
 #include <QMessageBox>
@@ -114,6 +116,9 @@ MainWindow::MainWindow(QWidget *parent)
   cmbTools->addItem("Oscilloscope");
   cmbTools->addItem("Byte Visualizer");
   cmbTools->addItem("Checksum Calculator");
+  cmbTools->addItem("Traffic Monitor");
+  cmbTools->addItem("Capture Viewer");
+  cmbTools->addItem("CRC Solver");
   cmbTools->setCurrentIndex(0);
   cmbTools->setMinimumWidth(110);
   cmbTools->setFixedHeight(ui->closeApp->height());
@@ -193,6 +198,55 @@ MainWindow::MainWindow(QWidget *parent)
               ui->mainTabWidget->setCurrentWidget(checksum);
               break;
             }
+            case 6: {
+              for (int i = 0; i < ui->mainTabWidget->count(); i++) {
+                if (qobject_cast<TrafficMonitorWidget *>(
+                        ui->mainTabWidget->widget(i))) {
+                  ui->mainTabWidget->setCurrentIndex(i);
+                  cmbTools->setCurrentIndex(0);
+                  return;
+                }
+              }
+              TrafficMonitorWidget *monitor = new TrafficMonitorWidget(this);
+              ui->mainTabWidget->addTab(monitor, "Traffic Monitor");
+              ui->mainTabWidget->setCurrentWidget(monitor);
+              for (int i = 0; i < ui->mainTabWidget->count(); i++) {
+                if (ConnectionTab *tab = qobject_cast<ConnectionTab *>(
+                        ui->mainTabWidget->widget(i))) {
+                  connect(tab, &ConnectionTab::logData, monitor,
+                          &TrafficMonitorWidget::appendData);
+                }
+              }
+              break;
+            }
+            case 7: {
+              for (int i = 0; i < ui->mainTabWidget->count(); i++) {
+                if (qobject_cast<CaptureViewerWidget *>(
+                        ui->mainTabWidget->widget(i))) {
+                  ui->mainTabWidget->setCurrentIndex(i);
+                  cmbTools->setCurrentIndex(0);
+                  return;
+                }
+              }
+              CaptureViewerWidget *viewer = new CaptureViewerWidget(this);
+              ui->mainTabWidget->addTab(viewer, "Capture Viewer");
+              ui->mainTabWidget->setCurrentWidget(viewer);
+              break;
+            }
+            case 8: {
+              for (int i = 0; i < ui->mainTabWidget->count(); i++) {
+                if (qobject_cast<CrcSolverWidget *>(
+                        ui->mainTabWidget->widget(i))) {
+                  ui->mainTabWidget->setCurrentIndex(i);
+                  cmbTools->setCurrentIndex(0);
+                  return;
+                }
+              }
+              CrcSolverWidget *solver = new CrcSolverWidget(this);
+              ui->mainTabWidget->addTab(solver, "CRC Solver");
+              ui->mainTabWidget->setCurrentWidget(solver);
+              break;
+            }
             }
             cmbTools->setCurrentIndex(0);
           });
@@ -212,6 +266,9 @@ MainWindow::MainWindow(QWidget *parent)
                 oldName, &ok);
             if (ok && !newName.isEmpty()) {
               ui->mainTabWidget->setTabText(index, newName);
+              // Capture tools identify interfaces by the tab's object name
+              if (qobject_cast<ConnectionTab *>(ui->mainTabWidget->widget(index)))
+                ui->mainTabWidget->widget(index)->setObjectName(newName);
             }
           });
 
@@ -259,9 +316,10 @@ void MainWindow::on_closeApp_clicked() { close(); }
  */
 void MainWindow::createNewTab() {
   ConnectionTab *tab = new ConnectionTab(this);
-  int index = ui->mainTabWidget->insertTab(
-      ui->mainTabWidget->count() - 1, tab,
-      "Terminal " + QString::number(ui->mainTabWidget->count()));
+  QString tabName = "Terminal " + QString::number(ui->mainTabWidget->count());
+  tab->setObjectName(tabName);
+  int index =
+      ui->mainTabWidget->insertTab(ui->mainTabWidget->count() - 1, tab, tabName);
 
   TrafficMonitorWidget *monitor = nullptr;
   for (int i = 0; i < ui->mainTabWidget->count(); i++) {